@@ -0,0 +1,209 @@
+#!/usr/bin/env bash
+
+EXECUTABLE=""
+TAPS_MIN=4
+TAPS_MAX=4096
+TAPS_RATIO=2
+
+################################################################################
+#
+# Usage:
+#     srun -n1 --exclusive sweep_fir.sh -x raja-perf.exe [-- <raja perf args>]
+#
+# Runs the Apps_FIR kernel over a range of tap counts, one run per tap count
+# in its own directory, and collects the time per output of each variant
+# tuning against the tap count into fir-sweep-time.csv. For each variant,
+# fir-sweep-crossover.csv gives the smallest tap count of the sweep at which
+# the fft_overlap_save tuning is faster than all the direct tunings.
+#
+# Parse any args for this script and consume them using shift
+# leave the raja perf arguments if any for later use
+#
+# Examples:
+#     lalloc 1 lrun -n1 sweep_fir.sh -x raja-perf.exe -- <args>
+#       # run a sweep of default tap counts with executable `raja-perf.exe`
+#       # with args `args`
+#
+#     srun -n1 --exclusive sweep_fir.sh -x raja-perf.exe --taps-min 16
+#            --taps-max 1024 --taps-ratio 4 -- -v Base_Seq Base_OpenMP
+#       # run a sweep of tap counts 16 to 1024 with ratio 4 (16, 64, 256,
+#       # 1024) of the Base_Seq and Base_OpenMP variants
+#
+################################################################################
+while [ "$#" -gt 0 ]; do
+
+  if [[ "$1" =~ ^\-.* ]]; then
+
+    if [[ "x$1" == "x-x" || "x$1" == "x--executable" ]]; then
+
+      exec="$2"
+      if ! [[ "x$exec" == x/* ]]; then
+        exec="$(pwd)/$exec"
+      fi
+
+      EXECUTABLE="$exec"
+      shift
+
+    elif [[ "x$1" == "x-m" || "x$1" == "x--taps-min" ]]; then
+
+      TAPS_MIN="$2"
+      shift
+
+    elif [[ "x$1" == "x-M" || "x$1" == "x--taps-max" ]]; then
+
+      TAPS_MAX="$2"
+      shift
+
+    elif [[ "x$1" == "x-r" || "x$1" == "x--taps-ratio" ]]; then
+
+      TAPS_RATIO="$2"
+      shift
+
+    elif [[ "x$1" == "x--" ]]; then
+
+      shift
+      break
+
+    else
+
+      echo "Unknown arg: $1" 1>&2
+      exit 1
+
+    fi
+
+  else
+    break
+  fi
+
+  shift
+
+done
+
+echo "Running FIR sweep with executable: $EXECUTABLE"
+echo "Sweeping from $TAPS_MIN to $TAPS_MAX taps with ratio $TAPS_RATIO"
+echo "extra args to executable are: $@"
+
+
+################################################################################
+# check tap counts and ratio
+################################################################################
+if [[ "$TAPS_MIN" -le 0 ]]; then
+  echo "Invalid taps-min: $TAPS_MIN" 1>&2
+  exit 1
+fi
+if [[ "$TAPS_MAX" -le 0 ]]; then
+  echo "Invalid taps-max: $TAPS_MAX" 1>&2
+  exit 1
+fi
+if [[ "$TAPS_RATIO" -le 1 ]]; then
+  echo "Invalid taps-ratio: $TAPS_RATIO" 1>&2
+  exit 1
+fi
+if [[ "$TAPS_MIN" -gt "$TAPS_MAX" ]]; then
+  echo "Invalid tap counts taps-min: $TAPS_MIN, taps-max: $TAPS_MAX" 1>&2
+  exit 1
+fi
+
+################################################################################
+# check executable exists and is executable
+################################################################################
+if [[ ! -f "$EXECUTABLE" ]]; then
+  echo "Executable not found: $EXECUTABLE" 1>&2
+  exit 1
+elif [[ ! -x "$EXECUTABLE" ]]; then
+  echo "Executable not executable: $EXECUTABLE" 1>&2
+  exit 1
+fi
+
+mkdir "RAJAPerf_fir" || exit 1
+
+OUT_FILE="$(pwd)/RAJAPerf_fir/fir-sweep-time.csv"
+CROSSOVER_FILE="$(pwd)/RAJAPerf_fir/fir-sweep-crossover.csv"
+echo "Taps , Kernel , Variant , Tuning , ns per output" > "$OUT_FILE"
+
+TAPS="$TAPS_MIN"
+while [[ "$TAPS" -le "$TAPS_MAX" ]]; do
+
+  cd "RAJAPerf_fir" || exit 1
+
+  TAPS_FILE="$(printf "TAPS_%05d" $TAPS)"
+  mkdir "$TAPS_FILE" && cd "$TAPS_FILE" || exit 1
+
+  echo "$EXECUTABLE -k Apps_FIR --fir_coefflen $TAPS $@"
+  echo "$EXECUTABLE -k Apps_FIR --fir_coefflen $TAPS $@" &> "raja-perf-sweep.txt"
+        $EXECUTABLE -k Apps_FIR --fir_coefflen $TAPS $@ &>> "raja-perf-sweep.txt"
+
+  #
+  # Join the reps and iterations (outputs) of the kernel with the average
+  # time of all reps of each variant tuning.
+  #
+  if [[ -f "RAJAPerf-kernels.csv" && -f "RAJAPerf-timing-Average.csv" ]]; then
+
+    awk -F ',' -v taps="$TAPS" '
+      function trim(s) { gsub(/^[ \t]+|[ \t]+$/, "", s); return s }
+      FNR == NR {
+        if (FNR > 2) {
+          k = trim($1)
+          reps[k] = trim($3); its[k] = trim($4)
+        }
+        next
+      }
+      FNR == 2 { for (c = 2; c <= NF; ++c) variant[c] = trim($c); next }
+      FNR == 3 { for (c = 2; c <= NF; ++c) tuning[c] = trim($c); next }
+      FNR > 3 {
+        k = trim($1)
+        if (!(k in reps) || k != "Apps_FIR") next
+        for (c = 2; c <= NF; ++c) {
+          t = trim($c)
+          if (t == "Not run" || t + 0.0 <= 0.0) continue
+          printf "%d , %s , %s , %s , %.6f\n", taps, k,
+                 variant[c], tuning[c], t / reps[k] / its[k] * 1.0e9
+        }
+      }' "RAJAPerf-kernels.csv" "RAJAPerf-timing-Average.csv" >> "$OUT_FILE"
+
+  fi
+
+  cd ../..
+
+  let TAPS=TAPS*TAPS_RATIO
+
+done
+
+#
+# For each variant find the smallest tap count where the FFT tuning beats
+# the fastest direct tuning.
+#
+awk -F ',' '
+  function trim(s) { gsub(/^[ \t]+|[ \t]+$/, "", s); return s }
+  NR > 1 {
+    taps = trim($1) + 0; v = trim($3); tun = trim($4); t = trim($5) + 0.0
+    if (tun == "fft_overlap_save") {
+      variants[v] = 1
+      fft[v, taps] = t
+    } else if (!((v, taps) in direct) || t < direct[v, taps]) {
+      direct[v, taps] = t
+    }
+    if (!((v, taps) in seen)) {
+      seen[v, taps] = 1
+      ntaps[v] += 1
+      tap_list[v, ntaps[v]] = taps
+    }
+  }
+  END {
+    print "Variant , Crossover taps"
+    for (v in variants) {
+      crossover = "none"
+      for (n = 1; n <= ntaps[v]; ++n) {
+        taps = tap_list[v, n]
+        if (((v, taps) in fft) && ((v, taps) in direct) &&
+            fft[v, taps] < direct[v, taps]) {
+          crossover = taps
+          break
+        }
+      }
+      printf "%s , %s\n", v, crossover
+    }
+  }' "$OUT_FILE" > "$CROSSOVER_FILE"
+
+echo "FIR sweep time per output written to $OUT_FILE"
+echo "FIR sweep crossover written to $CROSSOVER_FILE"
@@ -0,0 +1,186 @@
+#!/usr/bin/env bash
+
+EXECUTABLE=""
+WIDTH_MIN=1
+WIDTH_MAX=8
+WIDTH_RATIO=2
+
+################################################################################
+#
+# Usage:
+#     srun -n1 --exclusive sweep_halo.sh -x raja-perf.exe [-- <raja perf args>]
+#
+# Runs the comm kernels over a range of halo widths, one run per width in
+# its own directory, and collects the packing bandwidth of each kernel
+# variant against the average message size into halo-sweep-bandwidth.csv.
+# Halo variable count, grid shape and variable layout may be set with the
+# raja perf args --halo_num_vars, --halo_grid_dims and --halo_var_layout;
+# the interleaved layout is only supported with -k Comm_HALO_PACKING.
+#
+# Parse any args for this script and consume them using shift
+# leave the raja perf arguments if any for later use
+#
+# Examples:
+#     lalloc 1 lrun -n1 sweep_halo.sh -x raja-perf.exe -- <args>
+#       # run a sweep of default halo widths with executable `raja-perf.exe`
+#       # with args `args`
+#
+#     srun -n1 --exclusive sweep_halo.sh -x raja-perf.exe --width-min 1
+#            --width-max 16 --width-ratio 2 -- -k Comm_HALO_PACKING
+#            --halo_num_vars 8 --halo_var_layout interleaved
+#       # run a sweep of halo widths 1 to 16 with ratio 2 (1, 2, 4, 8, 16)
+#       # packing eight interleaved variables
+#
+################################################################################
+while [ "$#" -gt 0 ]; do
+
+  if [[ "$1" =~ ^\-.* ]]; then
+
+    if [[ "x$1" == "x-x" || "x$1" == "x--executable" ]]; then
+
+      exec="$2"
+      if ! [[ "x$exec" == x/* ]]; then
+        exec="$(pwd)/$exec"
+      fi
+
+      EXECUTABLE="$exec"
+      shift
+
+    elif [[ "x$1" == "x-m" || "x$1" == "x--width-min" ]]; then
+
+      WIDTH_MIN="$2"
+      shift
+
+    elif [[ "x$1" == "x-M" || "x$1" == "x--width-max" ]]; then
+
+      WIDTH_MAX="$2"
+      shift
+
+    elif [[ "x$1" == "x-r" || "x$1" == "x--width-ratio" ]]; then
+
+      WIDTH_RATIO="$2"
+      shift
+
+    elif [[ "x$1" == "x--" ]]; then
+
+      shift
+      break
+
+    else
+
+      echo "Unknown arg: $1" 1>&2
+      exit 1
+
+    fi
+
+  else
+    break
+  fi
+
+  shift
+
+done
+
+echo "Running halo sweep with executable: $EXECUTABLE"
+echo "Sweeping from halo width $WIDTH_MIN to $WIDTH_MAX with ratio $WIDTH_RATIO"
+echo "extra args to executable are: $@"
+
+
+################################################################################
+# check widths and ratio
+################################################################################
+if [[ "$WIDTH_MIN" -le 0 ]]; then
+  echo "Invalid width-min: $WIDTH_MIN" 1>&2
+  exit 1
+fi
+if [[ "$WIDTH_MAX" -le 0 ]]; then
+  echo "Invalid width-max: $WIDTH_MAX" 1>&2
+  exit 1
+fi
+if [[ "$WIDTH_RATIO" -le 1 ]]; then
+  echo "Invalid width-ratio: $WIDTH_RATIO" 1>&2
+  exit 1
+fi
+if [[ "$WIDTH_MIN" -gt "$WIDTH_MAX" ]]; then
+  echo "Invalid widths width-min: $WIDTH_MIN, width-max: $WIDTH_MAX" 1>&2
+  exit 1
+fi
+
+################################################################################
+# check executable exists and is executable
+################################################################################
+if [[ ! -f "$EXECUTABLE" ]]; then
+  echo "Executable not found: $EXECUTABLE" 1>&2
+  exit 1
+elif [[ ! -x "$EXECUTABLE" ]]; then
+  echo "Executable not executable: $EXECUTABLE" 1>&2
+  exit 1
+fi
+
+mkdir "RAJAPerf_halo" || exit 1
+
+OUT_FILE="$(pwd)/RAJAPerf_halo/halo-sweep-bandwidth.csv"
+echo "Halo width , Kernel , Variant , Tuning , Avg message bytes , GB/s" > "$OUT_FILE"
+
+WIDTH="$WIDTH_MIN"
+while [[ "$WIDTH" -le "$WIDTH_MAX" ]]; do
+
+  cd "RAJAPerf_halo" || exit 1
+
+  WIDTH_FILE="$(printf "WIDTH_%04d" $WIDTH)"
+  mkdir "$WIDTH_FILE" && cd "$WIDTH_FILE" || exit 1
+
+  echo "$EXECUTABLE --halo_width $WIDTH $@"
+  echo "$EXECUTABLE --halo_width $WIDTH $@" &> "raja-perf-sweep.txt"
+        $EXECUTABLE --halo_width $WIDTH $@ &>> "raja-perf-sweep.txt"
+
+  #
+  # Join per-kernel reps and bytes with the average message size reported
+  # by each variant tuning in the metric report and the average time of all
+  # reps of that variant tuning.
+  #
+  if [[ -f "RAJAPerf-kernels.csv" && -f "RAJAPerf-metrics.csv" &&
+        -f "RAJAPerf-timing-Average.csv" ]]; then
+
+    awk -F ',' -v width="$WIDTH" '
+      function trim(s) { gsub(/^[ \t]+|[ \t]+$/, "", s); return s }
+      FILENAME == ARGV[1] {
+        if (FNR > 2) {
+          k = trim($1)
+          reps[k] = trim($3); bytes[k] = trim($6)
+        }
+        next
+      }
+      FILENAME == ARGV[2] {
+        k = trim($1)
+        if (FNR > 3 && sub(/ \(avg message bytes\)$/, "", k)) {
+          for (c = 2; c <= NF; ++c) msg_bytes[k, c] = trim($c)
+        }
+        next
+      }
+      FNR == 2 { for (c = 2; c <= NF; ++c) variant[c] = trim($c); next }
+      FNR == 3 { for (c = 2; c <= NF; ++c) tuning[c] = trim($c); next }
+      FNR > 3 {
+        k = trim($1)
+        if (!(k in reps) || k !~ /^Comm_HALO/) next
+        for (c = 2; c <= NF; ++c) {
+          t = trim($c)
+          if (t == "Not run" || t + 0.0 <= 0.0) continue
+          m = msg_bytes[k, c]
+          if (m == "" || m == "n/a" || m == "Not run") continue
+          printf "%d , %s , %s , %s , %.0f , %.3f\n", width, k,
+                 variant[c], tuning[c], m,
+                 bytes[k] * reps[k] / t / 1.0e9
+        }
+      }' "RAJAPerf-kernels.csv" "RAJAPerf-metrics.csv" \
+         "RAJAPerf-timing-Average.csv" >> "$OUT_FILE"
+
+  fi
+
+  cd ../..
+
+  let WIDTH=WIDTH*WIDTH_RATIO
+
+done
+
+echo "Halo sweep bandwidth written to $OUT_FILE"
@@ -22,7 +22,14 @@
 int main( int argc, char** argv )
 {
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
-  MPI_Init(&argc, &argv);
+  // OpenMP variants of the halo kernels only call MPI from the master thread
+  int mpi_thread_support;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &mpi_thread_support);
+  if (mpi_thread_support < MPI_THREAD_FUNNELED) {
+    rajaperf::getCout() << "\nRAJAPerf: MPI_THREAD_FUNNELED not supported,"
+                        << " aborting" << std::endl;
+    MPI_Abort(MPI_COMM_WORLD, 1);
+  }
 
   int num_ranks;
   MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
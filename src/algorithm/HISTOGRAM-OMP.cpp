@@ -0,0 +1,398 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HISTOGRAM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void HISTOGRAM::runOpenMPVariantDefault(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for
+          for (Index_type b = 0; b < num_bins; ++b ) {
+            HISTOGRAM_INIT;
+          }
+
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            #pragma omp atomic
+            HISTOGRAM_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_bins), [=](Index_type b) {
+          HISTOGRAM_INIT;
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          HISTOGRAM_RAJA_BODY(RAJA::omp_atomic);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HISTOGRAM::runOpenMPVariantBuiltinAtomic(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_bins), [=](Index_type b) {
+          HISTOGRAM_INIT;
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          HISTOGRAM_RAJA_BODY(RAJA::builtin_atomic);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Relaxed atomic adds, which need no ordering with other memory accesses.
+//
+void HISTOGRAM::runOpenMPVariantAtomicRelaxed(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for
+          for (Index_type b = 0; b < num_bins; ++b ) {
+            HISTOGRAM_INIT;
+          }
+
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+#if defined(__cpp_lib_atomic_ref)
+            std::atomic_ref<Int_type>(counts[bins[i]]).fetch_add(
+                1, std::memory_order_relaxed);
+#else
+            __atomic_fetch_add(&counts[bins[i]], 1, __ATOMIC_RELAXED);
+#endif
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Each thread counts into its own histogram, then the histograms are
+// summed over threads for each bin.
+//
+void HISTOGRAM::runOpenMPVariantPrivatized(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      Int_ptr thread_counts;
+      allocData(thread_counts, omp_get_max_threads() * num_bins, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const Index_type nthreads = omp_get_num_threads();
+          Int_ptr my_counts = thread_counts + omp_get_thread_num() * num_bins;
+
+          for (Index_type b = 0; b < num_bins; ++b ) {
+            my_counts[b] = 0;
+          }
+
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            my_counts[bins[i]] += 1;
+          }
+
+          #pragma omp for
+          for (Index_type b = 0; b < num_bins; ++b ) {
+            Int_type count = 0;
+            for (Index_type t = 0; t < nthreads; ++t ) {
+              count += thread_counts[b + t * num_bins];
+            }
+            counts[b] = count;
+          }
+        }
+
+      }
+      stopTimer();
+
+      deallocData(thread_counts, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Each thread sorts its contiguous chunk of indices, then adds the length
+// of each run of equal indices to its bin with one atomic.
+//
+void HISTOGRAM::runOpenMPVariantSortReduce(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      Int_ptr sorted_bins;
+      allocData(sorted_bins, iend - ibegin, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for
+          for (Index_type b = 0; b < num_bins; ++b ) {
+            HISTOGRAM_INIT;
+          }
+
+          const Index_type nthreads = omp_get_num_threads();
+          const Index_type tid = omp_get_thread_num();
+          const Index_type len = iend - ibegin;
+          const Index_type cbegin = (len * tid) / nthreads;
+          const Index_type cend = (len * (tid + 1)) / nthreads;
+
+          std::copy(bins + ibegin + cbegin, bins + ibegin + cend,
+                    sorted_bins + cbegin);
+          std::sort(sorted_bins + cbegin, sorted_bins + cend);
+
+          Index_type i = cbegin;
+          while ( i < cend ) {
+            const Int_type bin = sorted_bins[i];
+            Index_type j = i + 1;
+            while ( j < cend && sorted_bins[j] == bin ) {
+              ++j;
+            }
+            #pragma omp atomic
+            counts[bin] += static_cast<Int_type>(j - i);
+            i = j;
+          }
+        }
+
+      }
+      stopTimer();
+
+      deallocData(sorted_bins, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HISTOGRAM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == RAJA_OpenMP) {
+
+    if (tune_idx == t) {
+      runOpenMPVariantBuiltinAtomic(vid);
+    }
+
+    t += 1;
+
+  }
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+      runOpenMPVariantAtomicRelaxed(vid);
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+      runOpenMPVariantPrivatized(vid);
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+      runOpenMPVariantSortReduce(vid);
+    }
+
+    t += 1;
+
+  }
+}
+
+void HISTOGRAM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == RAJA_OpenMP) {
+
+    addVariantTuningName(vid, "builtin_atomic");
+
+  }
+
+  if (vid == Base_OpenMP) {
+
+    addVariantTuningName(vid, "atomic_relaxed");
+
+    addVariantTuningName(vid, "privatized");
+
+    addVariantTuningName(vid, "sort_reduce");
+
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
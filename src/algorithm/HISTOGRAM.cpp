@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HISTOGRAM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+HISTOGRAM::HISTOGRAM(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_HISTOGRAM, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_num_bins = (params.getHistogramNumBins() > 0) ? params.getHistogramNumBins()
+                                                  : 1024;
+  m_distribution = params.getHistogramDistribution();
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Int_type) + 1*sizeof(Int_type)) * m_num_bins +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  checksum_scale_factor = 1.0 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+HISTOGRAM::~HISTOGRAM()
+{
+}
+
+//
+// Bin indices are drawn with the same seed for every run.
+//
+void HISTOGRAM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = getActualProblemSize();
+
+  allocData(m_bins, len, vid);
+  allocData(m_counts, m_num_bins, vid);
+
+  srand(4793);
+
+  if ( m_distribution == "zipf" ) {
+
+    std::vector<Real_type> cdf(m_num_bins);
+    Real_type sum = 0.0;
+    for (Index_type b = 0; b < m_num_bins; ++b) {
+      sum += 1.0 / static_cast<Real_type>(b + 1);
+      cdf[b] = sum;
+    }
+    for (Index_type i = 0; i < len; ++i) {
+      const Real_type u = sum * (static_cast<Real_type>(rand()) / (RAND_MAX + 1.0));
+      const Index_type b = std::upper_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+      m_bins[i] = static_cast<Int_type>(std::min(b, m_num_bins - 1));
+    }
+
+  } else if ( m_distribution == "clustered" ) {
+
+    const Index_type cluster_len = 64;
+    const Index_type cluster_width = 16;
+    Index_type base = 0;
+    for (Index_type i = 0; i < len; ++i) {
+      if (i % cluster_len == 0) {
+        base = rand() % m_num_bins;
+      }
+      m_bins[i] = static_cast<Int_type>((base + rand() % cluster_width) % m_num_bins);
+    }
+
+  } else {
+
+    for (Index_type i = 0; i < len; ++i) {
+      m_bins[i] = static_cast<Int_type>(rand() % m_num_bins);
+    }
+
+  }
+
+  for (Index_type b = 0; b < m_num_bins; ++b) {
+    m_counts[b] = 0;
+  }
+}
+
+void HISTOGRAM::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_counts, m_num_bins, checksum_scale_factor , vid);
+}
+
+void HISTOGRAM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_bins, vid);
+  deallocData(m_counts, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
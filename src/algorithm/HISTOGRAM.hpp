@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// HISTOGRAM kernel reference implementation:
+///
+/// for (Index_type b = 0; b < num_bins; ++b ) {
+///   counts[b] = 0;
+/// }
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   counts[bins[i]] += 1;
+/// }
+///
+/// The number of bins and the distribution of the bin indices are set by
+/// the --histogram_num_bins and --histogram_distribution options:
+///
+///   uniform    each index is equally likely to be any bin
+///   zipf       bin b is chosen with probability proportional to 1/(b+1)
+///   clustered  runs of 64 consecutive indices fall in a window of 16
+///              bins at a random position
+///
+/// Fewer bins and the zipf and clustered distributions make the adds to
+/// the same bin from different threads more frequent.
+///
+/// The parallel tunings resolve those conflicts in different ways,
+///
+///   default         '#pragma omp atomic' (Base) or RAJA::omp_atomic (RAJA)
+///   builtin_atomic  RAJA::builtin_atomic (RAJA)
+///   atomic_relaxed  relaxed atomic add with std::atomic_ref when available,
+///                   else the equivalent compiler builtin (Base)
+///   privatized      per-thread histograms summed at the end (Base)
+///   sort_reduce     each thread sorts its indices and adds each run of
+///                   equal indices with one atomic (Base)
+///
+/// Counts are integers, so every tuning gives the same checksum.
+///
+
+#ifndef RAJAPerf_Algorithm_HISTOGRAM_HPP
+#define RAJAPerf_Algorithm_HISTOGRAM_HPP
+
+#define HISTOGRAM_DATA_SETUP \
+  Int_ptr bins = m_bins; \
+  Int_ptr counts = m_counts; \
+  const Index_type num_bins = m_num_bins;
+
+#define HISTOGRAM_INIT \
+  counts[b] = 0;
+
+#define HISTOGRAM_BODY \
+  counts[bins[i]] += 1;
+
+#define HISTOGRAM_RAJA_BODY(atomic_policy) \
+  RAJA::atomicAdd<atomic_policy>(&counts[bins[i]], Int_type(1));
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class HISTOGRAM : public KernelBase
+{
+public:
+
+  HISTOGRAM(const RunParams& params);
+
+  ~HISTOGRAM();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HISTOGRAM : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HISTOGRAM : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HISTOGRAM : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBuiltinAtomic(VariantID vid);
+  void runOpenMPVariantAtomicRelaxed(VariantID vid);
+  void runOpenMPVariantPrivatized(VariantID vid);
+  void runOpenMPVariantSortReduce(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Index_type m_num_bins;
+  std::string m_distribution;
+
+  Int_ptr m_bins;
+  Int_ptr m_counts;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
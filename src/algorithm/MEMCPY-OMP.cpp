@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/NontemporalStoreUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace algorithm
 {
 
 
-void MEMCPY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void MEMCPY::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -94,5 +96,139 @@ void MEMCPY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 #endif
 }
 
+void MEMCPY::runOpenMPVariantNontemporalSimd(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MEMCPY_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_OMP_PARALLEL_FOR_SIMD_NONTEMPORAL(y)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          MEMCPY_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMCPY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+#if defined(RAJAPERF_USE_NONTEMPORAL_INTRINSICS)
+void MEMCPY::runOpenMPVariantNontemporalIntrinsics(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MEMCPY_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const Index_type nthreads = omp_get_num_threads();
+          const Index_type tid = omp_get_thread_num();
+          const Index_type len = iend - ibegin;
+          const Index_type cbegin = ibegin + (len * tid) / nthreads;
+          const Index_type cend = ibegin + (len * (tid + 1)) / nthreads;
+
+          nontemporalStore(y, cbegin, cend, [=](Index_type i) {
+            return x[i];
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMCPY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+#endif
+
+void MEMCPY::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+      runOpenMPVariantNontemporalSimd(vid);
+    }
+
+    t += 1;
+
+#if defined(RAJAPERF_USE_NONTEMPORAL_INTRINSICS)
+    if (tune_idx == t) {
+      runOpenMPVariantNontemporalIntrinsics(vid);
+    }
+
+    t += 1;
+#endif
+
+  }
+}
+
+void MEMCPY::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    addVariantTuningName(vid, "nontemporal_simd");
+
+#if defined(RAJAPERF_USE_NONTEMPORAL_INTRINSICS)
+    addVariantTuningName(vid, "nontemporal_intrinsics");
+#endif
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/NontemporalStoreUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -136,6 +138,75 @@ void MEMCPY::runSeqVariantDefault(VariantID vid)
 
 }
 
+void MEMCPY::runSeqVariantNontemporalSimd(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MEMCPY_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_OMP_SIMD_NONTEMPORAL(y)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          MEMCPY_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMCPY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+#if defined(RAJAPERF_USE_NONTEMPORAL_INTRINSICS)
+void MEMCPY::runSeqVariantNontemporalIntrinsics(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MEMCPY_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        nontemporalStore(y, ibegin, iend, [=](Index_type i) {
+          return x[i];
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMCPY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+#endif
+
 void MEMCPY::runSeqVariant(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
@@ -159,6 +230,24 @@ void MEMCPY::runSeqVariant(VariantID vid, size_t tune_idx)
   }
 
   t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+      runSeqVariantNontemporalSimd(vid);
+    }
+
+    t += 1;
+
+#if defined(RAJAPERF_USE_NONTEMPORAL_INTRINSICS)
+    if (tune_idx == t) {
+      runSeqVariantNontemporalIntrinsics(vid);
+    }
+
+    t += 1;
+#endif
+
+  }
 }
 
 void MEMCPY::setSeqTuningDefinitions(VariantID vid)
@@ -168,6 +257,16 @@ void MEMCPY::setSeqTuningDefinitions(VariantID vid)
   }
 
   addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    addVariantTuningName(vid, "nontemporal_simd");
+
+#if defined(RAJAPERF_USE_NONTEMPORAL_INTRINSICS)
+    addVariantTuningName(vid, "nontemporal_intrinsics");
+#endif
+
+  }
 }
 
 } // end namespace algorithm
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/NontemporalStoreUtils.hpp"
+
 #include <cstring>
 #include <iostream>
 
@@ -137,6 +139,75 @@ void MEMSET::runSeqVariantDefault(VariantID vid)
 
 }
 
+void MEMSET::runSeqVariantNontemporalSimd(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MEMSET_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_OMP_SIMD_NONTEMPORAL(x)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          MEMSET_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMSET : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+#if defined(RAJAPERF_USE_NONTEMPORAL_INTRINSICS)
+void MEMSET::runSeqVariantNontemporalIntrinsics(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MEMSET_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        nontemporalStore(x, ibegin, iend, [=](Index_type) {
+          return val;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMSET : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+#endif
+
 void MEMSET::runSeqVariant(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
@@ -160,6 +231,24 @@ void MEMSET::runSeqVariant(VariantID vid, size_t tune_idx)
   }
 
   t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+      runSeqVariantNontemporalSimd(vid);
+    }
+
+    t += 1;
+
+#if defined(RAJAPERF_USE_NONTEMPORAL_INTRINSICS)
+    if (tune_idx == t) {
+      runSeqVariantNontemporalIntrinsics(vid);
+    }
+
+    t += 1;
+#endif
+
+  }
 }
 
 void MEMSET::setSeqTuningDefinitions(VariantID vid)
@@ -169,6 +258,16 @@ void MEMSET::setSeqTuningDefinitions(VariantID vid)
   }
 
   addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    addVariantTuningName(vid, "nontemporal_simd");
+
+#if defined(RAJAPERF_USE_NONTEMPORAL_INTRINSICS)
+    addVariantTuningName(vid, "nontemporal_intrinsics");
+#endif
+
+  }
 }
 
 } // end namespace algorithm
@@ -13,6 +13,9 @@
 ///   x[i] = val ;
 /// }
 ///
+/// The nontemporal tunings write x with streaming stores, which skip
+/// reading its cache lines first (see common/NontemporalStoreUtils.hpp).
+///
 
 #ifndef RAJAPerf_Algorithm_MEMSET_HPP
 #define RAJAPerf_Algorithm_MEMSET_HPP
@@ -56,10 +59,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
   void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   void runSeqVariantDefault(VariantID vid);
   void runSeqVariantLibrary(VariantID vid);
+  void runSeqVariantNontemporalSimd(VariantID vid);
+  void runSeqVariantNontemporalIntrinsics(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantNontemporalSimd(VariantID vid);
+  void runOpenMPVariantNontemporalIntrinsics(VariantID vid);
 
   template < size_t block_size >
   void runCudaVariantBlock(VariantID vid);
@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POINTER_CHASE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+//
+// Each thread walks its own chain through an equal part of the cycle, so
+// there are as many loads in flight as threads.
+//
+void POINTER_CHASE::runOpenMPVariantImpl(VariantID vid, Index_ptr next)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type len = getActualProblemSize();
+
+  Index_ptr order = m_order;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type sum = 0;
+
+        #pragma omp parallel reduction(+:sum)
+        {
+          const Index_type nthreads = omp_get_num_threads();
+          const Index_type tid = omp_get_thread_num();
+          const Index_type kbegin = (len * tid) / nthreads;
+          const Index_type kend = (len * (tid + 1)) / nthreads;
+
+          if (kbegin < kend) {
+            Index_type p = order[kbegin];
+            for (Index_type i = kbegin; i < kend; ++i ) {
+              POINTER_CHASE_BODY;
+            }
+          }
+        }
+
+        m_sum = sum;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POINTER_CHASE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(next);
+#endif
+}
+
+void POINTER_CHASE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl(vid, m_next);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      Index_ptr next = allocHugePageChain(vid);
+
+      runOpenMPVariantImpl(vid, next);
+
+      deallocHugePageChain(next, vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void POINTER_CHASE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    addVariantTuningName(vid, "huge_pages");
+
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POINTER_CHASE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void POINTER_CHASE::runSeqVariantImpl(VariantID vid, Index_ptr next)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type len = getActualProblemSize();
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type p = 0;
+        Index_type sum = 0;
+        for (Index_type i = 0; i < len; ++i ) {
+          POINTER_CHASE_BODY;
+        }
+        m_sum = sum;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POINTER_CHASE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+//
+// Chain c starts at position c * chain_len of the cycle, so its j-th node
+// is at position c * chain_len + j. The last chain also walks the positions
+// left over at the end of the cycle.
+//
+template < size_t num_chains >
+void POINTER_CHASE::runSeqVariantMultiChain(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type len = getActualProblemSize();
+
+  POINTER_CHASE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      const Index_type chain_len = len / num_chains;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type ptrs[num_chains];
+        for (size_t c = 0; c < num_chains; ++c) {
+          ptrs[c] = order[c * chain_len];
+        }
+
+        Index_type sum = 0;
+        for (Index_type j = 0; j < chain_len; ++j ) {
+          for (size_t c = 0; c < num_chains; ++c) {
+            Index_type& p = ptrs[c];
+            const Index_type i = c * chain_len + j;
+            POINTER_CHASE_BODY;
+          }
+        }
+
+        Index_type& p = ptrs[num_chains - 1];
+        for (Index_type i = num_chains * chain_len; i < len; ++i ) {
+          POINTER_CHASE_BODY;
+        }
+        m_sum = sum;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POINTER_CHASE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POINTER_CHASE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl(vid, m_next);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      Index_ptr next = allocHugePageChain(vid);
+
+      runSeqVariantImpl(vid, next);
+
+      deallocHugePageChain(next, vid);
+
+    }
+
+    t += 1;
+
+    seq_for(num_chains_type{}, [&](auto num_chains) {
+      if (tune_idx == t) {
+        runSeqVariantMultiChain<num_chains>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void POINTER_CHASE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    addVariantTuningName(vid, "huge_pages");
+
+    seq_for(num_chains_type{}, [&](auto num_chains) {
+      addVariantTuningName(vid, "multi_chain_"+std::to_string(num_chains));
+    });
+
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
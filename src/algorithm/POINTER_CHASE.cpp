@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POINTER_CHASE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <cstdlib>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+POINTER_CHASE::POINTER_CHASE(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_POINTER_CHASE, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(10);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Index_type) + 1*sizeof(Index_type)) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+}
+
+POINTER_CHASE::~POINTER_CHASE()
+{
+}
+
+//
+// order is a random permutation of the nodes starting at node 0, and
+// next links each node to the one after it in order, closing the cycle.
+// The nodes are shuffled with the same seed for every run.
+//
+void POINTER_CHASE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = getActualProblemSize();
+
+  allocData(m_next, len, vid);
+  allocData(m_order, len, vid);
+
+  for (Index_type k = 0; k < len; ++k) {
+    m_order[k] = k;
+  }
+
+  srand(4793);
+  for (Index_type k = len - 1; k > 1; --k) {
+    const Index_type j = 1 + rand() % k;
+    std::swap(m_order[k], m_order[j]);
+  }
+
+  for (Index_type k = 0; k < len; ++k) {
+    m_next[m_order[k]] = m_order[(k + 1) % len];
+  }
+
+  m_sum = 0;
+}
+
+void POINTER_CHASE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += Checksum_type(m_sum);
+}
+
+void POINTER_CHASE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_next, vid);
+  deallocData(m_order, vid);
+}
+
+//
+// Copy next into memory aligned to huge pages, and ask the system to back
+// it with huge pages before it is first touched.
+//
+Index_ptr POINTER_CHASE::allocHugePageChain(VariantID vid)
+{
+  const Index_type len = getActualProblemSize();
+  const Size_type nbytes =
+      ((len * sizeof(Index_type) + huge_page_size - 1) / huge_page_size) *
+      huge_page_size;
+
+  void* ptr = detail::allocData(getDataSpace(vid), nbytes, huge_page_size);
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  madvise(ptr, nbytes, MADV_HUGEPAGE);
+#endif
+
+  Index_ptr next = static_cast<Index_ptr>(ptr);
+  for (Index_type i = 0; i < len; ++i) {
+    next[i] = m_next[i];
+  }
+
+  return next;
+}
+
+void POINTER_CHASE::deallocHugePageChain(Index_ptr& next, VariantID vid)
+{
+  deallocData(getDataSpace(vid), next);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POINTER_CHASE kernel reference implementation:
+///
+/// Index_type p = 0;
+/// Index_type sum = 0;
+/// for (Index_type i = 0; i < len; ++i ) {
+///   sum += p ^ i;
+///   p = next[p];
+/// }
+///
+/// next holds one random cycle through all len nodes, so each load depends
+/// on the previous one and the time per iteration is the load to use
+/// latency of the memory level that holds the len * sizeof(Index_type)
+/// bytes of next. Running with a range of problem sizes sweeps the working
+/// set from the L1 cache to main memory; the "-timeperiter" reports give
+/// the latency per access.
+///
+/// Tunings,
+///
+///   default          one chain (Base_Seq), one chain per thread, each
+///                    walking an equal part of the cycle (Base_OpenMP)
+///   huge_pages       as default with next in memory aligned to, and
+///                    advised to use, 2MB huge pages where the system
+///                    supports them, which removes most TLB misses
+///   multi_chain_<k>  k chains walking equal parts of the cycle, advanced
+///                    in turn in one thread, so k loads are in flight
+///                    (Base_Seq)
+///
+/// The sum combines each node with its position i in the cycle, so it
+/// checks the order in which nodes are visited. Every tuning visits each
+/// node once per rep at the same position, so every tuning gives the same
+/// sum.
+///
+
+#ifndef RAJAPerf_Algorithm_POINTER_CHASE_HPP
+#define RAJAPerf_Algorithm_POINTER_CHASE_HPP
+
+#define POINTER_CHASE_DATA_SETUP \
+  Index_ptr next = m_next; \
+  Index_ptr order = m_order;
+
+#define POINTER_CHASE_BODY \
+  sum += p ^ i; \
+  p = next[p];
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class POINTER_CHASE : public KernelBase
+{
+public:
+
+  POINTER_CHASE(const RunParams& params);
+
+  ~POINTER_CHASE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POINTER_CHASE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POINTER_CHASE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POINTER_CHASE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantImpl(VariantID vid, Index_ptr next);
+  template < size_t num_chains >
+  void runSeqVariantMultiChain(VariantID vid);
+  void runOpenMPVariantImpl(VariantID vid, Index_ptr next);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+  using num_chains_type = integer::list_type<2, 4, 8>;
+
+  static const Size_type huge_page_size = 2*1024*1024;
+
+  Index_ptr allocHugePageChain(VariantID vid);
+  void deallocHugePageChain(Index_ptr& next, VariantID vid);
+
+  Index_ptr m_next;
+  Index_ptr m_order;
+  Index_type m_sum;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/ReproducibleSumUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace algorithm
 {
 
 
-void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_SUM::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -106,5 +108,91 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 #endif
 }
 
+template < typename sum_helper >
+void REDUCE_SUM::runOpenMPVariantReproducible(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_SUM_DATA_SETUP;
+
+  auto reducesum_term_lam = [=](Index_type i) {
+    return x[i];
+  };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      Real_ptr work;
+      allocData(work, sum_helper::workspaceSize(iend - ibegin), vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sum = sum_helper::sumOpenMP(ibegin, iend,
+                                              reducesum_term_lam, work);
+
+        m_sum = m_sum_init + sum;
+
+      }
+      stopTimer();
+
+      deallocData(work, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_SUM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(reproducible_sum_helpers{}, [&](auto sum_helper) {
+      if (tune_idx == t) {
+        runOpenMPVariantReproducible<decltype(sum_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void REDUCE_SUM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(reproducible_sum_helpers{}, [&](auto sum_helper) {
+      addVariantTuningName(vid, decltype(sum_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/ReproducibleSumUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace algorithm
 {
 
 
-void REDUCE_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_SUM::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -100,5 +102,85 @@ void REDUCE_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
 
 }
 
+template < typename sum_helper >
+void REDUCE_SUM::runSeqVariantReproducible(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_SUM_DATA_SETUP;
+
+  auto reducesum_term_lam = [=](Index_type i) {
+    return x[i];
+  };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      Real_ptr work;
+      allocData(work, sum_helper::workspaceSize(iend - ibegin), vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sum = sum_helper::sumSeq(ibegin, iend,
+                                           reducesum_term_lam, work);
+
+        m_sum = m_sum_init + sum;
+
+      }
+      stopTimer();
+
+      deallocData(work, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_SUM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void REDUCE_SUM::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    seq_for(reproducible_sum_helpers{}, [&](auto sum_helper) {
+      if (tune_idx == t) {
+        runSeqVariantReproducible<decltype(sum_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void REDUCE_SUM::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    seq_for(reproducible_sum_helpers{}, [&](auto sum_helper) {
+      addVariantTuningName(vid, decltype(sum_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
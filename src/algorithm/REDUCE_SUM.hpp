@@ -18,6 +18,9 @@
 ///   sum += x[i] ;
 /// }
 ///
+/// The "pairwise" and "binned" tunings compute the sum so its bits do not
+/// depend on the number of threads (see common/ReproducibleSumUtils.hpp).
+///
 
 #ifndef RAJAPerf_Algorithm_REDUCE_SUM_HPP
 #define RAJAPerf_Algorithm_REDUCE_SUM_HPP
@@ -59,6 +62,15 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename sum_helper >
+  void runSeqVariantReproducible(VariantID vid);
+  template < typename sum_helper >
+  void runOpenMPVariantReproducible(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   void runCudaVariantCub(VariantID vid);
@@ -82,6 +82,26 @@ void setRealZones_3d(Index_type* real_zones,
   }
 }
 
+//
+// Reorder zone indices along space-filling curve.
+//
+void reorderZones(Index_type* zones, Index_type num_zones,
+                  const ADomain& domain, SFCOrdering ordering)
+{
+  sortBySFC(zones, num_zones, domain.jp, domain.kp, ordering);
+}
+
+//
+// Copy zone indices into a list of 32-bit indices.
+//
+void copyZonesToInt(Int_type* zones32, const Index_type* zones,
+                    Index_type num_zones)
+{
+  for (Index_type iz = 0; iz < num_zones; ++iz) {
+    zones32[iz] = static_cast<Int_type>(zones[iz]);
+  }
+}
+
 //
 // Set mesh positions for 2d mesh.
 //
@@ -10,6 +10,7 @@
 #define RAJAPerf_AppsData_HPP
 
 #include "common/RPTypes.hpp"
+#include "common/SpaceFillingCurve.hpp"
 
 namespace rajaperf
 {
@@ -123,6 +124,20 @@ void setRealZones_2d(Index_type* real_zones,
 void setRealZones_3d(Index_type* real_zones,
                      const ADomain& domain);
 
+//
+// Routine for reordering zone indices of a 2d/3d domain along a
+// space-filling curve; lexicographic ordering leaves zones unchanged.
+//
+void reorderZones(Index_type* zones, Index_type num_zones,
+                  const ADomain& domain, SFCOrdering ordering);
+
+//
+// Routine for copying zone indices into a list of 32-bit indices, used by
+// the "index32" tunings of kernels that read real zone lists.
+//
+void copyZonesToInt(Int_type* zones32, const Index_type* zones,
+                    Index_type num_zones);
+
 //
 // Routines for initializing mesh positions for 2d/3d domains.
 //
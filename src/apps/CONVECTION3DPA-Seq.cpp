@@ -15,7 +15,7 @@
 namespace rajaperf {
 namespace apps {
 
-void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+void CONVECTION3DPA::runSeqVariantDefault(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
   CONVECTION3DPA_DATA_SETUP;
@@ -312,5 +312,81 @@ void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
   }
 }
 
+template < size_t W >
+void CONVECTION3DPA::runSeqVariantSimd(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  CONVECTION3DPA_DATA_SETUP;
+
+  const Index_type nbatches = getNumElementBatches(NE, W);
+  const Index_type x_size = CPA_D1D*CPA_D1D*CPA_D1D;
+  const Index_type d_size = CPA_Q1D*CPA_Q1D*CPA_Q1D*CPA_VDIM;
+
+  Real_ptr Xs;
+  Real_ptr Ds;
+  Real_ptr Ys;
+  allocData(Xs, nbatches*W*x_size, vid);
+  allocData(Ds, nbatches*W*d_size, vid);
+  allocData(Ys, nbatches*W*x_size, vid);
+
+  interleaveElements(Xs, X, x_size, NE, W);
+  interleaveElements(Ds, D, d_size, NE, W);
+  interleaveElements(Ys, Y, x_size, NE, W);
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    for (Index_type eb = 0; eb < nbatches; ++eb) {
+      CONVECTION3DPA_SIMD_BODY(W)
+    }
+
+  }
+  stopTimer();
+
+  deinterleaveElements(Y, Ys, x_size, NE, W);
+
+  deallocData(Xs, vid);
+  deallocData(Ds, vid);
+  deallocData(Ys, vid);
+}
+
+void CONVECTION3DPA::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    seq_for(fem_simd_widths_type{}, [&](auto W) {
+      if (tune_idx == t) {
+        runSeqVariantSimd<W>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void CONVECTION3DPA::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    seq_for(fem_simd_widths_type{}, [&](auto W) {
+      addVariantTuningName(vid, "simd_"+std::to_string(W));
+    });
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -190,6 +190,10 @@
 ///   }
 /// } // element loop
 ///
+/// The Base_Seq and Base_OpenMP variants have "simd_4" and "simd_8"
+/// tunings that apply the operator to batches of 4 or 8 elements, one per
+/// SIMD lane, in an element interleaved copy of the data (FEM_SIMD.hpp).
+///
 
 #ifndef RAJAPerf_Apps_CONVECTION3DPA_HPP
 #define RAJAPerf_Apps_CONVECTION3DPA_HPP
@@ -205,6 +209,7 @@ Index_type NE = m_NE;
 
 #include "common/KernelBase.hpp"
 #include "FEM_MACROS.hpp"
+#include "FEM_SIMD.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -354,6 +359,131 @@ Index_type NE = m_NE;
   } \
   cpaY_(dx,dy,dz,e) += BBBDGu;
 
+//
+// Body for the batch eb of W elements of the "simd_<W>" tunings, with
+// the element data in the element interleaved arrays Xs, Ds and Ys.
+//
+#define CONVECTION3DPA_SIMD_BODY(W)                                                 \
+  constexpr int max_D1D = CPA_D1D;                                                  \
+  constexpr int max_Q1D = CPA_Q1D;                                                  \
+  double Bu[max_D1D][max_D1D][max_Q1D][W], Gu[max_D1D][max_D1D][max_Q1D][W];        \
+  double BBu[max_D1D][max_Q1D][max_Q1D][W], GBu[max_D1D][max_Q1D][max_Q1D][W];      \
+  double BGu[max_D1D][max_Q1D][max_Q1D][W];                                         \
+  double DGu[max_Q1D][max_Q1D][max_Q1D][W];                                         \
+  double BDGu[max_D1D][max_Q1D][max_Q1D][W];                                        \
+  double BBDGu[max_D1D][max_D1D][max_Q1D][W];                                       \
+  Real_ptr Xb = Xs + eb * max_D1D * max_D1D * max_D1D * W;                          \
+  Real_ptr Yb = Ys + eb * max_D1D * max_D1D * max_D1D * W;                          \
+  Real_ptr Db = Ds + eb * CPA_VDIM * max_Q1D * max_Q1D * max_Q1D * W;               \
+  CPU_FOREACH(dz, z, CPA_D1D) {                                                     \
+    CPU_FOREACH(dy, y, CPA_D1D) {                                                   \
+      CPU_FOREACH(qx, x, CPA_Q1D) {                                                 \
+        double Bu_[W], Gu_[W];                                                      \
+        FEM_SIMD_LANES(l, W) { Bu_[l] = 0.0; Gu_[l] = 0.0; }                        \
+        for (int dx = 0; dx < CPA_D1D; ++dx) {                                      \
+          const double bx = cpa_B(qx,dx);                                           \
+          const double gx = cpa_G(qx,dx);                                           \
+          Real_ptr Xd = Xb + (dx + CPA_D1D * (dy + CPA_D1D * dz)) * W;              \
+          FEM_SIMD_LANES(l, W) {                                                    \
+            Bu_[l] += bx * Xd[l];                                                   \
+            Gu_[l] += gx * Xd[l];                                                   \
+          }                                                                         \
+        }                                                                           \
+        FEM_SIMD_LANES(l, W) {                                                      \
+          Bu[dz][dy][qx][l] = Bu_[l];                                               \
+          Gu[dz][dy][qx][l] = Gu_[l];                                               \
+        }                                                                           \
+      }                                                                             \
+    }                                                                               \
+  }                                                                                 \
+  CPU_FOREACH(dz, z, CPA_D1D) {                                                     \
+    CPU_FOREACH(qx, x, CPA_Q1D) {                                                   \
+      CPU_FOREACH(qy, y, CPA_Q1D) {                                                 \
+        double BBu_[W], GBu_[W], BGu_[W];                                           \
+        FEM_SIMD_LANES(l, W) { BBu_[l] = 0.0; GBu_[l] = 0.0; BGu_[l] = 0.0; }       \
+        for (int dy = 0; dy < CPA_D1D; ++dy) {                                      \
+          const double bx = cpa_B(qy,dy);                                           \
+          const double gx = cpa_G(qy,dy);                                           \
+          FEM_SIMD_LANES(l, W) {                                                    \
+            BBu_[l] += bx * Bu[dz][dy][qx][l];                                      \
+            GBu_[l] += gx * Bu[dz][dy][qx][l];                                      \
+            BGu_[l] += bx * Gu[dz][dy][qx][l];                                      \
+          }                                                                         \
+        }                                                                           \
+        FEM_SIMD_LANES(l, W) {                                                      \
+          BBu[dz][qy][qx][l] = BBu_[l];                                             \
+          GBu[dz][qy][qx][l] = GBu_[l];                                             \
+          BGu[dz][qy][qx][l] = BGu_[l];                                             \
+        }                                                                           \
+      }                                                                             \
+    }                                                                               \
+  }                                                                                 \
+  CPU_FOREACH(qx, x, CPA_Q1D) {                                                     \
+    CPU_FOREACH(qy, y, CPA_Q1D) {                                                   \
+      CPU_FOREACH(qz, z, CPA_Q1D) {                                                 \
+        double GBBu_[W], BGBu_[W], BBGu_[W];                                        \
+        FEM_SIMD_LANES(l, W) { GBBu_[l] = 0.0; BGBu_[l] = 0.0; BBGu_[l] = 0.0; }    \
+        for (int dz = 0; dz < CPA_D1D; ++dz) {                                      \
+          const double bx = cpa_B(qz,dz);                                           \
+          const double gx = cpa_G(qz,dz);                                           \
+          FEM_SIMD_LANES(l, W) {                                                    \
+            GBBu_[l] += gx * BBu[dz][qy][qx][l];                                    \
+            BGBu_[l] += bx * GBu[dz][qy][qx][l];                                    \
+            BBGu_[l] += bx * BGu[dz][qy][qx][l];                                    \
+          }                                                                         \
+        }                                                                           \
+        const int q = qx + CPA_Q1D * (qy + CPA_Q1D * qz);                           \
+        const int Q3 = CPA_Q1D * CPA_Q1D * CPA_Q1D;                                 \
+        FEM_SIMD_LANES(l, W) {                                                      \
+          const double O1 = Db[(q + Q3*0)*W + l];                                   \
+          const double O2 = Db[(q + Q3*1)*W + l];                                   \
+          const double O3 = Db[(q + Q3*2)*W + l];                                   \
+          DGu[qz][qy][qx][l] = (O1 * BBGu_[l]) + (O2 * BGBu_[l]) + (O3 * GBBu_[l]); \
+        }                                                                           \
+      }                                                                             \
+    }                                                                               \
+  }                                                                                 \
+  CPU_FOREACH(qx, x, CPA_Q1D) {                                                     \
+    CPU_FOREACH(qy, y, CPA_Q1D) {                                                   \
+      CPU_FOREACH(dz, z, CPA_D1D) {                                                 \
+        double BDGu_[W];                                                            \
+        FEM_SIMD_LANES(l, W) { BDGu_[l] = 0.0; }                                    \
+        for (int qz = 0; qz < CPA_Q1D; ++qz) {                                      \
+          const double wt = cpa_Bt(dz,qz);                                          \
+          FEM_SIMD_LANES(l, W) { BDGu_[l] += wt * DGu[qz][qy][qx][l]; }             \
+        }                                                                           \
+        FEM_SIMD_LANES(l, W) { BDGu[dz][qy][qx][l] = BDGu_[l]; }                    \
+      }                                                                             \
+    }                                                                               \
+  }                                                                                 \
+  CPU_FOREACH(dz, z, CPA_D1D) {                                                     \
+    CPU_FOREACH(qx, x, CPA_Q1D) {                                                   \
+      CPU_FOREACH(dy, y, CPA_D1D) {                                                 \
+        double BBDGu_[W];                                                           \
+        FEM_SIMD_LANES(l, W) { BBDGu_[l] = 0.0; }                                   \
+        for (int qy = 0; qy < CPA_Q1D; ++qy) {                                      \
+          const double wt = cpa_Bt(dy,qy);                                          \
+          FEM_SIMD_LANES(l, W) { BBDGu_[l] += wt * BDGu[dz][qy][qx][l]; }           \
+        }                                                                           \
+        FEM_SIMD_LANES(l, W) { BBDGu[dz][dy][qx][l] = BBDGu_[l]; }                  \
+      }                                                                             \
+    }                                                                               \
+  }                                                                                 \
+  CPU_FOREACH(dz, z, CPA_D1D) {                                                     \
+    CPU_FOREACH(dy, y, CPA_D1D) {                                                   \
+      CPU_FOREACH(dx, x, CPA_D1D) {                                                 \
+        double BBBDGu[W];                                                           \
+        FEM_SIMD_LANES(l, W) { BBBDGu[l] = 0.0; }                                   \
+        for (int qx = 0; qx < CPA_Q1D; ++qx) {                                      \
+          const double wt = cpa_Bt(dx,qx);                                          \
+          FEM_SIMD_LANES(l, W) { BBBDGu[l] += wt * BBDGu[dz][dy][qx][l]; }          \
+        }                                                                           \
+        Real_ptr Yd = Yb + (dx + CPA_D1D * (dy + CPA_D1D * dz)) * W;                \
+        FEM_SIMD_LANES(l, W) { Yd[l] += BBBDGu[l]; }                                \
+      }                                                                             \
+    }                                                                               \
+  }
+
 namespace rajaperf
 {
 class RunParams;
@@ -379,8 +509,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t W >
+  void runSeqVariantSimd(VariantID vid);
+  template < size_t W >
+  void runOpenMPVariantSimd(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -22,7 +22,8 @@ namespace apps
 {
 
 
-void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename ZoneIndex_type >
+void DEL_DOT_VEC_2D::runOpenMPVariantImpl(VariantID vid, ZoneIndex_type* zone_list)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -30,7 +31,7 @@ void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
 
-  DEL_DOT_VEC_2D_DATA_SETUP;
+  DEL_DOT_VEC_2D_DATA_SETUP_ZONES(zone_list);
 
   switch ( vid ) {
 
@@ -75,8 +76,8 @@ void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
     case RAJA_OpenMP : {
 
       camp::resources::Resource working_res{camp::resources::Host::get_default()};
-      RAJA::TypedListSegment<Index_type> zones(real_zones, iend,
-                                               working_res, RAJA::Unowned);
+      RAJA::TypedListSegment<ZoneIndex_type> zones(real_zones, iend,
+                                                   working_res, RAJA::Unowned);
 
       auto deldotvec2d_lam = [=](Index_type i) {
                                DEL_DOT_VEC_2D_BODY;
@@ -101,8 +102,52 @@ void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(zone_list);
 #endif
 }
 
+void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  for (int io = 0; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantImpl(vid, m_real_zones);
+
+    }
+
+    t += 1;
+
+  }
+
+  if (tune_idx == t) {
+
+    const Index_type num_zones = m_domain->n_real_zones;
+
+    Int_ptr real_zones32;
+    allocData(real_zones32, num_zones, vid);
+    copyZonesToInt(real_zones32, m_real_zones, num_zones);
+
+    runOpenMPVariantImpl(vid, real_zones32);
+
+    deallocData(real_zones32, vid);
+
+  }
+}
+
+void DEL_DOT_VEC_2D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (int io = 0; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+    addVariantTuningName(vid, getSFCOrderingName(static_cast<SFCOrdering>(io)));
+  }
+
+  addVariantTuningName(vid, "index32");
+  setVariantTuningBytesPerRep(vid, getNumVariantTunings(vid) - 1,
+      getBytesPerRep() - 1*sizeof(Index_type) * getItsPerRep() +
+                         1*sizeof(Int_type)   * getItsPerRep());
+}
+
 } // end namespace apps
 } // end namespace rajaperf
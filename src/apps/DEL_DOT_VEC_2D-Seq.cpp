@@ -22,13 +22,14 @@ namespace apps
 {
 
 
-void DEL_DOT_VEC_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename ZoneIndex_type >
+void DEL_DOT_VEC_2D::runSeqVariantImpl(VariantID vid, ZoneIndex_type* zone_list)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
 
-  DEL_DOT_VEC_2D_DATA_SETUP;
+  DEL_DOT_VEC_2D_DATA_SETUP_ZONES(zone_list);
 
   switch ( vid ) {
 
@@ -72,8 +73,8 @@ void DEL_DOT_VEC_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
     case RAJA_Seq : {
 
       camp::resources::Resource working_res{camp::resources::Host::get_default()};
-      RAJA::TypedListSegment<Index_type> zones(real_zones, iend,
-                                               working_res, RAJA::Unowned);
+      RAJA::TypedListSegment<ZoneIndex_type> zones(real_zones, iend,
+                                                   working_res, RAJA::Unowned);
 
       auto deldotvec2d_lam = [=](Index_type i) {
                                DEL_DOT_VEC_2D_BODY;
@@ -99,5 +100,48 @@ void DEL_DOT_VEC_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
 }
 
+void DEL_DOT_VEC_2D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  for (int io = 0; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantImpl(vid, m_real_zones);
+
+    }
+
+    t += 1;
+
+  }
+
+  if (tune_idx == t) {
+
+    const Index_type num_zones = m_domain->n_real_zones;
+
+    Int_ptr real_zones32;
+    allocData(real_zones32, num_zones, vid);
+    copyZonesToInt(real_zones32, m_real_zones, num_zones);
+
+    runSeqVariantImpl(vid, real_zones32);
+
+    deallocData(real_zones32, vid);
+
+  }
+}
+
+void DEL_DOT_VEC_2D::setSeqTuningDefinitions(VariantID vid)
+{
+  for (int io = 0; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+    addVariantTuningName(vid, getSFCOrderingName(static_cast<SFCOrdering>(io)));
+  }
+
+  addVariantTuningName(vid, "index32");
+  setVariantTuningBytesPerRep(vid, getNumVariantTunings(vid) - 1,
+      getBytesPerRep() - 1*sizeof(Index_type) * getItsPerRep() +
+                         1*sizeof(Int_type)   * getItsPerRep());
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -69,7 +69,7 @@ DEL_DOT_VEC_2D::~DEL_DOT_VEC_2D()
   delete m_domain;
 }
 
-void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
   allocAndInitDataConst(m_y, m_array_length, 0.0, vid);
@@ -85,6 +85,8 @@ void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
     Real_type dy = 0.1;
     setMeshPositions_2d(m_x, dx, m_y, dy, *m_domain);
     setRealZones_2d(m_real_zones, *m_domain);
+    reorderZones(m_real_zones, m_domain->n_real_zones, *m_domain,
+                 getSFCOrderingFromName(getVariantTuningName(vid, tune_idx)));
   }
 
   allocAndInitData(m_xdot, m_array_length, vid);
@@ -36,11 +36,13 @@
 ///   div[i] = dfxdx + dfydy + affine ;
 /// }
 ///
+/// The "index32" tunings read 32-bit zone indices (see apps/AppsData.hpp).
+///
 
 #ifndef RAJAPerf_Apps_DEL_DOT_VEC_2D_HPP
 #define RAJAPerf_Apps_DEL_DOT_VEC_2D_HPP
 
-#define DEL_DOT_VEC_2D_DATA_SETUP \
+#define DEL_DOT_VEC_2D_DATA_SETUP_ZONES(zones) \
   Real_ptr x = m_x; \
   Real_ptr y = m_y; \
   Real_ptr xdot = m_xdot; \
@@ -60,7 +62,10 @@
   NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ; \
   NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ; \
 \
-  Index_ptr real_zones = m_real_zones;
+  auto real_zones = zones;
+
+#define DEL_DOT_VEC_2D_DATA_SETUP \
+  DEL_DOT_VEC_2D_DATA_SETUP_ZONES(m_real_zones)
 
 #define DEL_DOT_VEC_2D_BODY_INDEX \
   Index_type i = real_zones[ii];
@@ -119,8 +124,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename ZoneIndex_type >
+  void runSeqVariantImpl(VariantID vid, ZoneIndex_type* zone_list);
+  template < typename ZoneIndex_type >
+  void runOpenMPVariantImpl(VariantID vid, ZoneIndex_type* zone_list);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -18,7 +18,7 @@
 namespace rajaperf {
 namespace apps {
 
-void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+void DIFFUSION3DPA::runSeqVariantDefault(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
   DIFFUSION3DPA_DATA_SETUP;
@@ -314,5 +314,81 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
   }
 }
 
+template < size_t W >
+void DIFFUSION3DPA::runSeqVariantSimd(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  DIFFUSION3DPA_DATA_SETUP;
+
+  const Index_type nbatches = getNumElementBatches(NE, W);
+  const Index_type x_size = DPA_D1D*DPA_D1D*DPA_D1D;
+  const Index_type d_size = DPA_Q1D*DPA_Q1D*DPA_Q1D*SYM;
+
+  Real_ptr Xs;
+  Real_ptr Ds;
+  Real_ptr Ys;
+  allocData(Xs, nbatches*W*x_size, vid);
+  allocData(Ds, nbatches*W*d_size, vid);
+  allocData(Ys, nbatches*W*x_size, vid);
+
+  interleaveElements(Xs, X, x_size, NE, W);
+  interleaveElements(Ds, D, d_size, NE, W);
+  interleaveElements(Ys, Y, x_size, NE, W);
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    for (Index_type eb = 0; eb < nbatches; ++eb) {
+      DIFFUSION3DPA_SIMD_BODY(W)
+    }
+
+  }
+  stopTimer();
+
+  deinterleaveElements(Y, Ys, x_size, NE, W);
+
+  deallocData(Xs, vid);
+  deallocData(Ds, vid);
+  deallocData(Ys, vid);
+}
+
+void DIFFUSION3DPA::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    seq_for(fem_simd_widths_type{}, [&](auto W) {
+      if (tune_idx == t) {
+        runSeqVariantSimd<W>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void DIFFUSION3DPA::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    seq_for(fem_simd_widths_type{}, [&](auto W) {
+      addVariantTuningName(vid, "simd_"+std::to_string(W));
+    });
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
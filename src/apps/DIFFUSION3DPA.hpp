@@ -209,6 +209,10 @@
 ///
 /// } // element loop
 ///
+/// The Base_Seq and Base_OpenMP variants have "simd_4" and "simd_8"
+/// tunings that apply the operator to batches of 4 or 8 elements, one per
+/// SIMD lane, in an element interleaved copy of the data (FEM_SIMD.hpp).
+///
 
 #ifndef RAJAPerf_Apps_DIFFUSION3DPA_HPP
 #define RAJAPerf_Apps_DIFFUSION3DPA_HPP
@@ -224,6 +228,7 @@ const bool symmetric = true;
 
 #include "common/KernelBase.hpp"
 #include "FEM_MACROS.hpp"
+#include "FEM_SIMD.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -457,6 +462,197 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         }                                       \
         dpaY_(dx,dy,dz,e) += (u + v + w);
 
+//
+// Body for the batch eb of W elements of the "simd_<W>" tunings, with
+// the element data in the element interleaved arrays Xs, Ds and Ys.
+//
+#define DIFFUSION3DPA_SIMD_BODY(W)                                                    \
+  constexpr int MQ1 = DPA_Q1D;                                                        \
+  constexpr int MD1 = DPA_D1D;                                                        \
+  double sBG[MQ1*MD1];                                                                \
+  double (*B)[MD1] = (double (*)[MD1]) sBG;                                           \
+  double (*G)[MD1] = (double (*)[MD1]) sBG;                                           \
+  double (*Bt)[MQ1] = (double (*)[MQ1]) sBG;                                          \
+  double (*Gt)[MQ1] = (double (*)[MQ1]) sBG;                                          \
+  double DDQ0[MD1][MD1][MQ1][W], DDQ1[MD1][MD1][MQ1][W];                              \
+  double DQQ0[MD1][MQ1][MQ1][W], DQQ1[MD1][MQ1][MQ1][W], DQQ2[MD1][MQ1][MQ1][W];      \
+  double QQQ0[MQ1][MQ1][MQ1][W], QQQ1[MQ1][MQ1][MQ1][W], QQQ2[MQ1][MQ1][MQ1][W];      \
+  double QQD0[MQ1][MQ1][MD1][W], QQD1[MQ1][MQ1][MD1][W], QQD2[MQ1][MQ1][MD1][W];      \
+  double QDD0[MQ1][MD1][MD1][W], QDD1[MQ1][MD1][MD1][W], QDD2[MQ1][MD1][MD1][W];      \
+  Real_ptr Xb = Xs + eb * MD1 * MD1 * MD1 * W;                                        \
+  Real_ptr Yb = Ys + eb * MD1 * MD1 * MD1 * W;                                        \
+  Real_ptr Db = Ds + eb * MQ1 * MQ1 * MQ1 * SYM * W;                                  \
+  CPU_FOREACH(dy, y, DPA_D1D) {                                                       \
+    CPU_FOREACH(qx, x, DPA_Q1D) {                                                     \
+      DIFFUSION3DPA_2;                                                                \
+    }                                                                                 \
+  }                                                                                   \
+  CPU_FOREACH(dz, z, DPA_D1D) {                                                       \
+    CPU_FOREACH(dy, y, DPA_D1D) {                                                     \
+      CPU_FOREACH(qx, x, DPA_Q1D) {                                                   \
+        double u[W], v[W];                                                            \
+        FEM_SIMD_LANES(l, W) { u[l] = 0.0; v[l] = 0.0; }                              \
+        for (int dx = 0; dx < DPA_D1D; ++dx) {                                        \
+          const int i = qi(qx,dx,DPA_Q1D);                                            \
+          const int j = dj(qx,dx,DPA_D1D);                                            \
+          const int k = qk(qx,dx,DPA_Q1D);                                            \
+          const int m = dl(qx,dx,DPA_D1D);                                            \
+          const double s = sign(qx,dx);                                               \
+          Real_ptr Xd = Xb + (dx + DPA_D1D * (dy + DPA_D1D * dz)) * W;                \
+          FEM_SIMD_LANES(l, W) {                                                      \
+            u[l] += Xd[l] * B[i][j];                                                  \
+            v[l] += Xd[l] * G[k][m] * s;                                              \
+          }                                                                           \
+        }                                                                             \
+        FEM_SIMD_LANES(l, W) {                                                        \
+          DDQ0[dz][dy][qx][l] = u[l];                                                 \
+          DDQ1[dz][dy][qx][l] = v[l];                                                 \
+        }                                                                             \
+      }                                                                               \
+    }                                                                                 \
+  }                                                                                   \
+  CPU_FOREACH(dz, z, DPA_D1D) {                                                       \
+    CPU_FOREACH(qy, y, DPA_Q1D) {                                                     \
+      CPU_FOREACH(qx, x, DPA_Q1D) {                                                   \
+        double u[W], v[W], w[W];                                                      \
+        FEM_SIMD_LANES(l, W) { u[l] = 0.0; v[l] = 0.0; w[l] = 0.0; }                  \
+        for (int dy = 0; dy < DPA_D1D; ++dy) {                                        \
+          const int i = qi(qy,dy,DPA_Q1D);                                            \
+          const int j = dj(qy,dy,DPA_D1D);                                            \
+          const int k = qk(qy,dy,DPA_Q1D);                                            \
+          const int m = dl(qy,dy,DPA_D1D);                                            \
+          const double s = sign(qy,dy);                                               \
+          FEM_SIMD_LANES(l, W) {                                                      \
+            u[l] += DDQ1[dz][dy][qx][l] * B[i][j];                                    \
+            v[l] += DDQ0[dz][dy][qx][l] * G[k][m] * s;                                \
+            w[l] += DDQ0[dz][dy][qx][l] * B[i][j];                                    \
+          }                                                                           \
+        }                                                                             \
+        FEM_SIMD_LANES(l, W) {                                                        \
+          DQQ0[dz][qy][qx][l] = u[l];                                                 \
+          DQQ1[dz][qy][qx][l] = v[l];                                                 \
+          DQQ2[dz][qy][qx][l] = w[l];                                                 \
+        }                                                                             \
+      }                                                                               \
+    }                                                                                 \
+  }                                                                                   \
+  CPU_FOREACH(qz, z, DPA_Q1D) {                                                       \
+    CPU_FOREACH(qy, y, DPA_Q1D) {                                                     \
+      CPU_FOREACH(qx, x, DPA_Q1D) {                                                   \
+        double u[W], v[W], w[W];                                                      \
+        FEM_SIMD_LANES(l, W) { u[l] = 0.0; v[l] = 0.0; w[l] = 0.0; }                  \
+        for (int dz = 0; dz < DPA_D1D; ++dz) {                                        \
+          const int i = qi(qz,dz,DPA_Q1D);                                            \
+          const int j = dj(qz,dz,DPA_D1D);                                            \
+          const int k = qk(qz,dz,DPA_Q1D);                                            \
+          const int m = dl(qz,dz,DPA_D1D);                                            \
+          const double s = sign(qz,dz);                                               \
+          FEM_SIMD_LANES(l, W) {                                                      \
+            u[l] += DQQ0[dz][qy][qx][l] * B[i][j];                                    \
+            v[l] += DQQ1[dz][qy][qx][l] * B[i][j];                                    \
+            w[l] += DQQ2[dz][qy][qx][l] * G[k][m] * s;                                \
+          }                                                                           \
+        }                                                                             \
+        const int q = qx + DPA_Q1D * (qy + DPA_Q1D * qz);                             \
+        const int Q3 = DPA_Q1D * DPA_Q1D * DPA_Q1D;                                   \
+        FEM_SIMD_LANES(l, W) {                                                        \
+          const double O11 = Db[(q + Q3*0)*W + l];                                    \
+          const double O12 = Db[(q + Q3*1)*W + l];                                    \
+          const double O13 = Db[(q + Q3*2)*W + l];                                    \
+          const double O21 = symmetric ? O12 : Db[(q + Q3*3)*W + l];                  \
+          const double O22 = symmetric ? Db[(q + Q3*3)*W + l] : Db[(q + Q3*4)*W + l]; \
+          const double O23 = symmetric ? Db[(q + Q3*4)*W + l] : Db[(q + Q3*5)*W + l]; \
+          const double O31 = symmetric ? O13 : Db[(q + Q3*6)*W + l];                  \
+          const double O32 = symmetric ? O23 : Db[(q + Q3*7)*W + l];                  \
+          const double O33 = symmetric ? Db[(q + Q3*5)*W + l] : Db[(q + Q3*8)*W + l]; \
+          const double gX = u[l];                                                     \
+          const double gY = v[l];                                                     \
+          const double gZ = w[l];                                                     \
+          QQQ0[qz][qy][qx][l] = (O11*gX) + (O12*gY) + (O13*gZ);                       \
+          QQQ1[qz][qy][qx][l] = (O21*gX) + (O22*gY) + (O23*gZ);                       \
+          QQQ2[qz][qy][qx][l] = (O31*gX) + (O32*gY) + (O33*gZ);                       \
+        }                                                                             \
+      }                                                                               \
+    }                                                                                 \
+  }                                                                                   \
+  CPU_FOREACH(d, y, DPA_D1D) {                                                        \
+    CPU_FOREACH(q, x, DPA_Q1D) {                                                      \
+      DIFFUSION3DPA_6;                                                                \
+    }                                                                                 \
+  }                                                                                   \
+  CPU_FOREACH(qz, z, DPA_Q1D) {                                                       \
+    CPU_FOREACH(qy, y, DPA_Q1D) {                                                     \
+      CPU_FOREACH(dx, x, DPA_D1D) {                                                   \
+        double u[W], v[W], w[W];                                                      \
+        FEM_SIMD_LANES(l, W) { u[l] = 0.0; v[l] = 0.0; w[l] = 0.0; }                  \
+        for (int qx = 0; qx < DPA_Q1D; ++qx) {                                        \
+          const int i = qi(qx,dx,DPA_Q1D);                                            \
+          const int j = dj(qx,dx,DPA_D1D);                                            \
+          const int k = qk(qx,dx,DPA_Q1D);                                            \
+          const int m = dl(qx,dx,DPA_D1D);                                            \
+          const double s = sign(qx,dx);                                               \
+          FEM_SIMD_LANES(l, W) {                                                      \
+            u[l] += QQQ0[qz][qy][qx][l] * Gt[m][k] * s;                               \
+            v[l] += QQQ1[qz][qy][qx][l] * Bt[j][i];                                   \
+            w[l] += QQQ2[qz][qy][qx][l] * Bt[j][i];                                   \
+          }                                                                           \
+        }                                                                             \
+        FEM_SIMD_LANES(l, W) {                                                        \
+          QQD0[qz][qy][dx][l] = u[l];                                                 \
+          QQD1[qz][qy][dx][l] = v[l];                                                 \
+          QQD2[qz][qy][dx][l] = w[l];                                                 \
+        }                                                                             \
+      }                                                                               \
+    }                                                                                 \
+  }                                                                                   \
+  CPU_FOREACH(qz, z, DPA_Q1D) {                                                       \
+    CPU_FOREACH(dy, y, DPA_D1D) {                                                     \
+      CPU_FOREACH(dx, x, DPA_D1D) {                                                   \
+        double u[W], v[W], w[W];                                                      \
+        FEM_SIMD_LANES(l, W) { u[l] = 0.0; v[l] = 0.0; w[l] = 0.0; }                  \
+        for (int qy = 0; qy < DPA_Q1D; ++qy) {                                        \
+          const int i = qi(qy,dy,DPA_Q1D);                                            \
+          const int j = dj(qy,dy,DPA_D1D);                                            \
+          const int k = qk(qy,dy,DPA_Q1D);                                            \
+          const int m = dl(qy,dy,DPA_D1D);                                            \
+          const double s = sign(qy,dy);                                               \
+          FEM_SIMD_LANES(l, W) {                                                      \
+            u[l] += QQD0[qz][qy][dx][l] * Bt[j][i];                                   \
+            v[l] += QQD1[qz][qy][dx][l] * Gt[m][k] * s;                               \
+            w[l] += QQD2[qz][qy][dx][l] * Bt[j][i];                                   \
+          }                                                                           \
+        }                                                                             \
+        FEM_SIMD_LANES(l, W) {                                                        \
+          QDD0[qz][dy][dx][l] = u[l];                                                 \
+          QDD1[qz][dy][dx][l] = v[l];                                                 \
+          QDD2[qz][dy][dx][l] = w[l];                                                 \
+        }                                                                             \
+      }                                                                               \
+    }                                                                                 \
+  }                                                                                   \
+  CPU_FOREACH(dz, z, DPA_D1D) {                                                       \
+    CPU_FOREACH(dy, y, DPA_D1D) {                                                     \
+      CPU_FOREACH(dx, x, DPA_D1D) {                                                   \
+        double u[W], v[W], w[W];                                                      \
+        FEM_SIMD_LANES(l, W) { u[l] = 0.0; v[l] = 0.0; w[l] = 0.0; }                  \
+        for (int qz = 0; qz < DPA_Q1D; ++qz) {                                        \
+          const int i = qi(qz,dz,DPA_Q1D);                                            \
+          const int j = dj(qz,dz,DPA_D1D);                                            \
+          const int k = qk(qz,dz,DPA_Q1D);                                            \
+          const int m = dl(qz,dz,DPA_D1D);                                            \
+          const double s = sign(qz,dz);                                               \
+          FEM_SIMD_LANES(l, W) {                                                      \
+            u[l] += QDD0[qz][dy][dx][l] * Bt[j][i];                                   \
+            v[l] += QDD1[qz][dy][dx][l] * Bt[j][i];                                   \
+            w[l] += QDD2[qz][dy][dx][l] * Gt[m][k] * s;                               \
+          }                                                                           \
+        }                                                                             \
+        Real_ptr Yd = Yb + (dx + DPA_D1D * (dy + DPA_D1D * dz)) * W;                  \
+        FEM_SIMD_LANES(l, W) { Yd[l] += (u[l] + v[l] + w[l]); }                       \
+      }                                                                               \
+    }                                                                                 \
+  }
+
 namespace rajaperf
 {
 class RunParams;
@@ -482,8 +678,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t W >
+  void runSeqVariantSimd(VariantID vid);
+  template < size_t W >
+  void runOpenMPVariantSimd(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -0,0 +1,95 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Element batching for the "simd_<W>" tunings of the CPU variants of the
+/// partial assembly kernels.
+///
+/// The element loops of these kernels contract over 3 to 5 DOFs or
+/// quadrature points at a time, too few for compilers to vectorize well.
+/// The simd tunings apply the operator to batches of W elements instead,
+/// every scalar of the element code becoming W lanes, so the innermost
+/// loops run over the lanes with a fixed trip count and unit stride.
+///
+/// The element data is copied before timing into an element interleaved
+/// layout, where the W values of a batch at each DOF or quadrature point
+/// are contiguous, and the last batch is padded with zero elements. The
+/// results are copied back after timing, so the checksums match those of
+/// the default tuning.
+///
+
+#ifndef RAJAPerf_FEM_SIMD_HPP
+#define RAJAPerf_FEM_SIMD_HPP
+
+#include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+
+// Loop over the lanes of a batch of W elements
+#define FEM_SIMD_LANES(l, W) \
+  RAJAPERF_OMP_SIMD \
+  for (int l = 0; l < static_cast<int>(W); ++l)
+
+namespace rajaperf
+{
+namespace apps
+{
+
+/*!
+ * \brief Simd widths of the "simd_<W>" tunings.
+ */
+using fem_simd_widths_type = integer::list_type<4, 8>;
+
+/*!
+ * \brief Number of batches of W elements holding NE elements.
+ */
+inline Index_type getNumElementBatches(Index_type NE, Index_type W)
+{
+  return (NE + W - 1) / W;
+}
+
+/*!
+ * \brief Copy the values of NE elements, elem_size values each, into the
+ *        element interleaved layout, dst[(b*elem_size + i)*W + l] for
+ *        value i of element b*W + l, with zero padding.
+ */
+inline void interleaveElements(Real_ptr dst, Real_ptr src,
+                               Index_type elem_size, Index_type NE,
+                               Index_type W)
+{
+  const Index_type nbatches = getNumElementBatches(NE, W);
+  for (Index_type b = 0; b < nbatches; ++b) {
+    for (Index_type i = 0; i < elem_size; ++i) {
+      for (Index_type l = 0; l < W; ++l) {
+        const Index_type e = b*W + l;
+        dst[(b*elem_size + i)*W + l] = (e < NE) ? src[i + elem_size*e] : 0.0;
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Copy the values of NE elements in the element interleaved
+ *        layout back into the element by element layout.
+ */
+inline void deinterleaveElements(Real_ptr dst, Real_ptr src,
+                                 Index_type elem_size, Index_type NE,
+                                 Index_type W)
+{
+  for (Index_type e = 0; e < NE; ++e) {
+    const Index_type b = e / W;
+    const Index_type l = e % W;
+    for (Index_type i = 0; i < elem_size; ++i) {
+      dst[i + elem_size*e] = src[(b*elem_size + i)*W + l];
+    }
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
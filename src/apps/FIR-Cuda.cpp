@@ -27,12 +27,12 @@ namespace apps
 
 #if defined(USE_CUDA_CONSTANT_MEMORY)
 
-__constant__ Real_type coeff[FIR_COEFFLEN];
+__constant__ Real_type coeff[FIR_MAX_CONSTANT_COEFFLEN];
 
 #define FIR_DATA_SETUP_CUDA \
   Real_type *dcoeff_addr; \
   cudaErrchk( cudaGetSymbolAddress((void**)&dcoeff_addr, coeff) ); \
-  cudaErrchk( cudaMemcpyAsync(dcoeff_addr, coeff_array, FIR_COEFFLEN * sizeof(Real_type), cudaMemcpyHostToDevice, res.get_stream()) );
+  cudaErrchk( cudaMemcpyAsync(dcoeff_addr, coeff_array, coefflen * sizeof(Real_type), cudaMemcpyHostToDevice, res.get_stream()) );
 
 
 #define FIR_DATA_TEARDOWN_CUDA
@@ -55,8 +55,8 @@ __global__ void fir(Real_ptr out, Real_ptr in,
   Real_ptr coeff; \
   \
   Real_ptr tcoeff = &coeff_array[0]; \
-  allocData(DataSpace::CudaDevice, coeff, FIR_COEFFLEN); \
-  copyData(DataSpace::CudaDevice, coeff, DataSpace::Host, tcoeff, FIR_COEFFLEN);
+  allocData(DataSpace::CudaDevice, coeff, coefflen); \
+  copyData(DataSpace::CudaDevice, coeff, DataSpace::Host, tcoeff, coefflen);
 
 
 #define FIR_DATA_TEARDOWN_CUDA \
@@ -27,10 +27,10 @@ namespace apps
 
 #if defined(USE_HIP_CONSTANT_MEMORY)
 
-__constant__ Real_type coeff[FIR_COEFFLEN];
+__constant__ Real_type coeff[FIR_MAX_CONSTANT_COEFFLEN];
 
 #define FIR_DATA_SETUP_HIP \
-  hipErrchk( hipMemcpyToSymbolAsync(HIP_SYMBOL(coeff), coeff_array, FIR_COEFFLEN * sizeof(Real_type), 0, hipMemcpyHostToDevice, res.get_stream()) );
+  hipErrchk( hipMemcpyToSymbolAsync(HIP_SYMBOL(coeff), coeff_array, coefflen * sizeof(Real_type), 0, hipMemcpyHostToDevice, res.get_stream()) );
 
 
 #define FIR_DATA_TEARDOWN_HIP
@@ -53,8 +53,8 @@ __global__ void fir(Real_ptr out, Real_ptr in,
   Real_ptr coeff; \
   \
   Real_ptr tcoeff = &coeff_array[0]; \
-  allocData(DataSpace::HipDevice, coeff, FIR_COEFFLEN); \
-  copyData(DataSpace::HipDevice, coeff, DataSpace::Host, tcoeff, FIR_COEFFLEN);
+  allocData(DataSpace::HipDevice, coeff, coefflen); \
+  copyData(DataSpace::HipDevice, coeff, DataSpace::Host, tcoeff, coefflen);
 
 
 #define FIR_DATA_TEARDOWN_HIP \
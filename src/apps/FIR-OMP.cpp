@@ -19,7 +19,7 @@ namespace apps
 {
 
 
-void FIR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIR::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -31,8 +31,7 @@ void FIR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   FIR_DATA_SETUP;
 
-  Real_type coeff[FIR_COEFFLEN];
-  std::copy(std::begin(coeff_array), std::end(coeff_array), std::begin(coeff));
+  Real_ptr coeff = coeff_array;
 
   auto fir_lam = [=](Index_type i) {
                    FIR_BODY;
@@ -97,5 +96,220 @@ void FIR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+void FIR::runOpenMPVariantRegisterBlock(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP;
+
+  Real_ptr coeff = coeff_array;
+
+  const Index_type nblocks = (iend - ibegin) / FIR_REGISTER_BLOCK;
+  const Index_type iend_blocks = ibegin + nblocks * FIR_REGISTER_BLOCK;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ib = 0; ib < nblocks; ++ib ) {
+          const Index_type i = ibegin + ib * FIR_REGISTER_BLOCK;
+          FIR_REGISTER_BLOCK_BODY;
+        }
+
+        for (Index_type i = iend_blocks; i < iend; ++i ) {
+          FIR_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void FIR::runOpenMPVariantTransposed(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP;
+
+  Real_ptr coeff = coeff_array;
+
+  const Index_type nstrips = (iend - ibegin + FIR_TRANSPOSED_STRIP - 1) /
+                             FIR_TRANSPOSED_STRIP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type is = 0; is < nstrips; ++is ) {
+          const Index_type i = ibegin + is * FIR_TRANSPOSED_STRIP;
+          FIR_TRANSPOSED_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void FIR::runOpenMPVariantFFT(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type len_in = getActualProblemSize();
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_DATA_SETUP;
+
+  const Index_type fft_len = getFFTLength();
+  const Index_type fft_outputs = fft_len - coefflen + 1;
+  const Index_type npairs = (iend + 2*fft_outputs - 1) / (2*fft_outputs);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      Real_ptr fft_plan;
+      Index_ptr fft_rev;
+      Real_ptr filter_re;
+      Real_ptr filter_im;
+      allocFFTFilter(vid, fft_len, fft_plan, fft_rev, filter_re, filter_im);
+
+      Real_ptr thread_work;
+      allocData(thread_work, omp_get_max_threads() * 2 * fft_len, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Real_ptr wre = thread_work + omp_get_thread_num() * 2 * fft_len;
+          Real_ptr wim = wre + fft_len;
+
+          #pragma omp for
+          for (Index_type p = 0; p < npairs; ++p ) {
+            FIR_FFT_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      deallocData(thread_work, vid);
+      deallocFFTFilter(vid, fft_plan, fft_rev, filter_re, filter_im);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void FIR::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantRegisterBlock(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantTransposed(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantFFT(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void FIR::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    addVariantTuningName(vid, "register_block");
+
+    addVariantTuningName(vid, "transposed_simd");
+
+    addVariantTuningName(vid, "fft_overlap_save");
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -31,8 +31,8 @@ namespace apps
   Real_ptr coeff; \
   \
   Real_ptr tcoeff = &coeff_array[0]; \
-  allocData(DataSpace::OmpTarget, coeff, FIR_COEFFLEN); \
-  copyData(DataSpace::OmpTarget, coeff, DataSpace::Host, tcoeff, FIR_COEFFLEN);
+  allocData(DataSpace::OmpTarget, coeff, coefflen); \
+  copyData(DataSpace::OmpTarget, coeff, DataSpace::Host, tcoeff, coefflen);
 
 
 #define FIR_DATA_TEARDOWN_OMP_TARGET \
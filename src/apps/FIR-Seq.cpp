@@ -19,7 +19,7 @@ namespace apps
 {
 
 
-void FIR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIR::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -29,8 +29,7 @@ void FIR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   FIR_DATA_SETUP;
 
-  Real_type coeff[FIR_COEFFLEN];
-  std::copy(std::begin(coeff_array), std::end(coeff_array), std::begin(coeff));
+  Real_ptr coeff = coeff_array;
 
 #if defined(RUN_RAJA_SEQ)
   auto fir_lam = [=](Index_type i) {
@@ -94,5 +93,196 @@ void FIR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void FIR::runSeqVariantRegisterBlock(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP;
+
+  Real_ptr coeff = coeff_array;
+
+  const Index_type nblocks = (iend - ibegin) / FIR_REGISTER_BLOCK;
+  const Index_type iend_blocks = ibegin + nblocks * FIR_REGISTER_BLOCK;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ib = 0; ib < nblocks; ++ib ) {
+          const Index_type i = ibegin + ib * FIR_REGISTER_BLOCK;
+          FIR_REGISTER_BLOCK_BODY;
+        }
+
+        for (Index_type i = iend_blocks; i < iend; ++i ) {
+          FIR_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void FIR::runSeqVariantTransposed(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP;
+
+  Real_ptr coeff = coeff_array;
+
+  const Index_type nstrips = (iend - ibegin + FIR_TRANSPOSED_STRIP - 1) /
+                             FIR_TRANSPOSED_STRIP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type is = 0; is < nstrips; ++is ) {
+          const Index_type i = ibegin + is * FIR_TRANSPOSED_STRIP;
+          FIR_TRANSPOSED_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void FIR::runSeqVariantFFT(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type len_in = getActualProblemSize();
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_DATA_SETUP;
+
+  const Index_type fft_len = getFFTLength();
+  const Index_type fft_outputs = fft_len - coefflen + 1;
+  const Index_type npairs = (iend + 2*fft_outputs - 1) / (2*fft_outputs);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      Real_ptr fft_plan;
+      Index_ptr fft_rev;
+      Real_ptr filter_re;
+      Real_ptr filter_im;
+      allocFFTFilter(vid, fft_len, fft_plan, fft_rev, filter_re, filter_im);
+
+      Real_ptr wre;
+      Real_ptr wim;
+      allocData(wre, fft_len, vid);
+      allocData(wim, fft_len, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < npairs; ++p ) {
+          FIR_FFT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      deallocData(wre, vid);
+      deallocData(wim, vid);
+      deallocFFTFilter(vid, fft_plan, fft_rev, filter_re, filter_im);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void FIR::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantRegisterBlock(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantTransposed(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantFFT(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void FIR::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    addVariantTuningName(vid, "register_block");
+
+    addVariantTuningName(vid, "transposed_simd");
+
+    addVariantTuningName(vid, "fft_overlap_save");
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -24,9 +24,15 @@ FIR::FIR(const RunParams& params)
   setDefaultProblemSize(1000000);
   setDefaultReps(160);
 
-  m_coefflen = FIR_COEFFLEN;
+  m_coefflen = ( params.getFirCoefflen() > 0 ) ? params.getFirCoefflen()
+                                                : FIR_COEFFLEN;
 
-  setActualProblemSize( getTargetProblemSize() );
+  m_coeff.resize(m_coefflen);
+  for (Index_type j = 0; j < m_coefflen; ++j ) {
+    m_coeff[j] = (j % 5 == 0) ? 3.0 : -1.0;
+  }
+
+  setActualProblemSize( std::max(getTargetProblemSize(), m_coefflen+1) );
 
   setItsPerRep( getActualProblemSize() - m_coefflen );
   setKernelsPerRep(1);
@@ -51,11 +57,16 @@ FIR::FIR(const RunParams& params)
   setVariantDefined( Base_OpenMPTarget );
   setVariantDefined( RAJA_OpenMPTarget );
 
-  setVariantDefined( Base_CUDA );
-  setVariantDefined( RAJA_CUDA );
+  // GPU variants keep the coefficients in constant memory
+  if ( m_coefflen <= FIR_MAX_CONSTANT_COEFFLEN ) {
+
+    setVariantDefined( Base_CUDA );
+    setVariantDefined( RAJA_CUDA );
+
+    setVariantDefined( Base_HIP );
+    setVariantDefined( RAJA_HIP );
 
-  setVariantDefined( Base_HIP );
-  setVariantDefined( RAJA_HIP );
+  }
 }
 
 FIR::~FIR()
@@ -81,5 +92,39 @@ void FIR::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_out, vid);
 }
 
+Index_type FIR::getFFTLength() const
+{
+  return fftLength(std::max(4*m_coefflen, Index_type(64)));
+}
+
+void FIR::allocFFTFilter(VariantID vid, Index_type fft_len,
+                         Real_ptr& fft_plan, Index_ptr& fft_rev,
+                         Real_ptr& filter_re, Real_ptr& filter_im)
+{
+  allocData(fft_plan, fftPlanSize(fft_len), vid);
+  allocData(fft_rev, fft_len, vid);
+  allocData(filter_re, fft_len, vid);
+  allocData(filter_im, fft_len, vid);
+
+  initFFTPlan(fft_len, fft_plan, fft_rev);
+
+  // the outputs are the convolution of the input with the reversed taps
+  for (Index_type k = 0; k < fft_len; ++k ) {
+    filter_re[k] = (k < m_coefflen) ? m_coeff[m_coefflen-1-k] : 0.0;
+    filter_im[k] = 0.0;
+  }
+  fftForward(fft_len, filter_re, filter_im, fft_plan, fft_rev);
+}
+
+void FIR::deallocFFTFilter(VariantID vid,
+                           Real_ptr& fft_plan, Index_ptr& fft_rev,
+                           Real_ptr& filter_re, Real_ptr& filter_im)
+{
+  deallocData(fft_plan, vid);
+  deallocData(fft_rev, vid);
+  deallocData(filter_re, vid);
+  deallocData(filter_im, vid);
+}
+
 } // end namespace apps
 } // end namespace rajaperf
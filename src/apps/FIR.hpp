@@ -9,12 +9,10 @@
 ///
 /// FIR kernel reference implementation:
 ///
-/// #define FIR_COEFFLEN (16)
-///
-/// Real_type coeff[FIR_COEFFLEN] = { 3.0, -1.0, -1.0, -1.0,
-///                                  -1.0, 3.0, -1.0, -1.0,
-///                                  -1.0, -1.0, 3.0, -1.0,
-///                                  -1.0, -1.0, -1.0, 3.0 };
+/// Real_type coeff[coefflen];
+/// for (Index_type j = 0; j < coefflen; ++j ) {
+///   coeff[j] = (j % 5 == 0) ? 3.0 : -1.0;
+/// }
 ///
 /// for (Index_type i = ibegin; i < iend; ++i ) {
 ///   Real_type sum = 0.0;
@@ -24,13 +22,43 @@
 ///   out[i] = sum;
 /// }
 ///
+/// The number of taps, coefflen, is FIR_COEFFLEN unless set with the
+/// --fir_coefflen option.
+///
+/// The Base_Seq and Base_OpenMP variants have tunings,
+///
+///   register_block    computes FIR_REGISTER_BLOCK consecutive outputs
+///                     at a time, so each coefficient is loaded once for
+///                     the block and the sums stay in registers.
+///
+///   transposed_simd   the transposed form, adding the product of each
+///                     coefficient and the input to strips of
+///                     FIR_TRANSPOSED_STRIP outputs in a simd loop.
+///
+///   fft_overlap_save  overlap-save convolution with the FFTs of
+///                     common/FFTUtils.hpp, two blocks of input per
+///                     complex transform. The transform of the filter is
+///                     computed before timing.
+///
+/// The direct tunings sum in the same order as the default tuning. The
+/// FLOPs per rep count the direct form for all tunings, so the timings
+/// of the tunings over a range of tap counts (scripts/sweep_fir.sh) give
+/// the tap count beyond which the FFT is faster.
+///
 
 #ifndef RAJAPerf_Apps_FIR_HPP
 #define RAJAPerf_Apps_FIR_HPP
 
 
+// Default number of taps
 #define FIR_COEFFLEN (16)
 
+// Most taps that fit in the constant memory of the GPU variants
+#define FIR_MAX_CONSTANT_COEFFLEN (4096)
+
+#define FIR_REGISTER_BLOCK (8)
+#define FIR_TRANSPOSED_STRIP (1024)
+
 #define FIR_DATA_SETUP \
   Real_ptr in = m_in; \
   Real_ptr out = m_out; \
@@ -38,10 +66,7 @@
   const Index_type coefflen = m_coefflen;
 
 #define FIR_COEFF \
-  Real_type coeff_array[FIR_COEFFLEN] = { 3.0, -1.0, -1.0, -1.0, \
-                                         -1.0, 3.0, -1.0, -1.0, \
-                                         -1.0, -1.0, 3.0, -1.0, \
-                                         -1.0, -1.0, -1.0, 3.0 };
+  Real_ptr coeff_array = m_coeff.data();
 
 #define FIR_BODY \
   Real_type sum = 0.0; \
@@ -52,7 +77,68 @@
   out[i] = sum;
 
 
+#define FIR_REGISTER_BLOCK_BODY \
+  Real_type sum[FIR_REGISTER_BLOCK]; \
+  for (Index_type r = 0; r < FIR_REGISTER_BLOCK; ++r ) { \
+    sum[r] = 0.0; \
+  } \
+  for (Index_type j = 0; j < coefflen; ++j ) { \
+    const Real_type c = coeff[j]; \
+    for (Index_type r = 0; r < FIR_REGISTER_BLOCK; ++r ) { \
+      sum[r] += c*in[i+r+j]; \
+    } \
+  } \
+  for (Index_type r = 0; r < FIR_REGISTER_BLOCK; ++r ) { \
+    out[i+r] = sum[r]; \
+  }
+
+#define FIR_TRANSPOSED_BODY \
+  const Index_type iend_strip = std::min(i + FIR_TRANSPOSED_STRIP, iend); \
+  for (Index_type ii = i; ii < iend_strip; ++ii ) { \
+    out[ii] = 0.0; \
+  } \
+  for (Index_type j = 0; j < coefflen; ++j ) { \
+    const Real_type c = coeff[j]; \
+    RAJAPERF_OMP_SIMD \
+    for (Index_type ii = i; ii < iend_strip; ++ii ) { \
+      out[ii] += c*in[ii+j]; \
+    } \
+  }
+
+//
+// Overlap-save convolution of the pair of input blocks p, each giving
+// fft_outputs outputs, in the workspace wre, wim of fft_len values.
+//
+#define FIR_FFT_BODY \
+  const Index_type ia = 2*p*fft_outputs; \
+  const Index_type ib = ia + fft_outputs; \
+  for (Index_type k = 0; k < fft_len; ++k ) { \
+    wre[k] = (ia + k < len_in) ? in[ia + k] : 0.0; \
+    wim[k] = (ib + k < len_in) ? in[ib + k] : 0.0; \
+  } \
+  fftForward(fft_len, wre, wim, fft_plan, fft_rev); \
+  for (Index_type k = 0; k < fft_len; ++k ) { \
+    const Real_type z_re = wre[k]; \
+    const Real_type z_im = wim[k]; \
+    wre[k] = z_re*filter_re[k] - z_im*filter_im[k]; \
+    wim[k] = z_re*filter_im[k] + z_im*filter_re[k]; \
+  } \
+  fftInverse(fft_len, wre, wim, fft_plan, fft_rev); \
+  for (Index_type k = 0; k < fft_outputs; ++k ) { \
+    if (ia + k < iend) { \
+      out[ia + k] = wre[k + coefflen - 1]; \
+    } \
+    if (ib + k < iend) { \
+      out[ib + k] = wim[k + coefflen - 1]; \
+    } \
+  }
+
+
 #include "common/KernelBase.hpp"
+#include "common/FFTUtils.hpp"
+
+#include <algorithm>
+#include <vector>
 
 namespace rajaperf
 {
@@ -79,8 +165,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantRegisterBlock(VariantID vid);
+  void runSeqVariantTransposed(VariantID vid);
+  void runSeqVariantFFT(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantRegisterBlock(VariantID vid);
+  void runOpenMPVariantTransposed(VariantID vid);
+  void runOpenMPVariantFFT(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -90,10 +186,19 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  Index_type getFFTLength() const;
+  void allocFFTFilter(VariantID vid, Index_type fft_len,
+                      Real_ptr& fft_plan, Index_ptr& fft_rev,
+                      Real_ptr& filter_re, Real_ptr& filter_im);
+  void deallocFFTFilter(VariantID vid,
+                        Real_ptr& fft_plan, Index_ptr& fft_rev,
+                        Real_ptr& filter_re, Real_ptr& filter_im);
+
   Real_ptr m_in;
   Real_ptr m_out;
 
   Index_type m_coefflen;
+  std::vector<Real_type> m_coeff;
 };
 
 } // end namespace apps
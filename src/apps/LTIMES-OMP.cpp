@@ -18,7 +18,7 @@ namespace apps
 {
 
 
-void LTIMES::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -125,5 +125,124 @@ void LTIMES::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 #endif
 }
 
+//
+// Copy psi and phi into the layout of layout_helper and loop over them in
+// the same order, copying phi back afterwards.
+//
+template < typename layout_helper >
+void LTIMES::runOpenMPVariantLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  LTIMES_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_OpenMP : {
+
+      LTIMES_VIEWS_RANGES_RAJA;
+
+      Real_ptr psi_layout_dat;
+      Real_ptr phi_layout_dat;
+      allocData(psi_layout_dat, m_psilen, vid);
+      allocData(phi_layout_dat, m_philen, vid);
+
+      LTIMES_VIEWS_RAJA_LAYOUT;
+
+      for (Index_type z = 0; z < num_z; ++z ) {
+        for (Index_type g = 0; g < num_g; ++g ) {
+          for (Index_type d = 0; d < num_d; ++d ) {
+            psi_layout(IZ(z), IG(g), ID(d)) = psi(IZ(z), IG(g), ID(d));
+          }
+          for (Index_type m = 0; m < num_m; ++m ) {
+            phi_layout(IZ(z), IG(g), IM(m)) = phi(IZ(z), IG(g), IM(m));
+          }
+        }
+      }
+
+      auto ltimes_lam = [=](ID d, IZ z, IG g, IM m) {
+                          LTIMES_BODY_RAJA_LAYOUT;
+                        };
+
+      using EXEC_POL =
+        typename layout_helper::template exec_policy<RAJA::omp_parallel_for_exec>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(IDRange(0, num_d),
+                                                 IZRange(0, num_z),
+                                                 IGRange(0, num_g),
+                                                 IMRange(0, num_m)),
+                                ltimes_lam
+                              );
+
+      }
+      stopTimer();
+
+      for (Index_type z = 0; z < num_z; ++z ) {
+        for (Index_type g = 0; g < num_g; ++g ) {
+          for (Index_type m = 0; m < num_m; ++m ) {
+            phi(IZ(z), IG(g), IM(m)) = phi_layout(IZ(z), IG(g), IM(m));
+          }
+        }
+      }
+
+      deallocData(psi_layout_dat, vid);
+      deallocData(phi_layout_dat, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n LTIMES : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void LTIMES::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == RAJA_OpenMP) {
+
+    seq_for(ltimes_layout_helpers{}, [&](auto layout_helper) {
+      if (tune_idx == t) {
+        runOpenMPVariantLayout<decltype(layout_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void LTIMES::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == RAJA_OpenMP) {
+
+    seq_for(ltimes_layout_helpers{}, [&](auto layout_helper) {
+      addVariantTuningName(vid, decltype(layout_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -26,6 +26,13 @@
 /// and views to do the same thing without explicit index calculations (see
 /// the loop body definitions below).
 ///
+/// The RAJA variants also have a tuning for each ordering of the zone,
+/// group and direction (moment) dimensions of psi and phi, named by the
+/// dimensions from slowest to fastest varying, e.g. "DGZ" stores psi as
+/// psi[d][g][z] and phi as phi[m][g][z]. The default tuning is "ZGD". The
+/// loops are nested in the same order, with the m loop outside the d loop,
+/// so each tuning sums over d in the same order as the default tuning.
+///
 
 #ifndef RAJAPerf_Apps_LTIMES_HPP
 #define RAJAPerf_Apps_LTIMES_HPP
@@ -76,11 +83,31 @@
       using IGRange = RAJA::TypedRangeSegment<IG>; \
       using IMRange = RAJA::TypedRangeSegment<IM>;
 
+#define LTIMES_BODY_RAJA_LAYOUT \
+  phi_layout(z, g, m) +=  ell(m, d) * psi_layout(z, g, d);
+
+#define LTIMES_VIEWS_RAJA_LAYOUT \
+  using PSI_LAYOUT_VIEW = RAJA::TypedView<Real_type, \
+                            RAJA::Layout<3, Index_type, layout_helper::stride_one_dim>, \
+                            IZ, IG, ID>; \
+  using PHI_LAYOUT_VIEW = RAJA::TypedView<Real_type, \
+                            RAJA::Layout<3, Index_type, layout_helper::stride_one_dim>, \
+                            IZ, IG, IM>; \
+\
+  PSI_LAYOUT_VIEW psi_layout(psi_layout_dat, \
+               RAJA::make_permuted_layout( {{num_z, num_g, num_d}}, \
+                     RAJA::as_array<typename layout_helper::perm>::get() ) ); \
+  PHI_LAYOUT_VIEW phi_layout(phi_layout_dat, \
+               RAJA::make_permuted_layout( {{num_z, num_g, num_m}}, \
+                     RAJA::as_array<typename layout_helper::perm>::get() ) );
+
 
 #include "common/KernelBase.hpp"
 
 #include "RAJA/RAJA.hpp"
 
+#include <string>
+
 namespace rajaperf
 {
 class RunParams;
@@ -99,6 +126,72 @@ namespace ltimes_idx {
   RAJA_INDEX_VALUE(IM, "IM");
 }
 
+//
+// Loop nest over dimension dim, 0 (z), 1 (g) or 2 (d), of the kernel
+// segments (d, z, g, m). The d dimension is the m loop around the d loop.
+//
+template < long dim, typename exec_policy, typename inner >
+struct ltimes_layout_for;
+
+template < typename exec_policy, typename inner >
+struct ltimes_layout_for<0, exec_policy, inner>
+{
+  using type = RAJA::statement::For<1, exec_policy, inner>;
+};
+
+template < typename exec_policy, typename inner >
+struct ltimes_layout_for<1, exec_policy, inner>
+{
+  using type = RAJA::statement::For<2, exec_policy, inner>;
+};
+
+template < typename exec_policy, typename inner >
+struct ltimes_layout_for<2, exec_policy, inner>
+{
+  using type = RAJA::statement::For<3, exec_policy,
+                 RAJA::statement::For<0, RAJA::seq_exec, inner> >;
+};
+
+/*!
+ * \brief Helper naming the layout of psi and phi, and the matching kernel
+ *        policy, of a LTIMES layout tuning, used with seq_for to generate
+ *        layout tunings. dim0, dim1, dim2 are the dimensions, 0 (z), 1 (g)
+ *        or 2 (d), from slowest to fastest varying.
+ */
+template < long dim0, long dim1, long dim2 >
+struct ltimes_layout_helper
+{
+  using perm = RAJA::Perm<dim0, dim1, dim2>;
+
+  static const long stride_one_dim = dim2;
+
+  template < typename outer_exec_policy >
+  using exec_policy = RAJA::KernelPolicy<
+      typename ltimes_layout_for<dim0, outer_exec_policy,
+        typename ltimes_layout_for<dim1, RAJA::seq_exec,
+          typename ltimes_layout_for<dim2, RAJA::seq_exec,
+            RAJA::statement::Lambda<0>
+          >::type
+        >::type
+      >::type
+    >;
+
+  static std::string get_name()
+  {
+    const char dim_names[] = "ZGD";
+    return std::string{dim_names[dim0], dim_names[dim1], dim_names[dim2]};
+  }
+};
+
+//
+// Layout tunings other than the default "ZGD".
+//
+using ltimes_layout_helpers = camp::list< ltimes_layout_helper<0, 2, 1>,
+                                          ltimes_layout_helper<1, 0, 2>,
+                                          ltimes_layout_helper<1, 2, 0>,
+                                          ltimes_layout_helper<2, 0, 1>,
+                                          ltimes_layout_helper<2, 1, 0> >;
+
 class LTIMES : public KernelBase
 {
 public:
@@ -117,6 +210,15 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename layout_helper >
+  void runSeqVariantLayout(VariantID vid);
+  template < typename layout_helper >
+  void runOpenMPVariantLayout(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
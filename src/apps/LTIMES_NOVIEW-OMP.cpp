@@ -18,7 +18,7 @@ namespace apps
 {
 
 
-void LTIMES_NOVIEW::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES_NOVIEW::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -119,5 +119,100 @@ void LTIMES_NOVIEW::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+//
+// One matrix product per zone, with ell transposed.
+//
+void LTIMES_NOVIEW::runOpenMPVariantBatchedGemm(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  LTIMES_NOVIEW_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      Real_ptr ellt;
+      allocData(ellt, m_elllen, vid);
+      for (Index_type m = 0; m < num_m; ++m ) {
+        for (Index_type d = 0; d < num_d; ++d ) {
+          ellt[m + (d * num_m)] = elldat[d + (m * num_d)];
+        }
+      }
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type z = 0; z < num_z; ++z ) {
+          for (Index_type g = 0; g < num_g; ++g ) {
+            Real_ptr phi_zg = phidat + (g * num_m) + (z * num_m * num_g);
+            for (Index_type d = 0; d < num_d; ++d ) {
+              const Real_type psi_zgd =
+                  psidat[d + (g * num_d) + (z * num_d * num_g)];
+              for (Index_type m = 0; m < num_m; ++m ) {
+                LTIMES_NOVIEW_BODY_GEMM;
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      deallocData(ellt, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n LTIMES_NOVIEW : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void LTIMES_NOVIEW::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantBatchedGemm(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void LTIMES_NOVIEW::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    addVariantTuningName(vid, "batched_gemm");
+
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -22,6 +22,16 @@
 ///   }
 /// }
 ///
+/// For each zone z this is the matrix product
+///
+///   phi_z[g][m] += sum_d psi_z[g][d] * ell[m][d]
+///
+/// of psi_z (num_g x num_d) and the transpose of ell (num_d x num_m). The
+/// "batched_gemm" tuning computes it as a batch of num_z products with ell
+/// transposed before timing, looping over g, d, m so the m loop is
+/// contiguous in phi and ell. Each phi value sums over d in the same order
+/// as the default tuning.
+///
 
 #ifndef RAJAPerf_Apps_LTIMES_NOVIEW_HPP
 #define RAJAPerf_Apps_LTIMES_NOVIEW_HPP
@@ -40,6 +50,9 @@
   phidat[m+ (g * num_m) + (z * num_m * num_g)] += \
     elldat[d+ (m * num_d)] * psidat[d+ (g * num_d) + (z * num_d * num_g)];
 
+#define LTIMES_NOVIEW_BODY_GEMM \
+  phi_zg[m] += ellt[m + (d * num_m)] * psi_zgd;
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf
@@ -67,6 +80,13 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runSeqVariantBatchedGemm(VariantID vid);
+  void runOpenMPVariantBatchedGemm(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
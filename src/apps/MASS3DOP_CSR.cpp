@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MASS3DOP_CSR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+MASS3DOP_CSR::MASS3DOP_CSR(const RunParams& params)
+  : KernelBase(rajaperf::Apps_MASS3DOP_CSR, params)
+{
+  setDefaultProblemSize(125000);
+  setDefaultReps(20);
+
+  m_nex = getMassOperatorNumElements1D(getTargetProblemSize());
+  m_NE = m_nex * m_nex * m_nex;
+  m_ndofs = getMassOperatorNumDofs1D(m_nex) *
+            getMassOperatorNumDofs1D(m_nex) *
+            getMassOperatorNumDofs1D(m_nex);
+  m_nnz = getMassOperatorNnz(m_nex);
+
+  setActualProblemSize( m_ndofs );
+
+  setItsPerRep( m_ndofs );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Index_type) + 1*sizeof(Index_type)) * (m_ndofs+1) +
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * m_nnz +
+                  (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * m_nnz +
+                  (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * m_ndofs +
+                  (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * m_ndofs );
+  setFLOPsPerRep(2 * m_nnz);
+
+  m_operator_bytes_metric = addMetricName("operator bytes per DOF");
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+MASS3DOP_CSR::~MASS3DOP_CSR()
+{
+}
+
+void MASS3DOP_CSR::setUp(VariantID vid, size_t tune_idx)
+{
+  Real_ptr B;
+  Real_ptr D;
+  Real_ptr M;
+  allocData(B, MOP_Q1D*MOP_D1D, vid);
+  allocData(D, MOP_Q3D*m_NE, vid);
+  allocData(M, MOP_D3D*MOP_D3D*m_NE, vid);
+  setMassOperatorBasis(B);
+  setMassOperatorQuadData(m_nex, D);
+  setMassOperatorElementMatrices(m_nex, B, D, M);
+
+  allocData(m_row_ptr, m_ndofs+1, vid);
+  allocData(m_cols, m_nnz, vid);
+  allocData(m_vals, m_nnz, vid);
+  setMassOperatorCSR(m_nex, M, m_row_ptr, m_cols, m_vals);
+
+  deallocData(B, vid);
+  deallocData(D, vid);
+  deallocData(M, vid);
+
+  allocAndInitData(m_x, m_ndofs, vid);
+  allocAndInitDataConst(m_y, m_ndofs, 0.0, vid);
+
+  // the operator is stored as the CSR matrix
+  setMetric(vid, tune_idx, m_operator_bytes_metric,
+            static_cast<double>((m_ndofs+1) * sizeof(Index_type) +
+                                m_nnz * (sizeof(Index_type) + sizeof(Real_type))) /
+            m_ndofs);
+}
+
+void MASS3DOP_CSR::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_ndofs, vid);
+}
+
+void MASS3DOP_CSR::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_row_ptr, vid);
+  deallocData(m_cols, vid);
+  deallocData(m_vals, vid);
+
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
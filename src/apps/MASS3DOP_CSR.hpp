@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MASS3DOP_CSR kernel reference implementation:
+///
+/// for (Index_type g = 0; g < ndofs; ++g ) {
+///   Real_type dot = 0.0;
+///   for (Index_type k = row_ptr[g]; k < row_ptr[g+1]; ++k ) {
+///     dot += vals[k] * x[cols[k]];
+///   }
+///   y[g] = dot;
+/// }
+///
+/// Applies the mass operator of apps/MassOperatorData.hpp as a globally
+/// assembled CSR matrix, assembled from the element matrices before
+/// timing. Compare with MASS3DOP_PA and MASS3DOP_EA, which apply the same
+/// operator to the same vector.
+///
+
+#ifndef RAJAPerf_Apps_MASS3DOP_CSR_HPP
+#define RAJAPerf_Apps_MASS3DOP_CSR_HPP
+
+#define MASS3DOP_CSR_DATA_SETUP \
+  Index_ptr row_ptr = m_row_ptr; \
+  Index_ptr cols = m_cols; \
+  Real_ptr vals = m_vals; \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Index_type ndofs = m_ndofs;
+
+#define MASS3DOP_CSR_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = row_ptr[g]; k < row_ptr[g+1]; ++k ) { \
+    dot += vals[k] * x[cols[k]]; \
+  } \
+  y[g] = dot;
+
+
+#include "common/KernelBase.hpp"
+#include "MassOperatorData.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class MASS3DOP_CSR : public KernelBase
+{
+public:
+
+  MASS3DOP_CSR(const RunParams& params);
+
+  ~MASS3DOP_CSR();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS3DOP_CSR : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS3DOP_CSR : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS3DOP_CSR : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Index_type m_nex;
+  Index_type m_NE;
+  Index_type m_ndofs;
+
+  // kernel metric of the bytes of operator storage per DOF
+  size_t m_operator_bytes_metric;
+
+  Index_type m_nnz;
+
+  Index_ptr m_row_ptr;
+  Index_ptr m_cols;
+  Real_ptr m_vals;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MASS3DOP_EA.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void MASS3DOP_EA::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  MASS3DOP_EA_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < MOP_D3D*NE; ++i ) {
+          MASS3DOP_GATHER_BODY;
+        }
+
+        for (Index_type e = 0; e < NE; ++e ) {
+          MASS3DOP_EA_BODY;
+        }
+
+        for (Index_type g = 0; g < ndofs; ++g ) {
+          MASS3DOP_SCATTER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, MOP_D3D*NE), [=](Index_type i) {
+          MASS3DOP_GATHER_BODY;
+        });
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, NE), [=](Index_type e) {
+          MASS3DOP_EA_BODY;
+        });
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, ndofs), [=](Index_type g) {
+          MASS3DOP_SCATTER_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  MASS3DOP_EA : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
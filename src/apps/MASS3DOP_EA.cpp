@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MASS3DOP_EA.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+MASS3DOP_EA::MASS3DOP_EA(const RunParams& params)
+  : KernelBase(rajaperf::Apps_MASS3DOP_EA, params)
+{
+  setDefaultProblemSize(125000);
+  setDefaultReps(20);
+
+  m_nex = getMassOperatorNumElements1D(getTargetProblemSize());
+  m_NE = m_nex * m_nex * m_nex;
+  m_ndofs = getMassOperatorNumDofs1D(m_nex) *
+            getMassOperatorNumDofs1D(m_nex) *
+            getMassOperatorNumDofs1D(m_nex);
+
+  setActualProblemSize( m_ndofs );
+
+  setItsPerRep( m_ndofs );
+  setKernelsPerRep(3);
+  setBytesPerRep( (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * MOP_D3D*MOP_D3D*m_NE +
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * MOP_D3D*m_NE +
+                  (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * m_ndofs +
+                  (1*sizeof(Real_type)  + 1*sizeof(Real_type) ) * MOP_D3D*m_NE +
+                  (1*sizeof(Real_type)  + 1*sizeof(Real_type) ) * MOP_D3D*m_NE +
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * (m_ndofs+1) +
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * MOP_D3D*m_NE +
+                  (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * m_ndofs );
+  setFLOPsPerRep(m_NE * 2 * MOP_D3D * MOP_D3D +
+                 m_NE * MOP_D3D );
+
+  m_operator_bytes_metric = addMetricName("operator bytes per DOF");
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+MASS3DOP_EA::~MASS3DOP_EA()
+{
+}
+
+void MASS3DOP_EA::setUp(VariantID vid, size_t tune_idx)
+{
+  Real_ptr B;
+  Real_ptr D;
+  allocData(B, MOP_Q1D*MOP_D1D, vid);
+  allocData(D, MOP_Q3D*m_NE, vid);
+  setMassOperatorBasis(B);
+  setMassOperatorQuadData(m_nex, D);
+
+  allocData(m_M, MOP_D3D*MOP_D3D*m_NE, vid);
+  setMassOperatorElementMatrices(m_nex, B, D, m_M);
+
+  deallocData(B, vid);
+  deallocData(D, vid);
+
+  allocData(m_gather_map, MOP_D3D*m_NE, vid);
+  allocData(m_scatter_offsets, m_ndofs+1, vid);
+  allocData(m_scatter_indices, MOP_D3D*m_NE, vid);
+  setMassOperatorRestriction(m_nex, m_gather_map, m_scatter_offsets, m_scatter_indices);
+
+  allocAndInitDataConst(m_X, MOP_D3D*m_NE, 0.0, vid);
+  allocAndInitDataConst(m_Y, MOP_D3D*m_NE, 0.0, vid);
+
+  allocAndInitData(m_x, m_ndofs, vid);
+  allocAndInitDataConst(m_y, m_ndofs, 0.0, vid);
+
+  // the operator is stored as the element matrices
+  setMetric(vid, tune_idx, m_operator_bytes_metric,
+            static_cast<double>(MOP_D3D*MOP_D3D*m_NE * sizeof(Real_type)) / m_ndofs);
+}
+
+void MASS3DOP_EA::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_ndofs, vid);
+}
+
+void MASS3DOP_EA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_M, vid);
+  deallocData(m_X, vid);
+  deallocData(m_Y, vid);
+  deallocData(m_gather_map, vid);
+  deallocData(m_scatter_offsets, vid);
+  deallocData(m_scatter_indices, vid);
+
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,123 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MASS3DOP_EA kernel reference implementation:
+///
+/// for (Index_type i = 0; i < MOP_D3D*NE; ++i ) {
+///   X[i] = x[gather_map[i]];
+/// }
+///
+/// for (Index_type e = 0; e < NE; ++e ) {
+///   for (Index_type i = 0; i < MOP_D3D; ++i ) {
+///     Real_type dot = 0.0;
+///     for (Index_type j = 0; j < MOP_D3D; ++j ) {
+///       dot += M[j + MOP_D3D*(i + MOP_D3D*e)] * X[j + MOP_D3D*e];
+///     }
+///     Y[i + MOP_D3D*e] = dot;
+///   }
+/// }
+///
+/// for (Index_type g = 0; g < ndofs; ++g ) {
+///   y[g] = sum of Y[scatter_indices[k]],
+///          k in [scatter_offsets[g], scatter_offsets[g+1])
+/// }
+///
+/// Applies the mass operator of apps/MassOperatorData.hpp by element
+/// assembly, storing a dense matrix for each element, assembled before
+/// timing. Compare with MASS3DOP_PA and MASS3DOP_CSR, which apply the same
+/// operator to the same vector.
+///
+
+#ifndef RAJAPerf_Apps_MASS3DOP_EA_HPP
+#define RAJAPerf_Apps_MASS3DOP_EA_HPP
+
+#define MASS3DOP_EA_DATA_SETUP \
+  Real_ptr M = m_M; \
+  Real_ptr X = m_X; \
+  Real_ptr Y = m_Y; \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Index_ptr gather_map = m_gather_map; \
+  Index_ptr scatter_offsets = m_scatter_offsets; \
+  Index_ptr scatter_indices = m_scatter_indices; \
+  Index_type NE = m_NE; \
+  Index_type ndofs = m_ndofs;
+
+#define MASS3DOP_EA_BODY \
+  for (Index_type i = 0; i < MOP_D3D; ++i ) { \
+    Real_type dot = 0.0; \
+    for (Index_type j = 0; j < MOP_D3D; ++j ) { \
+      dot += M[j + MOP_D3D*(i + MOP_D3D*e)] * X[j + MOP_D3D*e]; \
+    } \
+    Y[i + MOP_D3D*e] = dot; \
+  }
+
+
+#include "common/KernelBase.hpp"
+#include "MassOperatorData.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class MASS3DOP_EA : public KernelBase
+{
+public:
+
+  MASS3DOP_EA(const RunParams& params);
+
+  ~MASS3DOP_EA();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS3DOP_EA : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS3DOP_EA : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS3DOP_EA : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Index_type m_nex;
+  Index_type m_NE;
+  Index_type m_ndofs;
+
+  // kernel metric of the bytes of operator storage per DOF
+  size_t m_operator_bytes_metric;
+
+  Real_ptr m_M;
+  Real_ptr m_X;
+  Real_ptr m_Y;
+  Index_ptr m_gather_map;
+  Index_ptr m_scatter_offsets;
+  Index_ptr m_scatter_indices;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MASS3DOP_PA.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+MASS3DOP_PA::MASS3DOP_PA(const RunParams& params)
+  : KernelBase(rajaperf::Apps_MASS3DOP_PA, params)
+{
+  setDefaultProblemSize(125000);
+  setDefaultReps(20);
+
+  m_nex = getMassOperatorNumElements1D(getTargetProblemSize());
+  m_NE = m_nex * m_nex * m_nex;
+  m_ndofs = getMassOperatorNumDofs1D(m_nex) *
+            getMassOperatorNumDofs1D(m_nex) *
+            getMassOperatorNumDofs1D(m_nex);
+
+  setActualProblemSize( m_ndofs );
+
+  setItsPerRep( m_ndofs );
+  setKernelsPerRep(3);
+  setBytesPerRep( (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * MOP_Q1D*MOP_D1D +
+                  (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * MOP_Q3D*m_NE +
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * MOP_D3D*m_NE +
+                  (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * m_ndofs +
+                  (1*sizeof(Real_type)  + 1*sizeof(Real_type) ) * MOP_D3D*m_NE +
+                  (1*sizeof(Real_type)  + 1*sizeof(Real_type) ) * MOP_D3D*m_NE +
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * (m_ndofs+1) +
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * MOP_D3D*m_NE +
+                  (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * m_ndofs );
+  setFLOPsPerRep(m_NE * (2 * MOP_D1D * MOP_D1D * MOP_D1D * MOP_Q1D +
+                         2 * MOP_D1D * MOP_D1D * MOP_Q1D * MOP_Q1D +
+                         2 * MOP_D1D * MOP_Q1D * MOP_Q1D * MOP_Q1D + MOP_Q1D * MOP_Q1D * MOP_Q1D +
+                         2 * MOP_Q1D * MOP_Q1D * MOP_Q1D * MOP_D1D +
+                         2 * MOP_Q1D * MOP_Q1D * MOP_D1D * MOP_D1D +
+                         2 * MOP_Q1D * MOP_D1D * MOP_D1D * MOP_D1D) +
+                 m_NE * MOP_D3D );
+
+  m_operator_bytes_metric = addMetricName("operator bytes per DOF");
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+MASS3DOP_PA::~MASS3DOP_PA()
+{
+}
+
+void MASS3DOP_PA::setUp(VariantID vid, size_t tune_idx)
+{
+  allocData(m_B, MOP_Q1D*MOP_D1D, vid);
+  allocData(m_D, MOP_Q3D*m_NE, vid);
+  setMassOperatorBasis(m_B);
+  setMassOperatorQuadData(m_nex, m_D);
+
+  allocData(m_gather_map, MOP_D3D*m_NE, vid);
+  allocData(m_scatter_offsets, m_ndofs+1, vid);
+  allocData(m_scatter_indices, MOP_D3D*m_NE, vid);
+  setMassOperatorRestriction(m_nex, m_gather_map, m_scatter_offsets, m_scatter_indices);
+
+  allocAndInitDataConst(m_X, MOP_D3D*m_NE, 0.0, vid);
+  allocAndInitDataConst(m_Y, MOP_D3D*m_NE, 0.0, vid);
+
+  allocAndInitData(m_x, m_ndofs, vid);
+  allocAndInitDataConst(m_y, m_ndofs, 0.0, vid);
+
+  // the operator is stored as the basis and quadrature data
+  setMetric(vid, tune_idx, m_operator_bytes_metric,
+            static_cast<double>((MOP_Q1D*MOP_D1D + MOP_Q3D*m_NE) * sizeof(Real_type)) / m_ndofs);
+}
+
+void MASS3DOP_PA::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_ndofs, vid);
+}
+
+void MASS3DOP_PA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_B, vid);
+  deallocData(m_D, vid);
+  deallocData(m_X, vid);
+  deallocData(m_Y, vid);
+  deallocData(m_gather_map, vid);
+  deallocData(m_scatter_offsets, vid);
+  deallocData(m_scatter_indices, vid);
+
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
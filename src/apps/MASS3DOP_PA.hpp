@@ -0,0 +1,196 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MASS3DOP_PA kernel reference implementation:
+///
+/// for (Index_type i = 0; i < MOP_D3D*NE; ++i ) {
+///   X[i] = x[gather_map[i]];
+/// }
+///
+/// for (Index_type e = 0; e < NE; ++e ) {
+///   // Y_e = B^T D_e B X_e by sum factorization, contracting one
+///   // direction at a time
+///   for (dz, dy, qx) DDQ[dz][dy][qx] = sum_dx B(qx,dx) X_e(dx,dy,dz)
+///   for (dz, qy, qx) DQQ[dz][qy][qx] = sum_dy B(qy,dy) DDQ[dz][dy][qx]
+///   for (qz, qy, qx) QQQ[qz][qy][qx] = D_e(qx,qy,qz) *
+///                                      sum_dz B(qz,dz) DQQ[dz][qy][qx]
+///   for (qz, qy, dx) QQD[qz][qy][dx] = sum_qx B(qx,dx) QQQ[qz][qy][qx]
+///   for (qz, dy, dx) QDD[qz][dy][dx] = sum_qy B(qy,dy) QQD[qz][qy][dx]
+///   for (dz, dy, dx) Y_e(dx,dy,dz)   = sum_qz B(qz,dz) QDD[qz][dy][dx]
+/// }
+///
+/// for (Index_type g = 0; g < ndofs; ++g ) {
+///   y[g] = sum of Y[scatter_indices[k]],
+///          k in [scatter_offsets[g], scatter_offsets[g+1])
+/// }
+///
+/// Applies the mass operator of apps/MassOperatorData.hpp by partial
+/// assembly, storing only the quadrature data of each element. Compare
+/// with MASS3DOP_EA and MASS3DOP_CSR, which apply the same operator to the
+/// same vector.
+///
+
+#ifndef RAJAPerf_Apps_MASS3DOP_PA_HPP
+#define RAJAPerf_Apps_MASS3DOP_PA_HPP
+
+#define MASS3DOP_PA_DATA_SETUP \
+  Real_ptr B = m_B; \
+  Real_ptr D = m_D; \
+  Real_ptr X = m_X; \
+  Real_ptr Y = m_Y; \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Index_ptr gather_map = m_gather_map; \
+  Index_ptr scatter_offsets = m_scatter_offsets; \
+  Index_ptr scatter_indices = m_scatter_indices; \
+  Index_type NE = m_NE; \
+  Index_type ndofs = m_ndofs;
+
+#define B_MOP_(q, d) B[q + MOP_Q1D * d]
+
+#define MASS3DOP_PA_BODY \
+  Real_type DDQ[MOP_D1D][MOP_D1D][MOP_Q1D]; \
+  Real_type DQQ[MOP_D1D][MOP_Q1D][MOP_Q1D]; \
+  Real_type QQQ[MOP_Q1D][MOP_Q1D][MOP_Q1D]; \
+  Real_type QQD[MOP_Q1D][MOP_Q1D][MOP_D1D]; \
+  Real_type QDD[MOP_Q1D][MOP_D1D][MOP_D1D]; \
+  Real_ptr Xe = X + MOP_D3D * e; \
+  Real_ptr Ye = Y + MOP_D3D * e; \
+  Real_ptr De = D + MOP_Q3D * e; \
+  for (int dz = 0; dz < MOP_D1D; ++dz) { \
+    for (int dy = 0; dy < MOP_D1D; ++dy) { \
+      for (int qx = 0; qx < MOP_Q1D; ++qx) { \
+        Real_type u = 0.0; \
+        for (int dx = 0; dx < MOP_D1D; ++dx) { \
+          u += B_MOP_(qx, dx) * Xe[dx + MOP_D1D * (dy + MOP_D1D * dz)]; \
+        } \
+        DDQ[dz][dy][qx] = u; \
+      } \
+    } \
+  } \
+  for (int dz = 0; dz < MOP_D1D; ++dz) { \
+    for (int qy = 0; qy < MOP_Q1D; ++qy) { \
+      for (int qx = 0; qx < MOP_Q1D; ++qx) { \
+        Real_type u = 0.0; \
+        for (int dy = 0; dy < MOP_D1D; ++dy) { \
+          u += B_MOP_(qy, dy) * DDQ[dz][dy][qx]; \
+        } \
+        DQQ[dz][qy][qx] = u; \
+      } \
+    } \
+  } \
+  for (int qz = 0; qz < MOP_Q1D; ++qz) { \
+    for (int qy = 0; qy < MOP_Q1D; ++qy) { \
+      for (int qx = 0; qx < MOP_Q1D; ++qx) { \
+        Real_type u = 0.0; \
+        for (int dz = 0; dz < MOP_D1D; ++dz) { \
+          u += B_MOP_(qz, dz) * DQQ[dz][qy][qx]; \
+        } \
+        QQQ[qz][qy][qx] = u * De[qx + MOP_Q1D * (qy + MOP_Q1D * qz)]; \
+      } \
+    } \
+  } \
+  for (int qz = 0; qz < MOP_Q1D; ++qz) { \
+    for (int qy = 0; qy < MOP_Q1D; ++qy) { \
+      for (int dx = 0; dx < MOP_D1D; ++dx) { \
+        Real_type u = 0.0; \
+        for (int qx = 0; qx < MOP_Q1D; ++qx) { \
+          u += B_MOP_(qx, dx) * QQQ[qz][qy][qx]; \
+        } \
+        QQD[qz][qy][dx] = u; \
+      } \
+    } \
+  } \
+  for (int qz = 0; qz < MOP_Q1D; ++qz) { \
+    for (int dy = 0; dy < MOP_D1D; ++dy) { \
+      for (int dx = 0; dx < MOP_D1D; ++dx) { \
+        Real_type u = 0.0; \
+        for (int qy = 0; qy < MOP_Q1D; ++qy) { \
+          u += B_MOP_(qy, dy) * QQD[qz][qy][dx]; \
+        } \
+        QDD[qz][dy][dx] = u; \
+      } \
+    } \
+  } \
+  for (int dz = 0; dz < MOP_D1D; ++dz) { \
+    for (int dy = 0; dy < MOP_D1D; ++dy) { \
+      for (int dx = 0; dx < MOP_D1D; ++dx) { \
+        Real_type u = 0.0; \
+        for (int qz = 0; qz < MOP_Q1D; ++qz) { \
+          u += B_MOP_(qz, dz) * QDD[qz][dy][dx]; \
+        } \
+        Ye[dx + MOP_D1D * (dy + MOP_D1D * dz)] = u; \
+      } \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+#include "MassOperatorData.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class MASS3DOP_PA : public KernelBase
+{
+public:
+
+  MASS3DOP_PA(const RunParams& params);
+
+  ~MASS3DOP_PA();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS3DOP_PA : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS3DOP_PA : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS3DOP_PA : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Index_type m_nex;
+  Index_type m_NE;
+  Index_type m_ndofs;
+
+  // kernel metric of the bytes of operator storage per DOF
+  size_t m_operator_bytes_metric;
+
+  Real_ptr m_B;
+  Real_ptr m_D;
+  Real_ptr m_X;
+  Real_ptr m_Y;
+  Index_ptr m_gather_map;
+  Index_ptr m_scatter_offsets;
+  Index_ptr m_scatter_indices;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
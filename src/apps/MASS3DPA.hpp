@@ -151,6 +151,10 @@
 ///
 /// } // element loop
 ///
+/// The Base_Seq and Base_OpenMP variants have "simd_4" and "simd_8"
+/// tunings that apply the operator to batches of 4 or 8 elements, one per
+/// SIMD lane, in an element interleaved copy of the data (FEM_SIMD.hpp).
+///
 
 #ifndef RAJAPerf_Apps_MASS3DPA_HPP
 #define RAJAPerf_Apps_MASS3DPA_HPP
@@ -165,6 +169,7 @@ Index_type NE = m_NE;
 
 #include "common/KernelBase.hpp"
 #include "FEM_MACROS.hpp"
+#include "FEM_SIMD.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -339,6 +344,116 @@ for (int qz = 0; qz < MPA_Q1D; ++qz) { \
             }
 
 
+//
+// Body for the batch eb of W elements of the "simd_<W>" tunings, with
+// the element data in the element interleaved arrays Xs, Ds and Ys.
+//
+#define MASS3DPA_SIMD_BODY(W)                                           \
+  constexpr int MQ1 = MPA_Q1D;                                          \
+  constexpr int MD1 = MPA_D1D;                                          \
+  double sDQ[MQ1 * MD1];                                                \
+  double(*Bsmem)[MD1] = (double(*)[MD1])sDQ;                            \
+  double(*Btsmem)[MQ1] = (double(*)[MQ1])sDQ;                           \
+  double DDQ[MD1][MD1][MQ1][W];                                         \
+  double DQQ[MD1][MQ1][MQ1][W];                                         \
+  double QQQ[MQ1][MQ1][MQ1][W];                                         \
+  double QQD[MQ1][MQ1][MD1][W];                                         \
+  double QDD[MQ1][MD1][MD1][W];                                         \
+  Real_ptr Xb = Xs + eb * MD1 * MD1 * MD1 * W;                          \
+  Real_ptr Yb = Ys + eb * MD1 * MD1 * MD1 * W;                          \
+  Real_ptr Db = Ds + eb * MQ1 * MQ1 * MQ1 * W;                          \
+  CPU_FOREACH(dy, y, MPA_D1D) {                                         \
+    CPU_FOREACH(dx, x, MPA_Q1D) {                                       \
+      MASS3DPA_2                                                        \
+    }                                                                   \
+  }                                                                     \
+  CPU_FOREACH(dz, z, MPA_D1D) {                                         \
+    CPU_FOREACH(dy, y, MPA_D1D) {                                       \
+      CPU_FOREACH(qx, x, MPA_Q1D) {                                     \
+        double u[W];                                                    \
+        FEM_SIMD_LANES(l, W) { u[l] = 0.0; }                            \
+        for (int dx = 0; dx < MPA_D1D; ++dx) {                          \
+          const double bq = Bsmem[qx][dx];                              \
+          Real_ptr Xd = Xb + (dx + MPA_D1D * (dy + MPA_D1D * dz)) * W;  \
+          FEM_SIMD_LANES(l, W) { u[l] += Xd[l] * bq; }                  \
+        }                                                               \
+        FEM_SIMD_LANES(l, W) { DDQ[dz][dy][qx][l] = u[l]; }             \
+      }                                                                 \
+    }                                                                   \
+  }                                                                     \
+  CPU_FOREACH(dz, z, MPA_D1D) {                                         \
+    CPU_FOREACH(qy, y, MPA_Q1D) {                                       \
+      CPU_FOREACH(qx, x, MPA_Q1D) {                                     \
+        double u[W];                                                    \
+        FEM_SIMD_LANES(l, W) { u[l] = 0.0; }                            \
+        for (int dy = 0; dy < MPA_D1D; ++dy) {                          \
+          const double bq = Bsmem[qy][dy];                              \
+          FEM_SIMD_LANES(l, W) { u[l] += DDQ[dz][dy][qx][l] * bq; }     \
+        }                                                               \
+        FEM_SIMD_LANES(l, W) { DQQ[dz][qy][qx][l] = u[l]; }             \
+      }                                                                 \
+    }                                                                   \
+  }                                                                     \
+  CPU_FOREACH(qz, z, MPA_Q1D) {                                         \
+    CPU_FOREACH(qy, y, MPA_Q1D) {                                       \
+      CPU_FOREACH(qx, x, MPA_Q1D) {                                     \
+        double u[W];                                                    \
+        FEM_SIMD_LANES(l, W) { u[l] = 0.0; }                            \
+        for (int dz = 0; dz < MPA_D1D; ++dz) {                          \
+          const double bq = Bsmem[qz][dz];                              \
+          FEM_SIMD_LANES(l, W) { u[l] += DQQ[dz][qy][qx][l] * bq; }     \
+        }                                                               \
+        Real_ptr Dq = Db + (qx + MPA_Q1D * (qy + MPA_Q1D * qz)) * W;    \
+        FEM_SIMD_LANES(l, W) { QQQ[qz][qy][qx][l] = u[l] * Dq[l]; }     \
+      }                                                                 \
+    }                                                                   \
+  }                                                                     \
+  CPU_FOREACH(d, y, MPA_D1D) {                                          \
+    CPU_FOREACH(q, x, MPA_Q1D) {                                        \
+      MASS3DPA_6                                                        \
+    }                                                                   \
+  }                                                                     \
+  CPU_FOREACH(qz, z, MPA_Q1D) {                                         \
+    CPU_FOREACH(qy, y, MPA_Q1D) {                                       \
+      CPU_FOREACH(dx, x, MPA_D1D) {                                     \
+        double u[W];                                                    \
+        FEM_SIMD_LANES(l, W) { u[l] = 0.0; }                            \
+        for (int qx = 0; qx < MPA_Q1D; ++qx) {                          \
+          const double bt = Btsmem[dx][qx];                             \
+          FEM_SIMD_LANES(l, W) { u[l] += QQQ[qz][qy][qx][l] * bt; }     \
+        }                                                               \
+        FEM_SIMD_LANES(l, W) { QQD[qz][qy][dx][l] = u[l]; }             \
+      }                                                                 \
+    }                                                                   \
+  }                                                                     \
+  CPU_FOREACH(qz, z, MPA_Q1D) {                                         \
+    CPU_FOREACH(dy, y, MPA_D1D) {                                       \
+      CPU_FOREACH(dx, x, MPA_D1D) {                                     \
+        double u[W];                                                    \
+        FEM_SIMD_LANES(l, W) { u[l] = 0.0; }                            \
+        for (int qy = 0; qy < MPA_Q1D; ++qy) {                          \
+          const double bt = Btsmem[dy][qy];                             \
+          FEM_SIMD_LANES(l, W) { u[l] += QQD[qz][qy][dx][l] * bt; }     \
+        }                                                               \
+        FEM_SIMD_LANES(l, W) { QDD[qz][dy][dx][l] = u[l]; }             \
+      }                                                                 \
+    }                                                                   \
+  }                                                                     \
+  CPU_FOREACH(dz, z, MPA_D1D) {                                         \
+    CPU_FOREACH(dy, y, MPA_D1D) {                                       \
+      CPU_FOREACH(dx, x, MPA_D1D) {                                     \
+        double u[W];                                                    \
+        FEM_SIMD_LANES(l, W) { u[l] = 0.0; }                            \
+        for (int qz = 0; qz < MPA_Q1D; ++qz) {                          \
+          const double bt = Btsmem[dz][qz];                             \
+          FEM_SIMD_LANES(l, W) { u[l] += QDD[qz][dy][dx][l] * bt; }     \
+        }                                                               \
+        Real_ptr Yd = Yb + (dx + MPA_D1D * (dy + MPA_D1D * dz)) * W;    \
+        FEM_SIMD_LANES(l, W) { Yd[l] += u[l]; }                         \
+      }                                                                 \
+    }                                                                   \
+  }
+
 namespace rajaperf
 {
 class RunParams;
@@ -364,8 +479,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t W >
+  void runSeqVariantSimd(VariantID vid);
+  template < size_t W >
+  void runOpenMPVariantSimd(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
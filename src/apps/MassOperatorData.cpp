@@ -0,0 +1,287 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MassOperatorData.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+namespace
+{
+
+//
+// Range of elements containing DOF g in one direction, and the range of
+// DOFs in those elements.
+//
+void getElementRange1D(Index_type nex, Index_type g,
+                       Index_type& elo, Index_type& ehi,
+                       Index_type& glo, Index_type& ghi)
+{
+  const Index_type p = MOP_D1D - 1;
+  ehi = std::min(g / p, nex - 1);
+  elo = (g % p == 0 && g > 0) ? g / p - 1 : ehi;
+  glo = p * elo;
+  ghi = p * ehi + p;
+}
+
+} // end anonymous namespace
+
+
+Index_type getMassOperatorNumElements1D(Index_type target_dofs)
+{
+  const Real_type n1d = std::cbrt(static_cast<Real_type>(target_dofs));
+  const Index_type nex = static_cast<Index_type>(
+                           std::lround((n1d - 1.0) / (MOP_D1D - 1)) );
+  return std::max(nex, Index_type(1));
+}
+
+void setMassOperatorBasis(Real_ptr B)
+{
+  // Gauss-Lobatto points on [0, 1] for cubic elements
+  const Real_type s5 = 1.0 / std::sqrt(5.0);
+  const Real_type nodes[MOP_D1D] = { 0.0, 0.5 * (1.0 - s5),
+                                     0.5 * (1.0 + s5), 1.0 };
+
+  // Gauss-Legendre points on [0, 1]
+  const Real_type a = std::sqrt(5.0 - 2.0 * std::sqrt(10.0 / 7.0)) / 3.0;
+  const Real_type b = std::sqrt(5.0 + 2.0 * std::sqrt(10.0 / 7.0)) / 3.0;
+  const Real_type points[MOP_Q1D] = { 0.5 * (1.0 - b), 0.5 * (1.0 - a), 0.5,
+                                      0.5 * (1.0 + a), 0.5 * (1.0 + b) };
+
+  for (Index_type d = 0; d < MOP_D1D; ++d) {
+    for (Index_type q = 0; q < MOP_Q1D; ++q) {
+      Real_type val = 1.0;
+      for (Index_type m = 0; m < MOP_D1D; ++m) {
+        if (m != d) {
+          val *= (points[q] - nodes[m]) / (nodes[d] - nodes[m]);
+        }
+      }
+      B[q + MOP_Q1D * d] = val;
+    }
+  }
+}
+
+void setMassOperatorQuadData(Index_type nex, Real_ptr D)
+{
+  // Gauss-Legendre weights on [0, 1]
+  const Real_type s70 = std::sqrt(70.0);
+  const Real_type wa = 0.5 * (322.0 + 13.0 * s70) / 900.0;
+  const Real_type wb = 0.5 * (322.0 - 13.0 * s70) / 900.0;
+  const Real_type weights[MOP_Q1D] = { wb, wa, 0.5 * 128.0 / 225.0, wa, wb };
+
+  const Real_type h = 1.0 / nex;
+  const Index_type NE = nex * nex * nex;
+
+  for (Index_type e = 0; e < NE; ++e) {
+    const Real_type density = 1.0 + 0.1 * (e % 7);
+    for (Index_type qz = 0; qz < MOP_Q1D; ++qz) {
+      for (Index_type qy = 0; qy < MOP_Q1D; ++qy) {
+        for (Index_type qx = 0; qx < MOP_Q1D; ++qx) {
+          D[qx + MOP_Q1D * (qy + MOP_Q1D * (qz + MOP_Q1D * e))] =
+            weights[qx] * weights[qy] * weights[qz] * h * h * h * density;
+        }
+      }
+    }
+  }
+}
+
+void setMassOperatorRestriction(Index_type nex, Index_ptr gather_map,
+                                Index_ptr scatter_offsets,
+                                Index_ptr scatter_indices)
+{
+  const Index_type p = MOP_D1D - 1;
+  const Index_type ng = getMassOperatorNumDofs1D(nex);
+  const Index_type ndofs = ng * ng * ng;
+  const Index_type NE = nex * nex * nex;
+
+  for (Index_type ez = 0; ez < nex; ++ez) {
+    for (Index_type ey = 0; ey < nex; ++ey) {
+      for (Index_type ex = 0; ex < nex; ++ex) {
+        const Index_type e = ex + nex * (ey + nex * ez);
+        for (Index_type dz = 0; dz < MOP_D1D; ++dz) {
+          for (Index_type dy = 0; dy < MOP_D1D; ++dy) {
+            for (Index_type dx = 0; dx < MOP_D1D; ++dx) {
+              const Index_type l = dx + MOP_D1D * (dy + MOP_D1D * dz);
+              gather_map[l + MOP_D3D * e] =
+                (p*ex + dx) + ng * ((p*ey + dy) + ng * (p*ez + dz));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  for (Index_type g = 0; g <= ndofs; ++g) {
+    scatter_offsets[g] = 0;
+  }
+  for (Index_type i = 0; i < MOP_D3D * NE; ++i) {
+    scatter_offsets[gather_map[i] + 1] += 1;
+  }
+  for (Index_type g = 0; g < ndofs; ++g) {
+    scatter_offsets[g + 1] += scatter_offsets[g];
+  }
+  for (Index_type i = 0; i < MOP_D3D * NE; ++i) {
+    scatter_indices[scatter_offsets[gather_map[i]]++] = i;
+  }
+  for (Index_type g = ndofs; g > 0; --g) {
+    scatter_offsets[g] = scatter_offsets[g - 1];
+  }
+  scatter_offsets[0] = 0;
+}
+
+void setMassOperatorElementMatrices(Index_type nex, Real_ptr B, Real_ptr D,
+                                    Real_ptr M)
+{
+  const Index_type NE = nex * nex * nex;
+
+  // sum factorization over the quadrature points, one direction at a time
+  Real_type Dx[MOP_D1D][MOP_D1D][MOP_Q1D][MOP_Q1D];
+  Real_type Dxy[MOP_D1D][MOP_D1D][MOP_D1D][MOP_D1D][MOP_Q1D];
+
+  for (Index_type e = 0; e < NE; ++e) {
+
+    Real_ptr De = D + MOP_Q3D * e;
+
+    for (Index_type ix = 0; ix < MOP_D1D; ++ix) {
+      for (Index_type jx = 0; jx < MOP_D1D; ++jx) {
+        for (Index_type qz = 0; qz < MOP_Q1D; ++qz) {
+          for (Index_type qy = 0; qy < MOP_Q1D; ++qy) {
+            Real_type val = 0.0;
+            for (Index_type qx = 0; qx < MOP_Q1D; ++qx) {
+              val += B[qx + MOP_Q1D * ix] * B[qx + MOP_Q1D * jx] *
+                     De[qx + MOP_Q1D * (qy + MOP_Q1D * qz)];
+            }
+            Dx[ix][jx][qz][qy] = val;
+          }
+        }
+      }
+    }
+
+    for (Index_type ix = 0; ix < MOP_D1D; ++ix) {
+      for (Index_type jx = 0; jx < MOP_D1D; ++jx) {
+        for (Index_type iy = 0; iy < MOP_D1D; ++iy) {
+          for (Index_type jy = 0; jy < MOP_D1D; ++jy) {
+            for (Index_type qz = 0; qz < MOP_Q1D; ++qz) {
+              Real_type val = 0.0;
+              for (Index_type qy = 0; qy < MOP_Q1D; ++qy) {
+                val += B[qy + MOP_Q1D * iy] * B[qy + MOP_Q1D * jy] *
+                       Dx[ix][jx][qz][qy];
+              }
+              Dxy[ix][jx][iy][jy][qz] = val;
+            }
+          }
+        }
+      }
+    }
+
+    for (Index_type iz = 0; iz < MOP_D1D; ++iz) {
+      for (Index_type iy = 0; iy < MOP_D1D; ++iy) {
+        for (Index_type ix = 0; ix < MOP_D1D; ++ix) {
+          const Index_type i = ix + MOP_D1D * (iy + MOP_D1D * iz);
+          for (Index_type jz = 0; jz < MOP_D1D; ++jz) {
+            for (Index_type jy = 0; jy < MOP_D1D; ++jy) {
+              for (Index_type jx = 0; jx < MOP_D1D; ++jx) {
+                const Index_type j = jx + MOP_D1D * (jy + MOP_D1D * jz);
+                Real_type val = 0.0;
+                for (Index_type qz = 0; qz < MOP_Q1D; ++qz) {
+                  val += B[qz + MOP_Q1D * iz] * B[qz + MOP_Q1D * jz] *
+                         Dxy[ix][jx][iy][jy][qz];
+                }
+                M[j + MOP_D3D * (i + MOP_D3D * e)] = val;
+              }
+            }
+          }
+        }
+      }
+    }
+
+  }
+}
+
+Index_type getMassOperatorNnz(Index_type nex)
+{
+  const Index_type ng = getMassOperatorNumDofs1D(nex);
+
+  // the columns of a row are a box of DOFs, so count them in 1D
+  Index_type nnz1d = 0;
+  for (Index_type g = 0; g < ng; ++g) {
+    Index_type elo, ehi, glo, ghi;
+    getElementRange1D(nex, g, elo, ehi, glo, ghi);
+    nnz1d += ghi - glo + 1;
+  }
+  return nnz1d * nnz1d * nnz1d;
+}
+
+void setMassOperatorCSR(Index_type nex, Real_ptr M,
+                        Index_ptr row_ptr, Index_ptr cols, Real_ptr vals)
+{
+  const Index_type p = MOP_D1D - 1;
+  const Index_type ng = getMassOperatorNumDofs1D(nex);
+
+  Index_type nz = 0;
+  for (Index_type gz = 0; gz < ng; ++gz) {
+    Index_type ezlo, ezhi, zlo, zhi;
+    getElementRange1D(nex, gz, ezlo, ezhi, zlo, zhi);
+    for (Index_type gy = 0; gy < ng; ++gy) {
+      Index_type eylo, eyhi, ylo, yhi;
+      getElementRange1D(nex, gy, eylo, eyhi, ylo, yhi);
+      for (Index_type gx = 0; gx < ng; ++gx) {
+        Index_type exlo, exhi, xlo, xhi;
+        getElementRange1D(nex, gx, exlo, exhi, xlo, xhi);
+
+        const Index_type row = gx + ng * (gy + ng * gz);
+        const Index_type lx = xhi - xlo + 1;
+        const Index_type ly = yhi - ylo + 1;
+
+        row_ptr[row] = nz;
+        for (Index_type cz = zlo; cz <= zhi; ++cz) {
+          for (Index_type cy = ylo; cy <= yhi; ++cy) {
+            for (Index_type cx = xlo; cx <= xhi; ++cx) {
+              cols[nz] = cx + ng * (cy + ng * cz);
+              vals[nz] = 0.0;
+              ++nz;
+            }
+          }
+        }
+
+        // sum the entries of the elements containing the row
+        Real_ptr row_vals = vals + row_ptr[row];
+        for (Index_type ez = ezlo; ez <= ezhi; ++ez) {
+          for (Index_type ey = eylo; ey <= eyhi; ++ey) {
+            for (Index_type ex = exlo; ex <= exhi; ++ex) {
+              const Index_type e = ex + nex * (ey + nex * ez);
+              const Index_type i = (gx - p*ex) +
+                                   MOP_D1D * ((gy - p*ey) + MOP_D1D * (gz - p*ez));
+              for (Index_type jz = 0; jz < MOP_D1D; ++jz) {
+                for (Index_type jy = 0; jy < MOP_D1D; ++jy) {
+                  for (Index_type jx = 0; jx < MOP_D1D; ++jx) {
+                    const Index_type j = jx + MOP_D1D * (jy + MOP_D1D * jz);
+                    const Index_type pos = (p*ex + jx - xlo) +
+                                           lx * ((p*ey + jy - ylo) +
+                                                 ly * (p*ez + jz - zlo));
+                    row_vals[pos] += M[j + MOP_D3D * (i + MOP_D3D * e)];
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+    }
+  }
+  row_ptr[ng * ng * ng] = nz;
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Mesh and mass operator shared by the MASS3DOP kernels, which apply the
+/// same operator y = A x three ways,
+///
+///   MASS3DOP_PA   partial assembly, sum factorization with the basis and
+///                 quadrature data of each element
+///   MASS3DOP_EA   element assembly, a dense matrix for each element
+///   MASS3DOP_CSR  global assembly, a CSR matrix
+///
+/// The mesh is the unit cube split into nex^3 hexahedral elements with
+/// continuous tensor product Lagrange elements of order MOP_D1D - 1 at the
+/// Gauss-Lobatto points, so there are (MOP_D1D-1)*nex + 1 DOFs in each
+/// direction. Element integrals use MOP_Q1D^3 Gauss-Legendre points, with
+/// a density varying by element.
+///
+/// PA and EA gather the DOFs of each element into an E-vector, apply the
+/// element operators to it, and sum the results into y. The sum is taken
+/// for each DOF over the E-vector entries that share it, so it has no
+/// write conflicts.
+///
+/// The kernels set the number of DOFs as the iterations per rep, so the
+/// time per iteration report gives the time per DOF. Each kernel reports
+/// the bytes of its operator storage per DOF as the "operator bytes per
+/// DOF" metric: the quadrature data for PA, the element matrices for EA
+/// and the matrix for CSR.
+///
+
+#ifndef RAJAPerf_Apps_MassOperatorData_HPP
+#define RAJAPerf_Apps_MassOperatorData_HPP
+
+#include "common/RPTypes.hpp"
+
+// Number of DOFs/quadrature points in 1D
+#define MOP_D1D 4
+#define MOP_Q1D 5
+
+// Number of DOFs/quadrature points in an element
+#define MOP_D3D (MOP_D1D * MOP_D1D * MOP_D1D)
+#define MOP_Q3D (MOP_Q1D * MOP_Q1D * MOP_Q1D)
+
+#define MASS3DOP_GATHER_BODY \
+  X[i] = x[gather_map[i]];
+
+#define MASS3DOP_SCATTER_BODY \
+  Real_type sum = 0.0; \
+  for (Index_type k = scatter_offsets[g]; k < scatter_offsets[g+1]; ++k ) { \
+    sum += Y[scatter_indices[k]]; \
+  } \
+  y[g] = sum;
+
+namespace rajaperf
+{
+namespace apps
+{
+
+/*!
+ * \brief Number of elements in each direction of the mesh with about
+ *        target_dofs DOFs.
+ */
+Index_type getMassOperatorNumElements1D(Index_type target_dofs);
+
+/*!
+ * \brief Number of DOFs in each direction of the mesh with nex elements
+ *        in each direction.
+ */
+inline Index_type getMassOperatorNumDofs1D(Index_type nex)
+{
+  return (MOP_D1D - 1) * nex + 1;
+}
+
+/*!
+ * \brief Set the 1D basis values at the quadrature points,
+ *        B[q + MOP_Q1D*d] for DOF d at point q.
+ */
+void setMassOperatorBasis(Real_ptr B);
+
+/*!
+ * \brief Set the quadrature data, weight times Jacobian determinant times
+ *        density, D[q + MOP_Q3D*e] for point q of element e.
+ */
+void setMassOperatorQuadData(Index_type nex, Real_ptr D);
+
+/*!
+ * \brief Set the map from E-vector entries to DOFs and its transpose.
+ *
+ * gather_map[l + MOP_D3D*e] is the DOF of local DOF l of element e, for
+ * nex^3 elements. The E-vector entries of DOF g are scatter_indices[k]
+ * for k in [scatter_offsets[g], scatter_offsets[g+1]), in increasing
+ * order.
+ */
+void setMassOperatorRestriction(Index_type nex, Index_ptr gather_map,
+                                Index_ptr scatter_offsets,
+                                Index_ptr scatter_indices);
+
+/*!
+ * \brief Set the element matrices, M[j + MOP_D3D*(i + MOP_D3D*e)] for
+ *        local DOFs i and j of element e.
+ */
+void setMassOperatorElementMatrices(Index_type nex, Real_ptr B, Real_ptr D,
+                                    Real_ptr M);
+
+/*!
+ * \brief Number of non-zeros of the assembled matrix.
+ */
+Index_type getMassOperatorNnz(Index_type nex);
+
+/*!
+ * \brief Set the CSR arrays of the matrix assembled from the element
+ *        matrices M, with the columns of each row in increasing order.
+ */
+void setMassOperatorCSR(Index_type nex, Real_ptr M,
+                        Index_ptr row_ptr, Index_ptr cols, Real_ptr vals);
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // closing endif for header file include guard
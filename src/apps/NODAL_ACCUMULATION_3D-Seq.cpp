@@ -20,13 +20,14 @@ namespace apps
 {
 
 
-void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename ZoneIndex_type >
+void NODAL_ACCUMULATION_3D::runSeqVariantImpl(VariantID vid, ZoneIndex_type* zone_list)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
 
-  NODAL_ACCUMULATION_3D_DATA_SETUP;
+  NODAL_ACCUMULATION_3D_DATA_SETUP_ZONES(zone_list);
 
   switch ( vid ) {
 
@@ -70,8 +71,8 @@ void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_
     case RAJA_Seq : {
 
       camp::resources::Resource working_res{camp::resources::Host::get_default()};
-      RAJA::TypedListSegment<Index_type> zones(real_zones, iend,
-                                               working_res, RAJA::Unowned);
+      RAJA::TypedListSegment<ZoneIndex_type> zones(real_zones, iend,
+                                                   working_res, RAJA::Unowned);
 
       auto nodal_accumulation_3d_lam = [=](Index_type i) {
                          NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::seq_atomic);
@@ -97,5 +98,48 @@ void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
 }
 
+void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  for (int io = 0; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantImpl(vid, m_real_zones);
+
+    }
+
+    t += 1;
+
+  }
+
+  if (tune_idx == t) {
+
+    const Index_type num_zones = m_domain->n_real_zones;
+
+    Int_ptr real_zones32;
+    allocData(real_zones32, num_zones, vid);
+    copyZonesToInt(real_zones32, m_real_zones, num_zones);
+
+    runSeqVariantImpl(vid, real_zones32);
+
+    deallocData(real_zones32, vid);
+
+  }
+}
+
+void NODAL_ACCUMULATION_3D::setSeqTuningDefinitions(VariantID vid)
+{
+  for (int io = 0; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+    addVariantTuningName(vid, getSFCOrderingName(static_cast<SFCOrdering>(io)));
+  }
+
+  addVariantTuningName(vid, "index32");
+  setVariantTuningBytesPerRep(vid, getNumVariantTunings(vid) - 1,
+      getBytesPerRep() - 1*sizeof(Index_type) * getItsPerRep() +
+                         1*sizeof(Int_type)   * getItsPerRep());
+}
+
 } // end namespace apps
 } // end namespace rajaperf
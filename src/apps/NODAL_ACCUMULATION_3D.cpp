@@ -74,7 +74,7 @@ NODAL_ACCUMULATION_3D::~NODAL_ACCUMULATION_3D()
   delete m_domain;
 }
 
-void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_x, m_nodal_array_length, 0.0, vid);
   allocAndInitDataConst(m_vol, m_zonal_array_length, 1.0, vid);
@@ -85,6 +85,8 @@ void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
     auto reset_rz = scopedMoveData(m_real_zones, m_domain->n_real_zones, vid);
 
     setRealZones_3d(m_real_zones, *m_domain);
+    reorderZones(m_real_zones, m_domain->n_real_zones, *m_domain,
+                 getSFCOrderingFromName(getVariantTuningName(vid, tune_idx)));
   }
 }
 
@@ -27,11 +27,13 @@
 ///
 /// }
 ///
+/// The "index32" tunings read 32-bit zone indices (see apps/AppsData.hpp).
+///
 
 #ifndef RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
 #define RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
 
-#define NODAL_ACCUMULATION_3D_DATA_SETUP \
+#define NODAL_ACCUMULATION_3D_DATA_SETUP_ZONES(zones) \
   Real_ptr x = m_x; \
   Real_ptr vol = m_vol; \
   \
@@ -39,7 +41,10 @@
   \
   NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ; \
   \
-  Index_ptr real_zones = m_real_zones;
+  auto real_zones = zones;
+
+#define NODAL_ACCUMULATION_3D_DATA_SETUP \
+  NODAL_ACCUMULATION_3D_DATA_SETUP_ZONES(m_real_zones)
 
 #define NODAL_ACCUMULATION_3D_BODY_INDEX \
   Index_type i = real_zones[ii];
@@ -98,8 +103,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename ZoneIndex_type >
+  void runSeqVariantImpl(VariantID vid, ZoneIndex_type* zone_list);
+  template < typename ZoneIndex_type >
+  void runOpenMPVariantImpl(VariantID vid, ZoneIndex_type* zone_list);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -12,6 +12,8 @@
 
 #include "AppsData.hpp"
 
+#include "camp/resource.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -20,7 +22,7 @@ namespace apps
 {
 
 
-void VOL3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void VOL3D::runOpenMPVariantRange(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -93,5 +95,128 @@ void VOL3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 #endif
 }
 
+void VOL3D::runOpenMPVariantZones(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_num_zones;
+
+  VOL3D_DATA_SETUP;
+
+  Index_ptr zones = m_zones;
+
+  auto vol3d_lam = [=](Index_type i) {
+                     VOL3D_BODY;
+                   };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          Index_type i = zones[ii];
+          VOL3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          vol3d_lam(zones[ii]);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      camp::resources::Resource working_res{camp::resources::Host::get_default()};
+      RAJA::TypedListSegment<Index_type> zone_list(zones, iend,
+                                                   working_res, RAJA::Unowned);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(zone_list, vol3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  VOL3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void VOL3D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantRange(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantZones(vid);
+
+  }
+
+  t += 1;
+
+  for (int io = 1; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantZones(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void VOL3D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getSFCOrderingName(SFCOrdering::Lexicographic));
+
+  addVariantTuningName(vid, getLexicographicListTuningName());
+
+  for (int io = 1; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+    addVariantTuningName(vid, getSFCOrderingName(static_cast<SFCOrdering>(io)));
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -32,6 +32,8 @@ VOL3D::VOL3D(const RunParams& params)
   m_domain = new ADomain(rzmax, /* ndims = */ 3);
 
   m_array_length = m_domain->nnalls;
+  m_num_zones = m_domain->lpz+1 - m_domain->fpz;
+  m_zones = nullptr;
 
   setActualProblemSize( m_domain->lpz+1 - m_domain->fpz );
 
@@ -71,7 +73,7 @@ VOL3D::~VOL3D()
   delete m_domain;
 }
 
-void VOL3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void VOL3D::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
   allocAndInitDataConst(m_y, m_array_length, 0.0, vid);
@@ -90,6 +92,25 @@ void VOL3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   allocAndInitDataConst(m_vol, m_array_length, 0.0, vid);
 
+  //
+  // Space-filling curve tunings traverse the same zone range through a
+  // reordered index list, and the lexicographic list tuning through an
+  // index list in lexicographic order, so it differs from them only in
+  // ordering.
+  //
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+  SFCOrdering ordering = getSFCOrderingFromName(tuning_name);
+  if (ordering != SFCOrdering::Lexicographic ||
+      tuning_name == getLexicographicListTuningName()) {
+    allocData(m_zones, m_num_zones, vid);
+    auto reset_zones = scopedMoveData(m_zones, m_num_zones, vid);
+
+    for (Index_type ii = 0; ii < m_num_zones; ++ii) {
+      m_zones[ii] = m_domain->fpz + ii;
+    }
+    reorderZones(m_zones, m_num_zones, *m_domain, ordering);
+  }
+
   m_vnormq = 0.083333333333333333; /* vnormq = 1/12 */
 }
 
@@ -106,6 +127,9 @@ void VOL3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_y, vid);
   deallocData(m_z, vid);
   deallocData(m_vol, vid);
+  if (m_zones) {
+    deallocData(m_zones, vid);
+  }
 }
 
 } // end namespace apps
@@ -174,8 +174,17 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  static std::string getLexicographicListTuningName()
+  { return "lexicographic_list"; }
+
+  void runSeqVariantRange(VariantID vid);
+  void runSeqVariantZones(VariantID vid);
+  void runOpenMPVariantRange(VariantID vid);
+  void runOpenMPVariantZones(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -194,6 +203,9 @@ private:
 
   ADomain* m_domain;
   Index_type m_array_length;
+
+  Index_type* m_zones;
+  Index_type m_num_zones;
 };
 
 } // end namespace apps
@@ -20,7 +20,8 @@ namespace apps
 {
 
 
-void ZONAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename ZoneIndex_type >
+void ZONAL_ACCUMULATION_3D::runOpenMPVariantImpl(VariantID vid, ZoneIndex_type* zone_list)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -28,7 +29,7 @@ void ZONAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
 
-  ZONAL_ACCUMULATION_3D_DATA_SETUP;
+  ZONAL_ACCUMULATION_3D_DATA_SETUP_ZONES(zone_list);
 
 
   switch ( vid ) {
@@ -74,8 +75,8 @@ void ZONAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
     case RAJA_OpenMP : {
 
       camp::resources::Resource working_res{camp::resources::Host::get_default()};
-      RAJA::TypedListSegment<Index_type> zones(real_zones, iend,
-                                               working_res, RAJA::Unowned);
+      RAJA::TypedListSegment<ZoneIndex_type> zones(real_zones, iend,
+                                                   working_res, RAJA::Unowned);
 
       auto zonal_accumulation_3d_lam = [=](Index_type i) {
                                          ZONAL_ACCUMULATION_3D_BODY;
@@ -101,8 +102,46 @@ void ZONAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(zone_list);
 #endif
 }
 
+void ZONAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl(vid, m_real_zones);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    const Index_type num_zones = m_domain->n_real_zones;
+
+    Int_ptr real_zones32;
+    allocData(real_zones32, num_zones, vid);
+    copyZonesToInt(real_zones32, m_real_zones, num_zones);
+
+    runOpenMPVariantImpl(vid, real_zones32);
+
+    deallocData(real_zones32, vid);
+
+  }
+}
+
+void ZONAL_ACCUMULATION_3D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  addVariantTuningName(vid, "index32");
+  setVariantTuningBytesPerRep(vid, getNumVariantTunings(vid) - 1,
+      getBytesPerRep() - 1*sizeof(Index_type) * getItsPerRep() +
+                         1*sizeof(Int_type)   * getItsPerRep());
+}
+
 } // end namespace apps
 } // end namespace rajaperf
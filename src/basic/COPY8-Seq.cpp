@@ -10,7 +10,10 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/LayoutUtils.hpp"
+
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +21,7 @@ namespace basic
 {
 
 
-void COPY8::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void COPY8::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -88,5 +91,93 @@ void COPY8::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+template < typename layout_helper >
+void COPY8::runSeqVariantLayout(VariantID vid)
+{
+  using view_type = typename layout_helper::template view_type<Real_type>;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  const Index_type num_comps = 8;
+  std::vector<Real_ptr> x_comps{m_x0, m_x1, m_x2, m_x3, m_x4, m_x5, m_x6, m_x7};
+  std::vector<Real_ptr> y_comps{m_y0, m_y1, m_y2, m_y3, m_y4, m_y5, m_y6, m_y7};
+
+  Real_ptr x_data;
+  Real_ptr y_data;
+  allocData(x_data, view_type::storageSize(num_comps, iend), vid);
+  allocData(y_data, view_type::storageSize(num_comps, iend), vid);
+  view_type xv(x_data, num_comps, iend);
+  view_type yv(y_data, num_comps, iend);
+  copyToLayout(xv, x_comps, iend);
+  copyToLayout(yv, y_comps, iend);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          COPY8_BODY_LAYOUT;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  COPY8 : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  copyFromLayout(y_comps, yv, iend);
+
+  deallocData(x_data, vid);
+  deallocData(y_data, vid);
+}
+
+void COPY8::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    seq_for(layout_helpers{}, [&](auto layout_helper) {
+      if (tune_idx == t) {
+        runSeqVariantLayout<decltype(layout_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void COPY8::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    seq_for(layout_helpers{}, [&](auto layout_helper) {
+      addVariantTuningName(vid, decltype(layout_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -52,6 +52,16 @@
   y6[i] = x6[i] ; \
   y7[i] = x7[i] ;
 
+#define COPY8_BODY_LAYOUT  \
+  yv(0, i) = xv(0, i) ; \
+  yv(1, i) = xv(1, i) ; \
+  yv(2, i) = xv(2, i) ; \
+  yv(3, i) = xv(3, i) ; \
+  yv(4, i) = xv(4, i) ; \
+  yv(5, i) = xv(5, i) ; \
+  yv(6, i) = xv(6, i) ; \
+  yv(7, i) = xv(7, i) ;
+
 
 #include "common/KernelBase.hpp"
 
@@ -81,6 +91,15 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename layout_helper >
+  void runSeqVariantLayout(VariantID vid);
+  template < typename layout_helper >
+  void runOpenMPVariantLayout(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/VectorMathUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace basic
 {
 
 
-void IF_QUAD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void IF_QUAD::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -88,5 +90,78 @@ void IF_QUAD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+#if defined(RAJAPERF_USE_VECMATH)
+void IF_QUAD::runSeqVariantVecMath(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  IF_QUAD_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJAPERF_OMP_SIMD
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          IF_QUAD_BODY_VECMATH;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  IF_QUAD : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+#endif
+
+void IF_QUAD::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+#if defined(RAJAPERF_USE_VECMATH)
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantVecMath(vid);
+
+    }
+
+    t += 1;
+
+  }
+#endif
+}
+
+void IF_QUAD::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+#if defined(RAJAPERF_USE_VECMATH)
+  if (vid == Base_Seq) {
+    addVariantTuningName(vid, vecmath_helper::get_name());
+  }
+#endif
+}
+
 } // end namespace basic
 } // end namespace rajaperf
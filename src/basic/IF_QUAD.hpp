@@ -43,6 +43,12 @@
     x1[i] = 0.0; \
   }
 
+#define IF_QUAD_BODY_VECMATH  \
+  Real_type s = b[i]*b[i] - 4.0*a[i]*c[i]; \
+  Real_type sq = vecmath::sqrt(vecmath::selectNonNegative(s, s, 0.0)); \
+  x2[i] = vecmath::selectNonNegative(s, (-b[i]+sq)/(2.0*a[i]), 0.0); \
+  x1[i] = vecmath::selectNonNegative(s, (-b[i]-sq)/(2.0*a[i]), 0.0);
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf
@@ -71,6 +77,13 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runSeqVariantVecMath(VariantID vid);
+  void runOpenMPVariantVecMath(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
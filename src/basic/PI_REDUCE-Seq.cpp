@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/ReproducibleSumUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace basic
 {
 
 
-void PI_REDUCE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PI_REDUCE::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -101,5 +103,86 @@ void PI_REDUCE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+template < typename sum_helper >
+void PI_REDUCE::runSeqVariantReproducible(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_REDUCE_DATA_SETUP;
+
+  auto pireduce_term_lam = [=](Index_type i) {
+    double x = (double(i) + 0.5) * dx;
+    return dx / (1.0 + x * x);
+  };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      Real_ptr work;
+      allocData(work, sum_helper::workspaceSize(iend - ibegin), vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sum = sum_helper::sumSeq(ibegin, iend,
+                                           pireduce_term_lam, work);
+
+        m_pi = 4.0 * (m_pi_init + sum);
+
+      }
+      stopTimer();
+
+      deallocData(work, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PI_REDUCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void PI_REDUCE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    seq_for(reproducible_sum_helpers{}, [&](auto sum_helper) {
+      if (tune_idx == t) {
+        runSeqVariantReproducible<decltype(sum_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void PI_REDUCE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    seq_for(reproducible_sum_helpers{}, [&](auto sum_helper) {
+      addVariantTuningName(vid, decltype(sum_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -19,6 +19,9 @@
 /// }
 /// pi *= 4.0;
 ///
+/// The "pairwise" and "binned" tunings compute the sum so its bits do not
+/// depend on the number of threads (see common/ReproducibleSumUtils.hpp).
+///
 
 #ifndef RAJAPerf_Basic_PI_REDUCE_HPP
 #define RAJAPerf_Basic_PI_REDUCE_HPP
@@ -57,6 +60,15 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename sum_helper >
+  void runSeqVariantReproducible(VariantID vid);
+  template < typename sum_helper >
+  void runOpenMPVariantReproducible(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size, typename MappingHelper >
@@ -10,8 +10,11 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/LayoutUtils.hpp"
+
 #include <limits>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf 
 {
@@ -19,7 +22,7 @@ namespace basic
 {
 
 
-void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_STRUCT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -150,5 +153,111 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+template < typename layout_helper >
+void REDUCE_STRUCT::runOpenMPVariantLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  using view_type = typename layout_helper::template view_type<Real_type>;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  const Index_type num_comps = 2;
+  std::vector<Real_ptr> p_comps{m_x, m_y};
+
+  Real_ptr p_data;
+  allocData(p_data, view_type::storageSize(num_comps, iend), vid);
+  view_type pv(p_data, num_comps, iend);
+  copyToLayout(pv, p_comps, iend);
+
+  PointsType points;
+  points.N = iend;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type xsum = m_init_sum; Real_type ysum = m_init_sum;
+        Real_type xmin = m_init_min; Real_type ymin = m_init_min;
+        Real_type xmax = m_init_max; Real_type ymax = m_init_max;
+
+        #pragma omp parallel for reduction(+:xsum), \
+                                 reduction(min:xmin), \
+                                 reduction(max:xmax), \
+                                 reduction(+:ysum), \
+                                 reduction(min:ymin), \
+                                 reduction(max:ymax)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          REDUCE_STRUCT_BODY_LAYOUT;
+        }
+
+        points.SetCenter(xsum/(points.N), ysum/(points.N));
+        points.SetXMin(xmin);
+        points.SetXMax(xmax);
+        points.SetYMin(ymin);
+        points.SetYMax(ymax);
+        m_points=points;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_STRUCT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  deallocData(p_data, vid);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(layout_helpers{}, [&](auto layout_helper) {
+      if (tune_idx == t) {
+        runOpenMPVariantLayout<decltype(layout_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void REDUCE_STRUCT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(layout_helpers{}, [&](auto layout_helper) {
+      addVariantTuningName(vid, decltype(layout_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
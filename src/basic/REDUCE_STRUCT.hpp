@@ -51,6 +51,14 @@
   ymin = RAJA_MIN(ymin, points.y[i]) ; \
   ymax = RAJA_MAX(ymax, points.y[i]) ;
 
+#define REDUCE_STRUCT_BODY_LAYOUT  \
+  xsum += pv(0, i) ; \
+  xmin = RAJA_MIN(xmin, pv(0, i)) ; \
+  xmax = RAJA_MAX(xmax, pv(0, i)) ; \
+  ysum += pv(1, i) ; \
+  ymin = RAJA_MIN(ymin, pv(1, i)) ; \
+  ymax = RAJA_MAX(ymax, pv(1, i)) ;
+
 #define REDUCE_STRUCT_BODY_RAJA  \
   xsum += points.x[i] ; \
   xmin.min(points.x[i]) ; \
@@ -87,6 +95,15 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename layout_helper >
+  void runSeqVariantLayout(VariantID vid);
+  template < typename layout_helper >
+  void runOpenMPVariantLayout(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size, typename MappingHelper >
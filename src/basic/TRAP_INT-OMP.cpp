@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/VectorMathUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -31,8 +33,24 @@ Real_type trap_int_func(Real_type x,
    return denom;
 }
 
+#if defined(RAJAPERF_USE_VECMATH)
+//
+// Function used in TRAP_INT loop of vecmath tuning.
+//
+RAJA_INLINE
+Real_type trap_int_func_vecmath(Real_type x,
+                                Real_type y,
+                                Real_type xp,
+                                Real_type yp)
+{
+   Real_type denom = (x - xp)*(x - xp) + (y - yp)*(y - yp);
+   denom = 1.0/vecmath::sqrt(denom);
+   return denom;
+}
+#endif
+
 
-void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void TRAP_INT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -120,5 +138,88 @@ void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 #endif
 }
 
+#if defined(RAJAPERF_USE_VECMATH)
+void TRAP_INT::runOpenMPVariantVecMath(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TRAP_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sumx = m_sumx_init;
+
+        #pragma omp parallel for simd reduction(+:sumx)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRAP_INT_BODY_VECMATH;
+        }
+
+        m_sumx += sumx * h;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRAP_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+#endif
+
+void TRAP_INT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+#if defined(RAJAPERF_USE_VECMATH)
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantVecMath(vid);
+
+    }
+
+    t += 1;
+
+  }
+#endif
+}
+
+void TRAP_INT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+#if defined(RAJAPERF_USE_VECMATH)
+  if (vid == Base_OpenMP) {
+    addVariantTuningName(vid, vecmath_helper::get_name());
+  }
+#endif
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -40,6 +40,10 @@
   Real_type x = x0 + i*h; \
   sumx += trap_int_func(x, y, xp, yp);
 
+#define TRAP_INT_BODY_VECMATH \
+  Real_type x = x0 + vecmath::indexToDouble(i)*h; \
+  sumx += trap_int_func_vecmath(x, y, xp, yp);
+
 
 #include "common/KernelBase.hpp"
 
@@ -69,6 +73,13 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runSeqVariantVecMath(VariantID vid);
+  void runOpenMPVariantVecMath(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size, typename MappingHelper >
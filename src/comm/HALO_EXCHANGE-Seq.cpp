@@ -20,7 +20,7 @@ namespace comm
 {
 
 
-void HALO_EXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALO_EXCHANGE::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -241,6 +241,401 @@ void HALO_EXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+void HALO_EXCHANGE::runSeqVariantPersistent(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALO_EXCHANGE_DATA_SETUP;
+
+  MPI_Request* persistent_pack_requests = m_pack_mpi_requests.data();
+  MPI_Request* persistent_unpack_requests = m_unpack_mpi_requests.data();
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        MPI_Startall(num_neighbors, persistent_unpack_requests);
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              HALO_PACK_BODY;
+            }
+            buffer += len;
+          }
+
+          if (separate_buffers) {
+            copyData(DataSpace::Host, send_buffers[l],
+                     dataSpace, pack_buffers[l],
+                     len*num_vars);
+          }
+
+          MPI_Start(&persistent_pack_requests[l]);
+        }
+
+        for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+          int l = -1;
+          MPI_Waitany(num_neighbors, persistent_unpack_requests, &l, MPI_STATUS_IGNORE);
+
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type len = unpack_index_list_lengths[l];
+          if (separate_buffers) {
+            copyData(dataSpace, unpack_buffers[l],
+                     DataSpace::Host, recv_buffers[l],
+                     len*num_vars);
+          }
+
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              HALO_UNPACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+        MPI_Waitall(num_neighbors, persistent_pack_requests, MPI_STATUSES_IGNORE);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      using EXEC_POL = RAJA::seq_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        MPI_Startall(num_neighbors, persistent_unpack_requests);
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto halo_exchange_pack_base_lam = [=](Index_type i) {
+                  HALO_PACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                halo_exchange_pack_base_lam );
+            buffer += len;
+          }
+
+          if (separate_buffers) {
+            copyData(DataSpace::Host, send_buffers[l],
+                     dataSpace, pack_buffers[l],
+                     len*num_vars);
+          }
+
+          MPI_Start(&persistent_pack_requests[l]);
+        }
+
+        for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+          int l = -1;
+          MPI_Waitany(num_neighbors, persistent_unpack_requests, &l, MPI_STATUS_IGNORE);
+
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type len = unpack_index_list_lengths[l];
+          if (separate_buffers) {
+            copyData(dataSpace, unpack_buffers[l],
+                     DataSpace::Host, recv_buffers[l],
+                     len*num_vars);
+          }
+
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto halo_exchange_unpack_base_lam = [=](Index_type i) {
+                  HALO_UNPACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                halo_exchange_unpack_base_lam );
+            buffer += len;
+          }
+        }
+
+        MPI_Waitall(num_neighbors, persistent_pack_requests, MPI_STATUSES_IGNORE);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n HALO_EXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HALO_EXCHANGE::runSeqVariantNeighbor(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALO_EXCHANGE_DATA_SETUP;
+
+  MPI_Comm neighbor_comm = m_neighbor_comm;
+  const int* neighbor_send_counts = m_neighbor_send_counts.data();
+  const int* neighbor_send_displs = m_neighbor_send_displs.data();
+  const int* neighbor_recv_counts = m_neighbor_recv_counts.data();
+  const int* neighbor_recv_displs = m_neighbor_recv_displs.data();
+
+  Index_type send_len = 0;
+  Index_type recv_len = 0;
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+    send_len += pack_index_list_lengths[l]*num_vars;
+    recv_len += unpack_index_list_lengths[l]*num_vars;
+  }
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              HALO_PACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+        if (separate_buffers) {
+          copyData(DataSpace::Host, send_buffers[0],
+                   dataSpace, pack_buffers[0],
+                   send_len);
+        }
+
+        MPI_Neighbor_alltoallv(
+            send_buffers[0], neighbor_send_counts, neighbor_send_displs, Real_MPI_type,
+            recv_buffers[0], neighbor_recv_counts, neighbor_recv_displs, Real_MPI_type,
+            neighbor_comm);
+
+        if (separate_buffers) {
+          copyData(dataSpace, unpack_buffers[0],
+                   DataSpace::Host, recv_buffers[0],
+                   recv_len);
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type len = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              HALO_UNPACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      using EXEC_POL = RAJA::seq_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto halo_exchange_pack_base_lam = [=](Index_type i) {
+                  HALO_PACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                halo_exchange_pack_base_lam );
+            buffer += len;
+          }
+        }
+
+        if (separate_buffers) {
+          copyData(DataSpace::Host, send_buffers[0],
+                   dataSpace, pack_buffers[0],
+                   send_len);
+        }
+
+        MPI_Neighbor_alltoallv(
+            send_buffers[0], neighbor_send_counts, neighbor_send_displs, Real_MPI_type,
+            recv_buffers[0], neighbor_recv_counts, neighbor_recv_displs, Real_MPI_type,
+            neighbor_comm);
+
+        if (separate_buffers) {
+          copyData(dataSpace, unpack_buffers[0],
+                   DataSpace::Host, recv_buffers[0],
+                   recv_len);
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type len = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto halo_exchange_unpack_base_lam = [=](Index_type i) {
+                  HALO_UNPACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                halo_exchange_unpack_base_lam );
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n HALO_EXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HALO_EXCHANGE::runSeqVariantDatatype(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALO_EXCHANGE_DATA_SETUP;
+
+  std::vector<MPI_Datatype> send_mpi_types = m_send_mpi_types;
+  std::vector<MPI_Datatype> recv_mpi_types = m_recv_mpi_types;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          MPI_Irecv(MPI_BOTTOM, 1, recv_mpi_types[l],
+              mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]);
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          MPI_Isend(MPI_BOTTOM, 1, send_mpi_types[l],
+              mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]);
+        }
+
+        MPI_Waitall(num_neighbors, unpack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+
+        MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALO_EXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HALO_EXCHANGE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq || vid == RAJA_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantPersistent(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantNeighbor(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantDatatype(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void HALO_EXCHANGE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq || vid == RAJA_Seq) {
+    addVariantTuningName(vid, "persistent");
+    addVariantTuningName(vid, "neighbor");
+  }
+
+  if (vid == Base_Seq) {
+    addVariantTuningName(vid, "datatype");
+  }
+}
+
 } // end namespace comm
 } // end namespace rajaperf
 
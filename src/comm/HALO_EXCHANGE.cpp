@@ -26,7 +26,7 @@ HALO_EXCHANGE::HALO_EXCHANGE(const RunParams& params)
 
   setDefaultReps(200);
 
-  m_num_vars = s_num_vars_default;
+  m_num_vars = m_halo_num_vars;
   m_var_size = m_grid_plus_halo_size ;
 
   setItsPerRep( m_num_vars * (m_var_size - getActualProblemSize()) );
@@ -82,33 +82,140 @@ void HALO_EXCHANGE::setUp(VariantID vid, size_t tune_idx)
     }
   }
 
-  const bool separate_buffers = (getMPIDataSpace(vid) == DataSpace::Copy);
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
 
-  m_pack_buffers.resize(s_num_neighbors, nullptr);
-  m_send_buffers.resize(s_num_neighbors, nullptr);
-  for (Index_type l = 0; l < s_num_neighbors; ++l) {
-    Index_type buffer_len = m_num_vars * m_pack_index_list_lengths[l];
-    if (separate_buffers) {
-      allocAndInitData(getDataSpace(vid), m_pack_buffers[l], buffer_len);
-      allocAndInitData(DataSpace::Host, m_send_buffers[l], buffer_len);
-    } else {
-      allocAndInitData(getMPIDataSpace(vid), m_pack_buffers[l], buffer_len);
-      m_send_buffers[l] = m_pack_buffers[l];
+  setUp_buffers(vid, (tuning_name == "neighbor"));
+
+  if (tuning_name == "persistent") {
+
+    m_unpack_mpi_requests.resize(s_num_neighbors, MPI_REQUEST_NULL);
+    m_pack_mpi_requests.resize(s_num_neighbors, MPI_REQUEST_NULL);
+    for (Index_type l = 0; l < s_num_neighbors; ++l) {
+      Index_type recv_len = m_num_vars * m_unpack_index_list_lengths[l];
+      MPI_Recv_init(m_recv_buffers[l], recv_len, Real_MPI_type,
+          m_mpi_ranks[l], m_recv_tags[l], MPI_COMM_WORLD, &m_unpack_mpi_requests[l]);
+      Index_type send_len = m_num_vars * m_pack_index_list_lengths[l];
+      MPI_Send_init(m_send_buffers[l], send_len, Real_MPI_type,
+          m_mpi_ranks[l], m_send_tags[l], MPI_COMM_WORLD, &m_pack_mpi_requests[l]);
+    }
+
+  } else if (tuning_name == "neighbor") {
+
+    //
+    // Neighbor collectives match messages between a pair of ranks by the
+    // order they appear in the graph, not by tag. Each rank sends in
+    // neighbor order and the recv tag of a neighbor is the position of the
+    // matching send on the sending rank, so order sources by recv tag.
+    //
+    std::vector<int> sources(s_num_neighbors, -1);
+    std::vector<int> destinations(s_num_neighbors, -1);
+    m_neighbor_recv_counts.resize(s_num_neighbors, 0);
+    m_neighbor_recv_displs.resize(s_num_neighbors, 0);
+    m_neighbor_send_counts.resize(s_num_neighbors, 0);
+    m_neighbor_send_displs.resize(s_num_neighbors, 0);
+    for (Index_type l = 0; l < s_num_neighbors; ++l) {
+      const int k = m_recv_tags[l];
+      sources[k] = m_mpi_ranks[l];
+      m_neighbor_recv_counts[k] = m_num_vars * m_unpack_index_list_lengths[l];
+      m_neighbor_recv_displs[k] = m_recv_buffers[l] - m_recv_buffers[0];
+
+      destinations[l] = m_mpi_ranks[l];
+      m_neighbor_send_counts[l] = m_num_vars * m_pack_index_list_lengths[l];
+      m_neighbor_send_displs[l] = m_send_buffers[l] - m_send_buffers[0];
+    }
+
+    MPI_Dist_graph_create_adjacent(MPI_COMM_WORLD,
+        s_num_neighbors, sources.data(), MPI_UNWEIGHTED,
+        s_num_neighbors, destinations.data(), MPI_UNWEIGHTED,
+        MPI_INFO_NULL, 0, &m_neighbor_comm);
+
+  } else if (tuning_name == "datatype") {
+
+    //
+    // Describe each message by the absolute addresses of the variable
+    // entries it contains so it can be sent from and received into the
+    // variables directly.
+    //
+    m_recv_mpi_types.resize(s_num_neighbors, MPI_DATATYPE_NULL);
+    m_send_mpi_types.resize(s_num_neighbors, MPI_DATATYPE_NULL);
+
+    auto make_type = [&](Int_ptr& list_ref, Index_type len, MPI_Datatype& type) {
+      auto reset_list = scopedMoveData(list_ref, len, vid);
+      Int_ptr list = list_ref;
+
+      std::vector<MPI_Aint> displs(m_num_vars * len);
+      for (Index_type v = 0; v < m_num_vars; ++v) {
+        for (Index_type i = 0; i < len; i++) {
+          MPI_Get_address(&m_vars[v][list[i]], &displs[v*len + i]);
+        }
+      }
+
+      MPI_Type_create_hindexed_block(m_num_vars * len, 1, displs.data(),
+                                     Real_MPI_type, &type);
+      MPI_Type_commit(&type);
+    };
+
+    for (Index_type l = 0; l < s_num_neighbors; ++l) {
+      make_type(m_unpack_index_lists[l], m_unpack_index_list_lengths[l],
+                m_recv_mpi_types[l]);
+      make_type(m_pack_index_lists[l], m_pack_index_list_lengths[l],
+                m_send_mpi_types[l]);
     }
+
   }
+}
+
+void HALO_EXCHANGE::setUp_buffers(VariantID vid, bool contiguous)
+{
+  const bool separate_buffers = (getMPIDataSpace(vid) == DataSpace::Copy);
 
-  m_unpack_buffers.resize(s_num_neighbors, nullptr);
-  m_recv_buffers.resize(s_num_neighbors, nullptr);
-  for (Index_type l = 0; l < s_num_neighbors; ++l) {
-    Index_type buffer_len = m_num_vars * m_unpack_index_list_lengths[l];
-    if (separate_buffers) {
-      allocAndInitData(getDataSpace(vid), m_unpack_buffers[l], buffer_len);
-      allocAndInitData(DataSpace::Host, m_recv_buffers[l], buffer_len);
+  //
+  // Allocate a buffer per neighbor, or one block sliced per neighbor
+  // when the buffers must be contiguous.
+  //
+  auto alloc_buffers = [&](const std::vector<Index_type>& list_lengths,
+                           std::vector<Real_ptr>& buffers,
+                           std::vector<Real_ptr>& mpi_buffers,
+                           Real_ptr& buffer_block,
+                           Real_ptr& mpi_buffer_block) {
+    buffers.resize(s_num_neighbors, nullptr);
+    mpi_buffers.resize(s_num_neighbors, nullptr);
+    if (contiguous) {
+      Index_type block_len = 0;
+      for (Index_type l = 0; l < s_num_neighbors; ++l) {
+        block_len += m_num_vars * list_lengths[l];
+      }
+      if (separate_buffers) {
+        allocAndInitData(getDataSpace(vid), buffer_block, block_len);
+        allocAndInitData(DataSpace::Host, mpi_buffer_block, block_len);
+      } else {
+        allocAndInitData(getMPIDataSpace(vid), buffer_block, block_len);
+        mpi_buffer_block = buffer_block;
+      }
+      Index_type offset = 0;
+      for (Index_type l = 0; l < s_num_neighbors; ++l) {
+        buffers[l] = buffer_block + offset;
+        mpi_buffers[l] = mpi_buffer_block + offset;
+        offset += m_num_vars * list_lengths[l];
+      }
     } else {
-      allocAndInitData(getMPIDataSpace(vid), m_unpack_buffers[l], buffer_len);
-      m_recv_buffers[l] = m_unpack_buffers[l];
+      for (Index_type l = 0; l < s_num_neighbors; ++l) {
+        Index_type buffer_len = m_num_vars * list_lengths[l];
+        if (separate_buffers) {
+          allocAndInitData(getDataSpace(vid), buffers[l], buffer_len);
+          allocAndInitData(DataSpace::Host, mpi_buffers[l], buffer_len);
+        } else {
+          allocAndInitData(getMPIDataSpace(vid), buffers[l], buffer_len);
+          mpi_buffers[l] = buffers[l];
+        }
+      }
     }
-  }
+  };
+
+  alloc_buffers(m_pack_index_list_lengths, m_pack_buffers, m_send_buffers,
+                m_pack_buffer_block, m_send_buffer_block);
+  alloc_buffers(m_unpack_index_list_lengths, m_unpack_buffers, m_recv_buffers,
+                m_unpack_buffer_block, m_recv_buffer_block);
 }
 
 void HALO_EXCHANGE::updateChecksum(VariantID vid, size_t tune_idx)
@@ -120,29 +227,33 @@ void HALO_EXCHANGE::updateChecksum(VariantID vid, size_t tune_idx)
 
 void HALO_EXCHANGE::tearDown(VariantID vid, size_t tune_idx)
 {
-  const bool separate_buffers = (getMPIDataSpace(vid) == DataSpace::Copy);
+  for (MPI_Datatype& type : m_send_mpi_types) {
+    MPI_Type_free(&type);
+  }
+  m_send_mpi_types.clear();
+  for (MPI_Datatype& type : m_recv_mpi_types) {
+    MPI_Type_free(&type);
+  }
+  m_recv_mpi_types.clear();
 
-  for (int l = 0; l < s_num_neighbors; ++l) {
-    if (separate_buffers) {
-      deallocData(DataSpace::Host, m_recv_buffers[l]);
-      deallocData(getDataSpace(vid), m_unpack_buffers[l]);
-    } else {
-      deallocData(getMPIDataSpace(vid), m_unpack_buffers[l]);
-    }
+  if (m_neighbor_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&m_neighbor_comm);
   }
-  m_recv_buffers.clear();
-  m_unpack_buffers.clear();
+  m_neighbor_recv_displs.clear();
+  m_neighbor_recv_counts.clear();
+  m_neighbor_send_displs.clear();
+  m_neighbor_send_counts.clear();
 
-  for (int l = 0; l < s_num_neighbors; ++l) {
-    if (separate_buffers) {
-      deallocData(DataSpace::Host, m_send_buffers[l]);
-      deallocData(getDataSpace(vid), m_pack_buffers[l]);
-    } else {
-      deallocData(getMPIDataSpace(vid), m_pack_buffers[l]);
-    }
+  for (MPI_Request& request : m_pack_mpi_requests) {
+    MPI_Request_free(&request);
   }
-  m_send_buffers.clear();
-  m_pack_buffers.clear();
+  m_pack_mpi_requests.clear();
+  for (MPI_Request& request : m_unpack_mpi_requests) {
+    MPI_Request_free(&request);
+  }
+  m_unpack_mpi_requests.clear();
+
+  tearDown_buffers(vid);
 
   for (int v = 0; v < m_num_vars; ++v) {
     deallocData(m_vars[v], vid);
@@ -152,6 +263,43 @@ void HALO_EXCHANGE::tearDown(VariantID vid, size_t tune_idx)
   tearDown_base(vid, tune_idx);
 }
 
+void HALO_EXCHANGE::tearDown_buffers(VariantID vid)
+{
+  const bool separate_buffers = (getMPIDataSpace(vid) == DataSpace::Copy);
+
+  auto dealloc_buffers = [&](std::vector<Real_ptr>& buffers,
+                             std::vector<Real_ptr>& mpi_buffers,
+                             Real_ptr& buffer_block,
+                             Real_ptr& mpi_buffer_block) {
+    if (buffer_block != nullptr) {
+      if (separate_buffers) {
+        deallocData(DataSpace::Host, mpi_buffer_block);
+        deallocData(getDataSpace(vid), buffer_block);
+      } else {
+        deallocData(getMPIDataSpace(vid), buffer_block);
+      }
+      mpi_buffer_block = nullptr;
+      buffer_block = nullptr;
+    } else {
+      for (int l = 0; l < s_num_neighbors; ++l) {
+        if (separate_buffers) {
+          deallocData(DataSpace::Host, mpi_buffers[l]);
+          deallocData(getDataSpace(vid), buffers[l]);
+        } else {
+          deallocData(getMPIDataSpace(vid), buffers[l]);
+        }
+      }
+    }
+    mpi_buffers.clear();
+    buffers.clear();
+  };
+
+  dealloc_buffers(m_unpack_buffers, m_recv_buffers,
+                  m_unpack_buffer_block, m_recv_buffer_block);
+  dealloc_buffers(m_pack_buffers, m_send_buffers,
+                  m_pack_buffer_block, m_send_buffer_block);
+}
+
 } // end namespace comm
 } // end namespace rajaperf
 
@@ -54,6 +54,11 @@
 /// // wait for all sends to complete
 /// MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE);
 ///
+/// Sequential tunings replace the messages above with persistent requests
+/// ("persistent"), one MPI_Neighbor_alltoallv on a distributed graph
+/// communicator ("neighbor"), or derived datatypes that send and receive
+/// the variables in place without packing ("datatype").
+///
 
 
 #ifndef RAJAPerf_Comm_HALO_EXCHANGE_HPP
@@ -113,8 +118,13 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantPersistent(VariantID vid);
+  void runSeqVariantNeighbor(VariantID vid);
+  void runSeqVariantDatatype(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -138,6 +148,32 @@ private:
 
   std::vector<Real_ptr> m_send_buffers;
   std::vector<Real_ptr> m_recv_buffers;
+
+  // single allocations backing the per neighbor buffers, only used
+  // when the buffers must be contiguous (neighbor collective tuning)
+  Real_ptr m_pack_buffer_block = nullptr;
+  Real_ptr m_unpack_buffer_block = nullptr;
+  Real_ptr m_send_buffer_block = nullptr;
+  Real_ptr m_recv_buffer_block = nullptr;
+
+  // persistent requests (persistent tuning)
+  std::vector<MPI_Request> m_pack_mpi_requests;
+  std::vector<MPI_Request> m_unpack_mpi_requests;
+
+  // distributed graph communicator and message layout
+  // (neighbor collective tuning)
+  MPI_Comm m_neighbor_comm = MPI_COMM_NULL;
+  std::vector<int> m_neighbor_send_counts;
+  std::vector<int> m_neighbor_send_displs;
+  std::vector<int> m_neighbor_recv_counts;
+  std::vector<int> m_neighbor_recv_displs;
+
+  // derived datatypes describing each message in place (datatype tuning)
+  std::vector<MPI_Datatype> m_send_mpi_types;
+  std::vector<MPI_Datatype> m_recv_mpi_types;
+
+  void setUp_buffers(VariantID vid, bool contiguous);
+  void tearDown_buffers(VariantID vid);
 };
 
 } // end namespace comm
@@ -0,0 +1,794 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HALO_EXCHANGE_OVERLAP.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace comm
+{
+
+//
+// Receive and unpack the halo before updating the interior.
+//
+void HALO_EXCHANGE_OVERLAP::runOpenMPVariantNoOverlap(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALO_EXCHANGE_OVERLAP_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Index_type len = unpack_index_list_lengths[l];
+          MPI_Irecv(recv_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]);
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type i = 0; i < len; i++) {
+              HALO_PACK_BODY;
+            }
+            buffer += len;
+          }
+
+          if (separate_buffers) {
+            copyData(DataSpace::Host, send_buffers[l],
+                     dataSpace, pack_buffers[l],
+                     len*num_vars);
+          }
+
+          MPI_Isend(send_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]);
+        }
+
+        for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+          int l = -1;
+          MPI_Waitany(num_neighbors, unpack_mpi_requests.data(), &l, MPI_STATUS_IGNORE);
+
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type len = unpack_index_list_lengths[l];
+          if (separate_buffers) {
+            copyData(dataSpace, unpack_buffers[l],
+                     DataSpace::Host, recv_buffers[l],
+                     len*num_vars);
+          }
+
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type i = 0; i < len; i++) {
+              HALO_UNPACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          Real_ptr res = results[v];
+          Int_ptr list = interior_list;
+          #pragma omp parallel for
+          for (Index_type ii = 0; ii < interior_len; ii++) {
+            HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+          }
+        }
+
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          Real_ptr res = results[v];
+          Int_ptr list = boundary_list;
+          #pragma omp parallel for
+          for (Index_type ii = 0; ii < boundary_len; ii++) {
+            HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+          }
+        }
+
+        MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = RAJA::omp_parallel_for_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Index_type len = unpack_index_list_lengths[l];
+          MPI_Irecv(recv_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]);
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto halo_exchange_overlap_pack_base_lam = [=](Index_type i) {
+                  HALO_PACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                halo_exchange_overlap_pack_base_lam );
+            buffer += len;
+          }
+
+          if (separate_buffers) {
+            copyData(DataSpace::Host, send_buffers[l],
+                     dataSpace, pack_buffers[l],
+                     len*num_vars);
+          }
+
+          MPI_Isend(send_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]);
+        }
+
+        for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+          int l = -1;
+          MPI_Waitany(num_neighbors, unpack_mpi_requests.data(), &l, MPI_STATUS_IGNORE);
+
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type len = unpack_index_list_lengths[l];
+          if (separate_buffers) {
+            copyData(dataSpace, unpack_buffers[l],
+                     DataSpace::Host, recv_buffers[l],
+                     len*num_vars);
+          }
+
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto halo_exchange_overlap_unpack_base_lam = [=](Index_type i) {
+                  HALO_UNPACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                halo_exchange_overlap_unpack_base_lam );
+            buffer += len;
+          }
+        }
+
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          Real_ptr res = results[v];
+          Int_ptr list = interior_list;
+          auto halo_exchange_overlap_stencil_lam = [=](Index_type ii) {
+                HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+              };
+          RAJA::forall<EXEC_POL>(
+              RAJA::TypedRangeSegment<Index_type>(0, interior_len),
+              halo_exchange_overlap_stencil_lam );
+        }
+
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          Real_ptr res = results[v];
+          Int_ptr list = boundary_list;
+          auto halo_exchange_overlap_stencil_lam = [=](Index_type ii) {
+                HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+              };
+          RAJA::forall<EXEC_POL>(
+              RAJA::TypedRangeSegment<Index_type>(0, boundary_len),
+              halo_exchange_overlap_stencil_lam );
+        }
+
+        MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALO_EXCHANGE_OVERLAP : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Update the interior in OpenMP tasks while the master thread receives
+// and unpacks the halo.
+//
+void HALO_EXCHANGE_OVERLAP::runOpenMPVariantTasks(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALO_EXCHANGE_OVERLAP_DATA_SETUP;
+
+  const int num_threads = omp_get_max_threads();
+
+  std::vector<double> interior_end(num_threads);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Index_type len = unpack_index_list_lengths[l];
+          MPI_Irecv(recv_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]);
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type i = 0; i < len; i++) {
+              HALO_PACK_BODY;
+            }
+            buffer += len;
+          }
+
+          if (separate_buffers) {
+            copyData(DataSpace::Host, send_buffers[l],
+                     dataSpace, pack_buffers[l],
+                     len*num_vars);
+          }
+
+          MPI_Isend(send_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]);
+        }
+
+        const Index_type num_chunks = 4 * num_threads;
+        const Index_type chunk_len = (interior_len + num_chunks - 1) / num_chunks;
+
+        double recv_end = 0.0;
+        const double t0 = omp_get_wtime();
+        std::fill(interior_end.begin(), interior_end.end(), t0);
+
+        #pragma omp parallel num_threads(num_threads)
+        {
+          #pragma omp master
+          {
+            for (Index_type c = 0; c < num_chunks; ++c) {
+              #pragma omp task firstprivate(c)
+              {
+                const Index_type ibegin = std::min(c * chunk_len, interior_len);
+                const Index_type iend = std::min(ibegin + chunk_len, interior_len);
+                for (Index_type v = 0; v < num_vars; ++v) {
+                  Real_ptr var = vars[v];
+                  Real_ptr res = results[v];
+                  Int_ptr list = interior_list;
+                  for (Index_type ii = ibegin; ii < iend; ii++) {
+                    HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+                  }
+                }
+                interior_end[omp_get_thread_num()] = omp_get_wtime();
+              }
+            }
+
+            for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+              int l = -1;
+              MPI_Waitany(num_neighbors, unpack_mpi_requests.data(), &l, MPI_STATUS_IGNORE);
+
+              Real_ptr buffer = unpack_buffers[l];
+              Int_ptr list = unpack_index_lists[l];
+              Index_type len = unpack_index_list_lengths[l];
+              if (separate_buffers) {
+                copyData(dataSpace, unpack_buffers[l],
+                         DataSpace::Host, recv_buffers[l],
+                         len*num_vars);
+              }
+
+              for (Index_type v = 0; v < num_vars; ++v) {
+                Real_ptr var = vars[v];
+                for (Index_type i = 0; i < len; i++) {
+                  HALO_UNPACK_BODY;
+                }
+                buffer += len;
+              }
+            }
+            recv_end = omp_get_wtime();
+          }
+        }
+
+        m_recv_time += recv_end - t0;
+        m_overlap_time += std::min(recv_end, *std::max_element(interior_end.begin(),
+                                                              interior_end.end())) - t0;
+
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          Real_ptr res = results[v];
+          Int_ptr list = boundary_list;
+          #pragma omp parallel for
+          for (Index_type ii = 0; ii < boundary_len; ii++) {
+            HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+          }
+        }
+
+        MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = RAJA::omp_parallel_for_exec;
+      using INNER_POL = RAJA::seq_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Index_type len = unpack_index_list_lengths[l];
+          MPI_Irecv(recv_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]);
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto halo_exchange_overlap_pack_base_lam = [=](Index_type i) {
+                  HALO_PACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                halo_exchange_overlap_pack_base_lam );
+            buffer += len;
+          }
+
+          if (separate_buffers) {
+            copyData(DataSpace::Host, send_buffers[l],
+                     dataSpace, pack_buffers[l],
+                     len*num_vars);
+          }
+
+          MPI_Isend(send_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]);
+        }
+
+        const Index_type num_chunks = 4 * num_threads;
+        const Index_type chunk_len = (interior_len + num_chunks - 1) / num_chunks;
+
+        double recv_end = 0.0;
+        const double t0 = omp_get_wtime();
+        std::fill(interior_end.begin(), interior_end.end(), t0);
+
+        #pragma omp parallel num_threads(num_threads)
+        {
+          #pragma omp master
+          {
+            for (Index_type c = 0; c < num_chunks; ++c) {
+              #pragma omp task firstprivate(c)
+              {
+                const Index_type ibegin = std::min(c * chunk_len, interior_len);
+                const Index_type iend = std::min(ibegin + chunk_len, interior_len);
+                for (Index_type v = 0; v < num_vars; ++v) {
+                  Real_ptr var = vars[v];
+                  Real_ptr res = results[v];
+                  Int_ptr list = interior_list;
+                  auto halo_exchange_overlap_stencil_lam = [=](Index_type ii) {
+                        HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+                      };
+                  RAJA::forall<INNER_POL>(
+                      RAJA::TypedRangeSegment<Index_type>(ibegin, iend),
+                      halo_exchange_overlap_stencil_lam );
+                }
+                interior_end[omp_get_thread_num()] = omp_get_wtime();
+              }
+            }
+
+            for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+              int l = -1;
+              MPI_Waitany(num_neighbors, unpack_mpi_requests.data(), &l, MPI_STATUS_IGNORE);
+
+              Real_ptr buffer = unpack_buffers[l];
+              Int_ptr list = unpack_index_lists[l];
+              Index_type len = unpack_index_list_lengths[l];
+              if (separate_buffers) {
+                copyData(dataSpace, unpack_buffers[l],
+                         DataSpace::Host, recv_buffers[l],
+                         len*num_vars);
+              }
+
+              for (Index_type v = 0; v < num_vars; ++v) {
+                Real_ptr var = vars[v];
+                auto halo_exchange_overlap_unpack_base_lam = [=](Index_type i) {
+                      HALO_UNPACK_BODY;
+                    };
+                RAJA::forall<INNER_POL>(
+                    RAJA::TypedRangeSegment<Index_type>(0, len),
+                    halo_exchange_overlap_unpack_base_lam );
+                buffer += len;
+              }
+            }
+            recv_end = omp_get_wtime();
+          }
+        }
+
+        m_recv_time += recv_end - t0;
+        m_overlap_time += std::min(recv_end, *std::max_element(interior_end.begin(),
+                                                              interior_end.end())) - t0;
+
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          Real_ptr res = results[v];
+          Int_ptr list = boundary_list;
+          auto halo_exchange_overlap_stencil_lam = [=](Index_type ii) {
+                HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+              };
+          RAJA::forall<EXEC_POL>(
+              RAJA::TypedRangeSegment<Index_type>(0, boundary_len),
+              halo_exchange_overlap_stencil_lam );
+        }
+
+        MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALO_EXCHANGE_OVERLAP : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Dedicate the master thread to receiving and unpacking the halo while
+// the other threads update the interior.
+//
+void HALO_EXCHANGE_OVERLAP::runOpenMPVariantProgress(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALO_EXCHANGE_OVERLAP_DATA_SETUP;
+
+  const int num_threads = omp_get_max_threads();
+
+  std::vector<double> interior_end(num_threads);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Index_type len = unpack_index_list_lengths[l];
+          MPI_Irecv(recv_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]);
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type i = 0; i < len; i++) {
+              HALO_PACK_BODY;
+            }
+            buffer += len;
+          }
+
+          if (separate_buffers) {
+            copyData(DataSpace::Host, send_buffers[l],
+                     dataSpace, pack_buffers[l],
+                     len*num_vars);
+          }
+
+          MPI_Isend(send_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]);
+        }
+
+        double recv_end = 0.0;
+        const double t0 = omp_get_wtime();
+        std::fill(interior_end.begin(), interior_end.end(), t0);
+
+        #pragma omp parallel num_threads(num_threads)
+        {
+          const Index_type tid = omp_get_thread_num();
+          const Index_type num_workers = omp_get_num_threads() - 1;
+
+          if (tid == 0) {
+
+            for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+              int l = -1;
+              MPI_Waitany(num_neighbors, unpack_mpi_requests.data(), &l, MPI_STATUS_IGNORE);
+
+              Real_ptr buffer = unpack_buffers[l];
+              Int_ptr list = unpack_index_lists[l];
+              Index_type len = unpack_index_list_lengths[l];
+              if (separate_buffers) {
+                copyData(dataSpace, unpack_buffers[l],
+                         DataSpace::Host, recv_buffers[l],
+                         len*num_vars);
+              }
+
+              for (Index_type v = 0; v < num_vars; ++v) {
+                Real_ptr var = vars[v];
+                for (Index_type i = 0; i < len; i++) {
+                  HALO_UNPACK_BODY;
+                }
+                buffer += len;
+              }
+            }
+            recv_end = omp_get_wtime();
+
+          }
+
+          if (tid > 0 || num_workers == 0) {
+
+            const Index_type w = (num_workers > 0) ? tid - 1 : 0;
+            const Index_type nw = (num_workers > 0) ? num_workers : 1;
+            const Index_type ibegin = interior_len * w / nw;
+            const Index_type iend = interior_len * (w + 1) / nw;
+            for (Index_type v = 0; v < num_vars; ++v) {
+              Real_ptr var = vars[v];
+              Real_ptr res = results[v];
+              Int_ptr list = interior_list;
+              for (Index_type ii = ibegin; ii < iend; ii++) {
+                HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+              }
+            }
+            if (tid > 0) {
+              interior_end[tid] = omp_get_wtime();
+            }
+
+          }
+        }
+
+        m_recv_time += recv_end - t0;
+        m_overlap_time += std::min(recv_end, *std::max_element(interior_end.begin(),
+                                                              interior_end.end())) - t0;
+
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          Real_ptr res = results[v];
+          Int_ptr list = boundary_list;
+          #pragma omp parallel for
+          for (Index_type ii = 0; ii < boundary_len; ii++) {
+            HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+          }
+        }
+
+        MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = RAJA::omp_parallel_for_exec;
+      using INNER_POL = RAJA::seq_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Index_type len = unpack_index_list_lengths[l];
+          MPI_Irecv(recv_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]);
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto halo_exchange_overlap_pack_base_lam = [=](Index_type i) {
+                  HALO_PACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                halo_exchange_overlap_pack_base_lam );
+            buffer += len;
+          }
+
+          if (separate_buffers) {
+            copyData(DataSpace::Host, send_buffers[l],
+                     dataSpace, pack_buffers[l],
+                     len*num_vars);
+          }
+
+          MPI_Isend(send_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]);
+        }
+
+        double recv_end = 0.0;
+        const double t0 = omp_get_wtime();
+        std::fill(interior_end.begin(), interior_end.end(), t0);
+
+        #pragma omp parallel num_threads(num_threads)
+        {
+          const Index_type tid = omp_get_thread_num();
+          const Index_type num_workers = omp_get_num_threads() - 1;
+
+          if (tid == 0) {
+
+            for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+              int l = -1;
+              MPI_Waitany(num_neighbors, unpack_mpi_requests.data(), &l, MPI_STATUS_IGNORE);
+
+              Real_ptr buffer = unpack_buffers[l];
+              Int_ptr list = unpack_index_lists[l];
+              Index_type len = unpack_index_list_lengths[l];
+              if (separate_buffers) {
+                copyData(dataSpace, unpack_buffers[l],
+                         DataSpace::Host, recv_buffers[l],
+                         len*num_vars);
+              }
+
+              for (Index_type v = 0; v < num_vars; ++v) {
+                Real_ptr var = vars[v];
+                auto halo_exchange_overlap_unpack_base_lam = [=](Index_type i) {
+                      HALO_UNPACK_BODY;
+                    };
+                RAJA::forall<INNER_POL>(
+                    RAJA::TypedRangeSegment<Index_type>(0, len),
+                    halo_exchange_overlap_unpack_base_lam );
+                buffer += len;
+              }
+            }
+            recv_end = omp_get_wtime();
+
+          }
+
+          if (tid > 0 || num_workers == 0) {
+
+            const Index_type w = (num_workers > 0) ? tid - 1 : 0;
+            const Index_type nw = (num_workers > 0) ? num_workers : 1;
+            const Index_type ibegin = interior_len * w / nw;
+            const Index_type iend = interior_len * (w + 1) / nw;
+            for (Index_type v = 0; v < num_vars; ++v) {
+              Real_ptr var = vars[v];
+              Real_ptr res = results[v];
+              Int_ptr list = interior_list;
+              auto halo_exchange_overlap_stencil_lam = [=](Index_type ii) {
+                    HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+                  };
+              RAJA::forall<INNER_POL>(
+                  RAJA::TypedRangeSegment<Index_type>(ibegin, iend),
+                  halo_exchange_overlap_stencil_lam );
+            }
+            if (tid > 0) {
+              interior_end[tid] = omp_get_wtime();
+            }
+
+          }
+        }
+
+        m_recv_time += recv_end - t0;
+        m_overlap_time += std::min(recv_end, *std::max_element(interior_end.begin(),
+                                                              interior_end.end())) - t0;
+
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          Real_ptr res = results[v];
+          Int_ptr list = boundary_list;
+          auto halo_exchange_overlap_stencil_lam = [=](Index_type ii) {
+                HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+              };
+          RAJA::forall<EXEC_POL>(
+              RAJA::TypedRangeSegment<Index_type>(0, boundary_len),
+              halo_exchange_overlap_stencil_lam );
+        }
+
+        MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALO_EXCHANGE_OVERLAP : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALO_EXCHANGE_OVERLAP::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantNoOverlap(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantTasks(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantProgress(vid);
+
+  }
+
+  t += 1;
+}
+
+void HALO_EXCHANGE_OVERLAP::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "nooverlap");
+  addVariantTuningName(vid, "tasks");
+  addVariantTuningName(vid, "progress");
+}
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif
@@ -0,0 +1,220 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HALO_EXCHANGE_OVERLAP.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace comm
+{
+
+
+void HALO_EXCHANGE_OVERLAP::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  HALO_EXCHANGE_OVERLAP_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Index_type len = unpack_index_list_lengths[l];
+          MPI_Irecv(recv_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]);
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              HALO_PACK_BODY;
+            }
+            buffer += len;
+          }
+
+          if (separate_buffers) {
+            copyData(DataSpace::Host, send_buffers[l],
+                     dataSpace, pack_buffers[l],
+                     len*num_vars);
+          }
+
+          MPI_Isend(send_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]);
+        }
+
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          Real_ptr res = results[v];
+          Int_ptr list = interior_list;
+          for (Index_type ii = 0; ii < interior_len; ++ii) {
+            HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+          }
+        }
+
+        for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+          int l = -1;
+          MPI_Waitany(num_neighbors, unpack_mpi_requests.data(), &l, MPI_STATUS_IGNORE);
+
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type len = unpack_index_list_lengths[l];
+          if (separate_buffers) {
+            copyData(dataSpace, unpack_buffers[l],
+                     DataSpace::Host, recv_buffers[l],
+                     len*num_vars);
+          }
+
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              HALO_UNPACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          Real_ptr res = results[v];
+          Int_ptr list = boundary_list;
+          for (Index_type ii = 0; ii < boundary_len; ++ii) {
+            HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+          }
+        }
+
+        MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      using EXEC_POL = RAJA::seq_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Index_type len = unpack_index_list_lengths[l];
+          MPI_Irecv(recv_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]);
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto halo_exchange_overlap_pack_base_lam = [=](Index_type i) {
+                  HALO_PACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                halo_exchange_overlap_pack_base_lam );
+            buffer += len;
+          }
+
+          if (separate_buffers) {
+            copyData(DataSpace::Host, send_buffers[l],
+                     dataSpace, pack_buffers[l],
+                     len*num_vars);
+          }
+
+          MPI_Isend(send_buffers[l], len*num_vars, Real_MPI_type,
+              mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]);
+        }
+
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          Real_ptr res = results[v];
+          Int_ptr list = interior_list;
+          auto halo_exchange_overlap_stencil_lam = [=](Index_type ii) {
+                HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+              };
+          RAJA::forall<EXEC_POL>(
+              RAJA::TypedRangeSegment<Index_type>(0, interior_len),
+              halo_exchange_overlap_stencil_lam );
+        }
+
+        for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+          int l = -1;
+          MPI_Waitany(num_neighbors, unpack_mpi_requests.data(), &l, MPI_STATUS_IGNORE);
+
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type len = unpack_index_list_lengths[l];
+          if (separate_buffers) {
+            copyData(dataSpace, unpack_buffers[l],
+                     DataSpace::Host, recv_buffers[l],
+                     len*num_vars);
+          }
+
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto halo_exchange_overlap_unpack_base_lam = [=](Index_type i) {
+                  HALO_UNPACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                halo_exchange_overlap_unpack_base_lam );
+            buffer += len;
+          }
+        }
+
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          Real_ptr res = results[v];
+          Int_ptr list = boundary_list;
+          auto halo_exchange_overlap_stencil_lam = [=](Index_type ii) {
+                HALO_EXCHANGE_OVERLAP_STENCIL_BODY;
+              };
+          RAJA::forall<EXEC_POL>(
+              RAJA::TypedRangeSegment<Index_type>(0, boundary_len),
+              halo_exchange_overlap_stencil_lam );
+        }
+
+        MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n HALO_EXCHANGE_OVERLAP : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif
@@ -0,0 +1,225 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HALO_EXCHANGE_OVERLAP.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace comm
+{
+
+HALO_EXCHANGE_OVERLAP::HALO_EXCHANGE_OVERLAP(const RunParams& params)
+  : HALO_base(rajaperf::Comm_HALO_EXCHANGE_OVERLAP, params)
+{
+  m_mpi_size = params.getMPISize();
+  m_my_mpi_rank = params.getMPIRank();
+  m_mpi_dims = params.getMPI3DDivision();
+
+  setDefaultReps(200);
+
+  m_num_vars = m_halo_num_vars;
+  m_var_size = m_grid_plus_halo_size ;
+
+  m_stencil_coef = 1.0 / 7.0;
+
+  const Index_type grid_size = m_grid_dims[0] *
+                               m_grid_dims[1] *
+                               m_grid_dims[2] ;
+  const Index_type halo_its = m_num_vars * (m_var_size - grid_size);
+  const Index_type stencil_its = m_num_vars * grid_size;
+
+  setItsPerRep( halo_its + stencil_its );
+  setKernelsPerRep( 2 * s_num_neighbors * m_num_vars + 2 * m_num_vars );
+  setBytesPerRep( (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * halo_its +  // pack
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * halo_its +  // pack
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * halo_its +  // send
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * halo_its +  // recv
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * halo_its +  // unpack
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * halo_its +  // unpack
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * stencil_its +  // stencil
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * stencil_its ); // stencil
+  setFLOPsPerRep(7 * stencil_its);
+
+  m_overlap_metric = addMetricName("overlap %");
+
+  setUsesFeature(Forall);
+  setUsesFeature(MPI);
+
+  if (params.validMPI3DDivision()) {
+    setVariantDefined( Base_Seq );
+    setVariantDefined( RAJA_Seq );
+
+    setVariantDefined( Base_OpenMP );
+    setVariantDefined( RAJA_OpenMP );
+  }
+}
+
+HALO_EXCHANGE_OVERLAP::~HALO_EXCHANGE_OVERLAP()
+{
+}
+
+void HALO_EXCHANGE_OVERLAP::setUp(VariantID vid, size_t tune_idx)
+{
+  setUp_base(m_my_mpi_rank, m_mpi_dims.data(), vid, tune_idx);
+
+  m_vars.resize(m_num_vars, nullptr);
+  m_results.resize(m_num_vars, nullptr);
+  for (Index_type v = 0; v < m_num_vars; ++v) {
+    allocAndInitData(m_vars[v], m_var_size, vid);
+    auto reset_var = scopedMoveData(m_vars[v], m_var_size, vid);
+
+    Real_ptr var = m_vars[v];
+
+    for (Index_type i = 0; i < m_var_size; i++) {
+      var[i] = i + v;
+    }
+
+    allocAndInitDataConst(m_results[v], m_var_size, 0.0, vid);
+  }
+
+  //
+  // Split the zones owned by this rank into those whose stencil reads
+  // only owned zones (interior) and those that read the halo (boundary).
+  //
+  const Index_type jp = m_grid_plus_halo_dims[0];
+  const Index_type kp = m_grid_plus_halo_dims[0] * m_grid_plus_halo_dims[1];
+
+  const Index_type imin = m_halo_width;
+  const Index_type jmin = m_halo_width;
+  const Index_type kmin = m_halo_width;
+  const Index_type imax = m_halo_width + m_grid_dims[0];
+  const Index_type jmax = m_halo_width + m_grid_dims[1];
+  const Index_type kmax = m_halo_width + m_grid_dims[2];
+
+  m_interior_len = std::max(m_grid_dims[0] - 2, Index_type(0)) *
+                   std::max(m_grid_dims[1] - 2, Index_type(0)) *
+                   std::max(m_grid_dims[2] - 2, Index_type(0)) ;
+  m_boundary_len = m_grid_dims[0] * m_grid_dims[1] * m_grid_dims[2] -
+                   m_interior_len;
+
+  allocAndInitData(m_interior_list, m_interior_len, vid);
+  allocAndInitData(m_boundary_list, m_boundary_len, vid);
+  {
+    auto reset_interior = scopedMoveData(m_interior_list, m_interior_len, vid);
+    auto reset_boundary = scopedMoveData(m_boundary_list, m_boundary_len, vid);
+
+    Index_type interior_idx = 0;
+    Index_type boundary_idx = 0;
+    for (Index_type k = kmin; k < kmax; ++k) {
+      for (Index_type j = jmin; j < jmax; ++j) {
+        for (Index_type i = imin; i < imax; ++i) {
+          const Int_type idx = i + j * jp + k * kp;
+          if ( i > imin && i < imax-1 &&
+               j > jmin && j < jmax-1 &&
+               k > kmin && k < kmax-1 ) {
+            m_interior_list[interior_idx++] = idx;
+          } else {
+            m_boundary_list[boundary_idx++] = idx;
+          }
+        }
+      }
+    }
+  }
+
+  const bool separate_buffers = (getMPIDataSpace(vid) == DataSpace::Copy);
+
+  m_pack_buffers.resize(s_num_neighbors, nullptr);
+  m_send_buffers.resize(s_num_neighbors, nullptr);
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    Index_type buffer_len = m_num_vars * m_pack_index_list_lengths[l];
+    if (separate_buffers) {
+      allocAndInitData(getDataSpace(vid), m_pack_buffers[l], buffer_len);
+      allocAndInitData(DataSpace::Host, m_send_buffers[l], buffer_len);
+    } else {
+      allocAndInitData(getMPIDataSpace(vid), m_pack_buffers[l], buffer_len);
+      m_send_buffers[l] = m_pack_buffers[l];
+    }
+  }
+
+  m_unpack_buffers.resize(s_num_neighbors, nullptr);
+  m_recv_buffers.resize(s_num_neighbors, nullptr);
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    Index_type buffer_len = m_num_vars * m_unpack_index_list_lengths[l];
+    if (separate_buffers) {
+      allocAndInitData(getDataSpace(vid), m_unpack_buffers[l], buffer_len);
+      allocAndInitData(DataSpace::Host, m_recv_buffers[l], buffer_len);
+    } else {
+      allocAndInitData(getMPIDataSpace(vid), m_unpack_buffers[l], buffer_len);
+      m_recv_buffers[l] = m_unpack_buffers[l];
+    }
+  }
+
+  m_recv_time = 0.0;
+  m_overlap_time = 0.0;
+}
+
+void HALO_EXCHANGE_OVERLAP::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  for (Real_ptr var : m_vars) {
+    checksum[vid][tune_idx] += calcChecksum(var, m_var_size, vid);
+  }
+  for (Real_ptr res : m_results) {
+    checksum[vid][tune_idx] += calcChecksum(res, m_var_size, vid);
+  }
+}
+
+void HALO_EXCHANGE_OVERLAP::tearDown(VariantID vid, size_t tune_idx)
+{
+  if (m_recv_time > 0.0) {
+    setMetric(vid, tune_idx, m_overlap_metric,
+              100.0 * m_overlap_time / m_recv_time);
+  }
+
+  const bool separate_buffers = (getMPIDataSpace(vid) == DataSpace::Copy);
+
+  for (int l = 0; l < s_num_neighbors; ++l) {
+    if (separate_buffers) {
+      deallocData(DataSpace::Host, m_recv_buffers[l]);
+      deallocData(getDataSpace(vid), m_unpack_buffers[l]);
+    } else {
+      deallocData(getMPIDataSpace(vid), m_unpack_buffers[l]);
+    }
+  }
+  m_recv_buffers.clear();
+  m_unpack_buffers.clear();
+
+  for (int l = 0; l < s_num_neighbors; ++l) {
+    if (separate_buffers) {
+      deallocData(DataSpace::Host, m_send_buffers[l]);
+      deallocData(getDataSpace(vid), m_pack_buffers[l]);
+    } else {
+      deallocData(getMPIDataSpace(vid), m_pack_buffers[l]);
+    }
+  }
+  m_send_buffers.clear();
+  m_pack_buffers.clear();
+
+  deallocData(m_boundary_list, vid);
+  deallocData(m_interior_list, vid);
+
+  for (int v = 0; v < m_num_vars; ++v) {
+    deallocData(m_results[v], vid);
+    deallocData(m_vars[v], vid);
+  }
+  m_results.clear();
+  m_vars.clear();
+
+  tearDown_base(vid, tune_idx);
+}
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif
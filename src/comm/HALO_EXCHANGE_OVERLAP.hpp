@@ -0,0 +1,191 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// HALO_EXCHANGE_OVERLAP kernel reference implementation:
+///
+/// // post a recv for each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   Index_type len = unpack_index_list_lengths[l];
+///   MPI_Irecv(recv_buffers[l], len*num_vars, Real_MPI_type,
+///       mpi_ranks[l], recv_tags[l], MPI_COMM_WORLD, &unpack_mpi_requests[l]);
+/// }
+///
+/// // pack and send a buffer for each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   ... as in HALO_EXCHANGE ...
+///   MPI_Isend(send_buffers[l], len*num_vars, Real_MPI_type,
+///       mpi_ranks[l], send_tags[l], MPI_COMM_WORLD, &pack_mpi_requests[l]);
+/// }
+///
+/// // update the interior zones, which do not read the halo,
+/// // while messages are in flight
+/// for (Index_type v = 0; v < num_vars; ++v) {
+///   Real_ptr var = vars[v];
+///   Real_ptr res = results[v];
+///   for (Index_type ii = 0; ii < interior_len; ++ii) {
+///     Index_type idx = interior_list[ii];
+///     res[idx] = stencil_coef * ( var[idx] +
+///                                 var[idx-1]  + var[idx+1]  +
+///                                 var[idx-jp] + var[idx+jp] +
+///                                 var[idx-kp] + var[idx+kp] );
+///   }
+/// }
+///
+/// // receive and unpack a buffer from each neighbor
+/// for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+///   MPI_Waitany(num_neighbors, unpack_mpi_requests.data(), &l, MPI_STATUS_IGNORE);
+///   ... as in HALO_EXCHANGE ...
+/// }
+///
+/// // update the boundary zones, which read the halo
+/// for (Index_type v = 0; v < num_vars; ++v) {
+///   ... same stencil over boundary_list ...
+/// }
+///
+/// // wait for all sends to complete
+/// MPI_Waitall(num_neighbors, pack_mpi_requests.data(), MPI_STATUSES_IGNORE);
+///
+/// OpenMP tunings differ in how the interior update and the receives are
+/// overlapped: "nooverlap" receives before updating the interior, "tasks"
+/// runs the interior update as OpenMP tasks while the master thread
+/// receives, and "progress" dedicates the master thread to receiving while
+/// the other threads update the interior. Overlapped tunings report the
+/// percentage of receive time that was overlapped with the interior update
+/// in the kernel metric report (RAJAPerf-metrics.csv).
+///
+
+
+#ifndef RAJAPerf_Comm_HALO_EXCHANGE_OVERLAP_HPP
+#define RAJAPerf_Comm_HALO_EXCHANGE_OVERLAP_HPP
+
+#define HALO_EXCHANGE_OVERLAP_DATA_SETUP \
+  HALO_BASE_DATA_SETUP \
+  \
+  Index_type num_vars = m_num_vars; \
+  std::vector<Real_ptr> vars = m_vars; \
+  std::vector<Real_ptr> results = m_results; \
+  \
+  std::vector<int> mpi_ranks = m_mpi_ranks; \
+  \
+  std::vector<MPI_Request> pack_mpi_requests(num_neighbors); \
+  std::vector<MPI_Request> unpack_mpi_requests(num_neighbors); \
+  \
+  const DataSpace dataSpace = getDataSpace(vid); \
+  \
+  const bool separate_buffers = (getMPIDataSpace(vid) == DataSpace::Copy); \
+  \
+  std::vector<Real_ptr> pack_buffers = m_pack_buffers; \
+  std::vector<Real_ptr> unpack_buffers = m_unpack_buffers; \
+  \
+  std::vector<Real_ptr> send_buffers = m_send_buffers; \
+  std::vector<Real_ptr> recv_buffers = m_recv_buffers; \
+  \
+  Int_ptr interior_list = m_interior_list; \
+  Index_type interior_len = m_interior_len; \
+  Int_ptr boundary_list = m_boundary_list; \
+  Index_type boundary_len = m_boundary_len; \
+  \
+  const Index_type jp = m_grid_plus_halo_dims[0]; \
+  const Index_type kp = m_grid_plus_halo_dims[0] * m_grid_plus_halo_dims[1]; \
+  const Real_type stencil_coef = m_stencil_coef;
+
+#define HALO_EXCHANGE_OVERLAP_STENCIL_BODY \
+  Index_type idx = list[ii]; \
+  res[idx] = stencil_coef * ( var[idx] + \
+                              var[idx-1]  + var[idx+1]  + \
+                              var[idx-jp] + var[idx+jp] + \
+                              var[idx-kp] + var[idx+kp] );
+
+
+#include "HALO_base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include <vector>
+#include <array>
+
+namespace rajaperf
+{
+namespace comm
+{
+
+class HALO_EXCHANGE_OVERLAP : public HALO_base
+{
+public:
+
+  HALO_EXCHANGE_OVERLAP(const RunParams& params);
+
+  ~HALO_EXCHANGE_OVERLAP();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HALO_EXCHANGE_OVERLAP : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HALO_EXCHANGE_OVERLAP : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HALO_EXCHANGE_OVERLAP : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantNoOverlap(VariantID vid);
+  void runOpenMPVariantTasks(VariantID vid);
+  void runOpenMPVariantProgress(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  int m_mpi_size = -1;
+  int m_my_mpi_rank = -1;
+  std::array<int, 3> m_mpi_dims = {-1, -1, -1};
+
+  Index_type m_num_vars;
+  Index_type m_var_size;
+
+  Real_type m_stencil_coef;
+
+  std::vector<Real_ptr> m_vars;
+  std::vector<Real_ptr> m_results;
+
+  std::vector<Real_ptr> m_pack_buffers;
+  std::vector<Real_ptr> m_unpack_buffers;
+
+  std::vector<Real_ptr> m_send_buffers;
+  std::vector<Real_ptr> m_recv_buffers;
+
+  Int_ptr m_interior_list;
+  Index_type m_interior_len;
+  Int_ptr m_boundary_list;
+  Index_type m_boundary_len;
+
+  // receive time and receive time overlapped with the interior update,
+  // accumulated over the reps of the overlapped tunings
+  double m_recv_time;
+  double m_overlap_time;
+
+  // kernel metric of the percentage of receive time overlapped
+  size_t m_overlap_metric;
+};
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif
+#endif // closing endif for header file include guard
@@ -0,0 +1,301 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HALO_EXCHANGE_SHMEM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace comm
+{
+
+template < bool zero_copy >
+void HALO_EXCHANGE_SHMEM::runOpenMPVariantImpl(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALO_EXCHANGE_SHMEM_DATA_SETUP;
+
+  // each thread plays one or more emulated ranks; loops within a rank are
+  // sequential so the exchange itself is the only source of parallelism
+  const int num_threads = static_cast<int>(
+      std::min(num_ranks, static_cast<Index_type>(omp_get_max_threads())));
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      #pragma omp parallel num_threads(num_threads)
+      {
+        const Index_type rank_begin = omp_get_thread_num();
+        const Index_type rank_stride = omp_get_num_threads();
+
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+          for (Index_type r = rank_begin; r < num_ranks; r += rank_stride) {
+            for (Index_type l = 0; l < num_neighbors; ++l) {
+              Index_type c = send_channels[r*num_neighbors + l];
+              Real_ptr buffer = zero_copy ? ring_send_slot(c)
+                                          : pack_buffers[r*num_neighbors + l];
+              Int_ptr list = pack_index_lists[l];
+              Index_type len = pack_index_list_lengths[l];
+              for (Index_type v = 0; v < num_vars; ++v) {
+                Real_ptr var = vars[r*num_vars + v];
+                for (Index_type i = 0; i < len; i++) {
+                  HALO_PACK_BODY;
+                }
+                buffer += len;
+              }
+
+              if (!zero_copy) {
+                copyData(dataSpace, ring_send_slot(c),
+                         dataSpace, pack_buffers[r*num_neighbors + l],
+                         len*num_vars);
+              }
+
+              ring_send_commit(c);
+            }
+          }
+
+          for (Index_type r = rank_begin; r < num_ranks; r += rank_stride) {
+            for (Index_type l = 0; l < num_neighbors; ++l) {
+              Index_type c = r*num_neighbors + l;
+              Real_ptr buffer = ring_recv_slot(c);
+              Int_ptr list = unpack_index_lists[l];
+              Index_type len = unpack_index_list_lengths[l];
+              if (!zero_copy) {
+                copyData(dataSpace, unpack_buffers[c],
+                         dataSpace, buffer,
+                         len*num_vars);
+                ring_recv_release(c);
+                buffer = unpack_buffers[c];
+              }
+
+              for (Index_type v = 0; v < num_vars; ++v) {
+                Real_ptr var = vars[r*num_vars + v];
+                for (Index_type i = 0; i < len; i++) {
+                  HALO_UNPACK_BODY;
+                }
+                buffer += len;
+              }
+
+              if (zero_copy) {
+                ring_recv_release(c);
+              }
+            }
+          }
+
+        }
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      #pragma omp parallel num_threads(num_threads)
+      {
+        const Index_type rank_begin = omp_get_thread_num();
+        const Index_type rank_stride = omp_get_num_threads();
+
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+          for (Index_type r = rank_begin; r < num_ranks; r += rank_stride) {
+            for (Index_type l = 0; l < num_neighbors; ++l) {
+              Index_type c = send_channels[r*num_neighbors + l];
+              Real_ptr buffer = zero_copy ? ring_send_slot(c)
+                                          : pack_buffers[r*num_neighbors + l];
+              Int_ptr list = pack_index_lists[l];
+              Index_type len = pack_index_list_lengths[l];
+              for (Index_type v = 0; v < num_vars; ++v) {
+                Real_ptr var = vars[r*num_vars + v];
+                auto halo_exchange_shmem_pack_base_lam = [=](Index_type i) {
+                      HALO_PACK_BODY;
+                    };
+                for (Index_type i = 0; i < len; i++) {
+                  halo_exchange_shmem_pack_base_lam(i);
+                }
+                buffer += len;
+              }
+
+              if (!zero_copy) {
+                copyData(dataSpace, ring_send_slot(c),
+                         dataSpace, pack_buffers[r*num_neighbors + l],
+                         len*num_vars);
+              }
+
+              ring_send_commit(c);
+            }
+          }
+
+          for (Index_type r = rank_begin; r < num_ranks; r += rank_stride) {
+            for (Index_type l = 0; l < num_neighbors; ++l) {
+              Index_type c = r*num_neighbors + l;
+              Real_ptr buffer = ring_recv_slot(c);
+              Int_ptr list = unpack_index_lists[l];
+              Index_type len = unpack_index_list_lengths[l];
+              if (!zero_copy) {
+                copyData(dataSpace, unpack_buffers[c],
+                         dataSpace, buffer,
+                         len*num_vars);
+                ring_recv_release(c);
+                buffer = unpack_buffers[c];
+              }
+
+              for (Index_type v = 0; v < num_vars; ++v) {
+                Real_ptr var = vars[r*num_vars + v];
+                auto halo_exchange_shmem_unpack_base_lam = [=](Index_type i) {
+                      HALO_UNPACK_BODY;
+                    };
+                for (Index_type i = 0; i < len; i++) {
+                  halo_exchange_shmem_unpack_base_lam(i);
+                }
+                buffer += len;
+              }
+
+              if (zero_copy) {
+                ring_recv_release(c);
+              }
+            }
+          }
+
+        }
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = RAJA::seq_exec;
+
+      startTimer();
+      #pragma omp parallel num_threads(num_threads)
+      {
+        const Index_type rank_begin = omp_get_thread_num();
+        const Index_type rank_stride = omp_get_num_threads();
+
+        for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+          for (Index_type r = rank_begin; r < num_ranks; r += rank_stride) {
+            for (Index_type l = 0; l < num_neighbors; ++l) {
+              Index_type c = send_channels[r*num_neighbors + l];
+              Real_ptr buffer = zero_copy ? ring_send_slot(c)
+                                          : pack_buffers[r*num_neighbors + l];
+              Int_ptr list = pack_index_lists[l];
+              Index_type len = pack_index_list_lengths[l];
+              for (Index_type v = 0; v < num_vars; ++v) {
+                Real_ptr var = vars[r*num_vars + v];
+                auto halo_exchange_shmem_pack_base_lam = [=](Index_type i) {
+                      HALO_PACK_BODY;
+                    };
+                RAJA::forall<EXEC_POL>(
+                    RAJA::TypedRangeSegment<Index_type>(0, len),
+                    halo_exchange_shmem_pack_base_lam );
+                buffer += len;
+              }
+
+              if (!zero_copy) {
+                copyData(dataSpace, ring_send_slot(c),
+                         dataSpace, pack_buffers[r*num_neighbors + l],
+                         len*num_vars);
+              }
+
+              ring_send_commit(c);
+            }
+          }
+
+          for (Index_type r = rank_begin; r < num_ranks; r += rank_stride) {
+            for (Index_type l = 0; l < num_neighbors; ++l) {
+              Index_type c = r*num_neighbors + l;
+              Real_ptr buffer = ring_recv_slot(c);
+              Int_ptr list = unpack_index_lists[l];
+              Index_type len = unpack_index_list_lengths[l];
+              if (!zero_copy) {
+                copyData(dataSpace, unpack_buffers[c],
+                         dataSpace, buffer,
+                         len*num_vars);
+                ring_recv_release(c);
+                buffer = unpack_buffers[c];
+              }
+
+              for (Index_type v = 0; v < num_vars; ++v) {
+                Real_ptr var = vars[r*num_vars + v];
+                auto halo_exchange_shmem_unpack_base_lam = [=](Index_type i) {
+                      HALO_UNPACK_BODY;
+                    };
+                RAJA::forall<EXEC_POL>(
+                    RAJA::TypedRangeSegment<Index_type>(0, len),
+                    halo_exchange_shmem_unpack_base_lam );
+                buffer += len;
+              }
+
+              if (zero_copy) {
+                ring_recv_release(c);
+              }
+            }
+          }
+
+        }
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALO_EXCHANGE_SHMEM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALO_EXCHANGE_SHMEM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<false>(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<true>(vid);
+
+  }
+
+  t += 1;
+}
+
+void HALO_EXCHANGE_SHMEM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  addVariantTuningName(vid, "zerocopy");
+}
+
+} // end namespace comm
+} // end namespace rajaperf
@@ -0,0 +1,201 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HALO_EXCHANGE_SHMEM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rajaperf
+{
+namespace comm
+{
+
+HALO_EXCHANGE_SHMEM::HALO_EXCHANGE_SHMEM(const RunParams& params)
+  : HALO_base(rajaperf::Comm_HALO_EXCHANGE_SHMEM, params)
+{
+  m_shmem_dims = params.getShmem3DDivision();
+  m_num_ranks = m_shmem_dims[0] * m_shmem_dims[1] * m_shmem_dims[2];
+
+  // split the target problem size over the emulated ranks unless the
+  // grid dimensions of each rank were given explicitly
+  if (params.getHaloGridDims()[0] <= 0) {
+    double cbrt_rank_size = std::cbrt(getTargetProblemSize() /
+                                      static_cast<double>(m_num_ranks));
+
+    for (int dim = 0; dim < 3; ++dim) {
+      m_grid_dims[dim] = std::max(m_halo_width,
+                                  static_cast<Index_type>(cbrt_rank_size));
+    }
+  }
+
+  for (int dim = 0; dim < 3; ++dim) {
+    m_grid_plus_halo_dims[dim] = m_grid_dims[dim] + 2*m_halo_width;
+  }
+  m_grid_plus_halo_size = m_grid_plus_halo_dims[0] *
+                          m_grid_plus_halo_dims[1] *
+                          m_grid_plus_halo_dims[2] ;
+
+  const Index_type rank_grid_size = m_grid_dims[0] *
+                                    m_grid_dims[1] *
+                                    m_grid_dims[2] ;
+
+  setActualProblemSize( m_num_ranks * rank_grid_size );
+
+  setDefaultReps(200);
+
+  m_num_vars = m_halo_num_vars;
+  m_var_size = m_grid_plus_halo_size ;
+
+  setItsPerRep( m_num_ranks * m_num_vars * (m_var_size - rank_grid_size) );
+  setKernelsPerRep( 2 * s_num_neighbors * m_num_vars * m_num_ranks );
+  setBytesPerRep( (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +  // pack
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +  // pack
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +  // send
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * getItsPerRep() +  // recv
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +  // unpack
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() ); // unpack
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+HALO_EXCHANGE_SHMEM::~HALO_EXCHANGE_SHMEM()
+{
+}
+
+void HALO_EXCHANGE_SHMEM::setUp(VariantID vid, size_t tune_idx)
+{
+  // index lists are the same on every rank, keep those of rank 0
+  setUp_base(0, m_shmem_dims.data(), vid, tune_idx);
+
+  //
+  // Use create_lists to get the neighbors and message tags of every
+  // emulated rank, then match each send to the receiving rank's ring
+  // the same way MPI matches (source, tag) pairs.
+  //
+  std::vector<std::vector<int>> rank_neighbors(m_num_ranks);
+  std::vector<std::vector<int>> rank_send_tags(m_num_ranks);
+  std::vector<std::vector<int>> rank_recv_tags(m_num_ranks);
+  for (Index_type r = 0; r < m_num_ranks; ++r) {
+    rank_neighbors[r].resize(s_num_neighbors, -1);
+    rank_send_tags[r].resize(s_num_neighbors, -1);
+    rank_recv_tags[r].resize(s_num_neighbors, -1);
+
+    std::vector<Int_ptr> pack_index_lists(s_num_neighbors, nullptr);
+    std::vector<Index_type> pack_index_list_lengths(s_num_neighbors, 0);
+    std::vector<Int_ptr> unpack_index_lists(s_num_neighbors, nullptr);
+    std::vector<Index_type> unpack_index_list_lengths(s_num_neighbors, 0);
+
+    create_lists(r, m_shmem_dims.data(), rank_neighbors[r],
+        rank_send_tags[r], pack_index_lists, pack_index_list_lengths,
+        rank_recv_tags[r], unpack_index_lists, unpack_index_list_lengths,
+        m_halo_width, m_grid_dims,
+        s_num_neighbors, vid);
+
+    destroy_lists(pack_index_lists, unpack_index_lists, s_num_neighbors, vid);
+  }
+
+  m_send_channels.resize(m_num_ranks * s_num_neighbors, -1);
+  for (Index_type r = 0; r < m_num_ranks; ++r) {
+    for (Index_type l = 0; l < s_num_neighbors; ++l) {
+      const int q = rank_neighbors[r][l];
+      for (Index_type lq = 0; lq < s_num_neighbors; ++lq) {
+        if (rank_neighbors[q][lq] == r &&
+            rank_recv_tags[q][lq] == rank_send_tags[r][l]) {
+          m_send_channels[r*s_num_neighbors + l] = q*s_num_neighbors + lq;
+          break;
+        }
+      }
+    }
+  }
+
+  m_vars.resize(m_num_ranks * m_num_vars, nullptr);
+  for (Index_type r = 0; r < m_num_ranks; ++r) {
+    for (Index_type v = 0; v < m_num_vars; ++v) {
+      Real_ptr& var_ref = m_vars[r*m_num_vars + v];
+      allocAndInitData(var_ref, m_var_size, vid);
+      auto reset_var = scopedMoveData(var_ref, m_var_size, vid);
+
+      Real_ptr var = var_ref;
+
+      for (Index_type i = 0; i < m_var_size; i++) {
+        var[i] = i + v + r*m_num_vars;
+      }
+    }
+  }
+
+  const Index_type num_channels = m_num_ranks * s_num_neighbors;
+
+  m_pack_buffers.resize(num_channels, nullptr);
+  m_unpack_buffers.resize(num_channels, nullptr);
+  m_ring_buffers.resize(num_channels, nullptr);
+  m_ring_slot_lengths.resize(num_channels, 0);
+  m_ring_heads.reset(new std::atomic<Index_type>[num_channels]);
+  m_ring_tails.reset(new std::atomic<Index_type>[num_channels]);
+  for (Index_type c = 0; c < num_channels; ++c) {
+    const Index_type l = c % s_num_neighbors;
+
+    allocAndInitData(m_pack_buffers[c],
+                     m_num_vars * m_pack_index_list_lengths[l], vid);
+    allocAndInitData(m_unpack_buffers[c],
+                     m_num_vars * m_unpack_index_list_lengths[l], vid);
+
+    m_ring_slot_lengths[c] = m_num_vars * m_unpack_index_list_lengths[l];
+    allocAndInitData(m_ring_buffers[c],
+                     s_ring_depth * m_ring_slot_lengths[c], vid);
+    m_ring_heads[c].store(0);
+    m_ring_tails[c].store(0);
+  }
+}
+
+void HALO_EXCHANGE_SHMEM::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  for (Real_ptr var : m_vars) {
+    checksum[vid][tune_idx] += calcChecksum(var, m_var_size, vid);
+  }
+}
+
+void HALO_EXCHANGE_SHMEM::tearDown(VariantID vid, size_t tune_idx)
+{
+  const Index_type num_channels = m_num_ranks * s_num_neighbors;
+
+  for (Index_type c = 0; c < num_channels; ++c) {
+    deallocData(m_ring_buffers[c], vid);
+    deallocData(m_unpack_buffers[c], vid);
+    deallocData(m_pack_buffers[c], vid);
+  }
+  m_ring_tails.reset();
+  m_ring_heads.reset();
+  m_ring_slot_lengths.clear();
+  m_ring_buffers.clear();
+  m_unpack_buffers.clear();
+  m_pack_buffers.clear();
+
+  for (Real_ptr& var : m_vars) {
+    deallocData(var, vid);
+  }
+  m_vars.clear();
+
+  m_send_channels.clear();
+
+  tearDown_base(vid, tune_idx);
+}
+
+} // end namespace comm
+} // end namespace rajaperf
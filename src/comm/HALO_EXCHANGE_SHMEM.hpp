@@ -0,0 +1,177 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// HALO_EXCHANGE_SHMEM kernel reference implementation:
+///
+/// Ranks of a 3d decomposition are emulated in one process and exchange
+/// messages through single-producer/single-consumer ring buffers in
+/// shared memory, one ring per (receiving rank, neighbor) pair.
+///
+/// for (Index_type r = 0; r < num_ranks; ++r) {
+///   // pack and send a message to each neighbor
+///   for (Index_type l = 0; l < num_neighbors; ++l) {
+///     Index_type c = send_channels[r*num_neighbors + l];
+///     Real_ptr buffer = ring_send_slot(c);
+///     Int_ptr list = pack_index_lists[l];
+///     Index_type len = pack_index_list_lengths[l];
+///     for (Index_type v = 0; v < num_vars; ++v) {
+///       Real_ptr var = vars[r*num_vars + v];
+///       for (Index_type i = 0; i < len; i++) {
+///         buffer[i] = var[list[i]];
+///       }
+///       buffer += len;
+///     }
+///     ring_send_commit(c);
+///   }
+/// }
+///
+/// for (Index_type r = 0; r < num_ranks; ++r) {
+///   // receive and unpack a message from each neighbor
+///   for (Index_type l = 0; l < num_neighbors; ++l) {
+///     Index_type c = r*num_neighbors + l;
+///     Real_ptr buffer = ring_recv_slot(c);
+///     Int_ptr list = unpack_index_lists[l];
+///     Index_type len = unpack_index_list_lengths[l];
+///     for (Index_type v = 0; v < num_vars; ++v) {
+///       Real_ptr var = vars[r*num_vars + v];
+///       for (Index_type i = 0; i < len; i++) {
+///         var[list[i]] = buffer[i];
+///       }
+///       buffer += len;
+///     }
+///     ring_recv_release(c);
+///   }
+/// }
+///
+/// The "default" tuning packs into a private buffer and copies it into the
+/// ring (and copies out of the ring before unpacking) like an eager message
+/// transport; the "zerocopy" tuning packs and unpacks directly in the ring.
+/// OpenMP variants run each emulated rank on its own thread.
+///
+
+#ifndef RAJAPerf_Comm_HALO_EXCHANGE_SHMEM_HPP
+#define RAJAPerf_Comm_HALO_EXCHANGE_SHMEM_HPP
+
+#define HALO_EXCHANGE_SHMEM_DATA_SETUP \
+  HALO_BASE_DATA_SETUP \
+  \
+  Index_type num_ranks = m_num_ranks; \
+  Index_type num_vars = m_num_vars; \
+  std::vector<Real_ptr> vars = m_vars; \
+  \
+  const DataSpace dataSpace = getDataSpace(vid); \
+  \
+  std::vector<Index_type> send_channels = m_send_channels; \
+  \
+  std::vector<Real_ptr> pack_buffers = m_pack_buffers; \
+  std::vector<Real_ptr> unpack_buffers = m_unpack_buffers;
+
+
+#include "HALO_base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace rajaperf
+{
+namespace comm
+{
+
+class HALO_EXCHANGE_SHMEM : public HALO_base
+{
+public:
+
+  HALO_EXCHANGE_SHMEM(const RunParams& params);
+
+  ~HALO_EXCHANGE_SHMEM();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HALO_EXCHANGE_SHMEM : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HALO_EXCHANGE_SHMEM : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HALO_EXCHANGE_SHMEM : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < bool zero_copy >
+  void runSeqVariantImpl(VariantID vid);
+  template < bool zero_copy >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  // messages each ring can hold; two lets a rank run one exchange ahead
+  static const Index_type s_ring_depth = 2;
+
+  //
+  // Ring buffer access. Channel c receives messages for rank c / num_neighbors
+  // from neighbor c % num_neighbors. Send/recv spin until a slot is free/full.
+  //
+  Real_ptr ring_send_slot(Index_type c)
+  {
+    const Index_type head = m_ring_heads[c].load(std::memory_order_relaxed);
+    while (head - m_ring_tails[c].load(std::memory_order_acquire) == s_ring_depth) { }
+    return m_ring_buffers[c] + (head % s_ring_depth) * m_ring_slot_lengths[c];
+  }
+  void ring_send_commit(Index_type c)
+  {
+    m_ring_heads[c].fetch_add(1, std::memory_order_release);
+  }
+  Real_ptr ring_recv_slot(Index_type c)
+  {
+    const Index_type tail = m_ring_tails[c].load(std::memory_order_relaxed);
+    while (m_ring_heads[c].load(std::memory_order_acquire) == tail) { }
+    return m_ring_buffers[c] + (tail % s_ring_depth) * m_ring_slot_lengths[c];
+  }
+  void ring_recv_release(Index_type c)
+  {
+    m_ring_tails[c].fetch_add(1, std::memory_order_release);
+  }
+
+  std::array<int, 3> m_shmem_dims = {-1, -1, -1};
+  Index_type m_num_ranks;
+
+  Index_type m_num_vars;
+  Index_type m_var_size;
+
+  std::vector<Real_ptr> m_vars;
+
+  std::vector<Index_type> m_send_channels;
+
+  std::vector<Real_ptr> m_pack_buffers;
+  std::vector<Real_ptr> m_unpack_buffers;
+
+  std::vector<Real_ptr> m_ring_buffers;
+  std::vector<Index_type> m_ring_slot_lengths;
+  std::unique_ptr<std::atomic<Index_type>[]> m_ring_heads;
+  std::unique_ptr<std::atomic<Index_type>[]> m_ring_tails;
+};
+
+} // end namespace comm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
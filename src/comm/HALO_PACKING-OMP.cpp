@@ -18,7 +18,7 @@ namespace comm
 {
 
 
-void HALO_PACKING::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALO_PACKING::runOpenMPVariantIndexList(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -204,5 +204,126 @@ void HALO_PACKING::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 #endif
 }
 
+template < typename segment_helper >
+void HALO_PACKING::runOpenMPVariantCompressed(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALO_PACKING_DATA_SETUP;
+  HALO_BASE_PLAN_DATA_SETUP;
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    for (Index_type l = 0; l < num_neighbors; ++l) {
+      Real_ptr buffer = pack_buffers[l];
+      HaloSegment* plan = pack_plans[l];
+      Index_type plan_len = pack_plan_lengths[l];
+      Index_type len = pack_index_list_lengths[l];
+      for (Index_type v = 0; v < num_vars; ++v) {
+        Real_ptr var = vars[v];
+        #pragma omp parallel
+        for (Index_type s = 0; s < plan_len; ++s) {
+          const HaloSegment seg = plan[s];
+          #pragma omp for nowait
+          for (Int_type r = 0; r < seg.num_runs; ++r) {
+            segment_helper::pack_run(buffer, var, seg, r);
+          }
+        }
+        buffer += len;
+      }
+
+      if (separate_buffers) {
+        copyData(DataSpace::Host, send_buffers[l],
+                 dataSpace, pack_buffers[l],
+                 len*num_vars);
+      }
+    }
+
+    for (Index_type l = 0; l < num_neighbors; ++l) {
+      Real_ptr buffer = unpack_buffers[l];
+      HaloSegment* plan = unpack_plans[l];
+      Index_type plan_len = unpack_plan_lengths[l];
+      Index_type len = unpack_index_list_lengths[l];
+      if (separate_buffers) {
+        copyData(dataSpace, unpack_buffers[l],
+                 DataSpace::Host, recv_buffers[l],
+                 len*num_vars);
+      }
+
+      for (Index_type v = 0; v < num_vars; ++v) {
+        Real_ptr var = vars[v];
+        #pragma omp parallel
+        for (Index_type s = 0; s < plan_len; ++s) {
+          const HaloSegment seg = plan[s];
+          #pragma omp for nowait
+          for (Int_type r = 0; r < seg.num_runs; ++r) {
+            segment_helper::unpack_run(buffer, var, seg, r);
+          }
+        }
+        buffer += len;
+      }
+    }
+
+  }
+  stopTimer();
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALO_PACKING::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  for (int io = 0; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantIndexList(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(halo_segment_helpers{}, [&](auto segment_helper) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantCompressed<decltype(segment_helper)>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void HALO_PACKING::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (int io = 0; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+    addVariantTuningName(vid, getSFCOrderingName(static_cast<SFCOrdering>(io)));
+  }
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(halo_segment_helpers{}, [&](auto segment_helper) {
+
+      addVariantTuningName(vid, "compressed_"+decltype(segment_helper)::get_name());
+
+    });
+
+  }
+}
+
 } // end namespace comm
 } // end namespace rajaperf
@@ -18,7 +18,7 @@ namespace comm
 {
 
 
-void HALO_PACKING::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALO_PACKING::runSeqVariantIndexList(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -198,5 +198,116 @@ void HALO_PACKING::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+template < typename segment_helper >
+void HALO_PACKING::runSeqVariantCompressed(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALO_PACKING_DATA_SETUP;
+  HALO_BASE_PLAN_DATA_SETUP;
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    for (Index_type l = 0; l < num_neighbors; ++l) {
+      Real_ptr buffer = pack_buffers[l];
+      HaloSegment* plan = pack_plans[l];
+      Index_type plan_len = pack_plan_lengths[l];
+      Index_type len = pack_index_list_lengths[l];
+      for (Index_type v = 0; v < num_vars; ++v) {
+        Real_ptr var = vars[v];
+        for (Index_type s = 0; s < plan_len; ++s) {
+          const HaloSegment seg = plan[s];
+          for (Int_type r = 0; r < seg.num_runs; ++r) {
+            segment_helper::pack_run(buffer, var, seg, r);
+          }
+        }
+        buffer += len;
+      }
+
+      if (separate_buffers) {
+        copyData(DataSpace::Host, send_buffers[l],
+                 dataSpace, pack_buffers[l],
+                 len*num_vars);
+      }
+    }
+
+    for (Index_type l = 0; l < num_neighbors; ++l) {
+      Real_ptr buffer = unpack_buffers[l];
+      HaloSegment* plan = unpack_plans[l];
+      Index_type plan_len = unpack_plan_lengths[l];
+      Index_type len = unpack_index_list_lengths[l];
+      if (separate_buffers) {
+        copyData(dataSpace, unpack_buffers[l],
+                 DataSpace::Host, recv_buffers[l],
+                 len*num_vars);
+      }
+
+      for (Index_type v = 0; v < num_vars; ++v) {
+        Real_ptr var = vars[v];
+        for (Index_type s = 0; s < plan_len; ++s) {
+          const HaloSegment seg = plan[s];
+          for (Int_type r = 0; r < seg.num_runs; ++r) {
+            segment_helper::unpack_run(buffer, var, seg, r);
+          }
+        }
+        buffer += len;
+      }
+    }
+
+  }
+  stopTimer();
+}
+
+void HALO_PACKING::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  for (int io = 0; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantIndexList(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+  if (vid == Base_Seq) {
+
+    seq_for(halo_segment_helpers{}, [&](auto segment_helper) {
+
+      if (tune_idx == t) {
+
+        runSeqVariantCompressed<decltype(segment_helper)>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
+}
+
+void HALO_PACKING::setSeqTuningDefinitions(VariantID vid)
+{
+  for (int io = 0; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+    addVariantTuningName(vid, getSFCOrderingName(static_cast<SFCOrdering>(io)));
+  }
+
+  if (vid == Base_Seq) {
+
+    seq_for(halo_segment_helpers{}, [&](auto segment_helper) {
+
+      addVariantTuningName(vid, "compressed_"+decltype(segment_helper)::get_name());
+
+    });
+
+  }
+}
+
 } // end namespace comm
 } // end namespace rajaperf
@@ -20,7 +20,7 @@ HALO_PACKING::HALO_PACKING(const RunParams& params)
 {
   setDefaultReps(200);
 
-  m_num_vars = s_num_vars_default;
+  m_num_vars = m_halo_num_vars;
   m_var_size = m_grid_plus_halo_size ;
 
   setItsPerRep( m_num_vars * (m_var_size - getActualProblemSize()) );
@@ -62,15 +62,60 @@ void HALO_PACKING::setUp(VariantID vid, size_t tune_idx)
   setUp_base(my_mpi_rank, mpi_dims, vid, tune_idx);
 
   m_vars.resize(m_num_vars, nullptr);
-  for (Index_type v = 0; v < m_num_vars; ++v) {
-    allocAndInitData(m_vars[v], m_var_size, vid);
-    auto reset_var = scopedMoveData(m_vars[v], m_var_size, vid);
 
-    Real_ptr var = m_vars[v];
+  // the compressed tunings make their plans from the lexicographic lists
+  const std::string tuning_name = getVariantTuningName(vid, tune_idx);
+  const SFCOrdering ordering =
+      (tuning_name.find("compressed_") == 0) ? SFCOrdering::Lexicographic
+                                             : getSFCOrderingFromName(tuning_name);
+
+  if (m_interleaved_vars) {
+
+    //
+    // Store the variables interleaved in one array, var v at offset v,
+    // so each list entry touches num_vars adjacent values.
+    //
+    renumber_lists(ordering, vid);
+    interleave_lists(m_num_vars, vid);
+
+    allocAndInitData(m_var_block, m_num_vars * m_var_size, vid);
+    {
+      auto reset_var = scopedMoveData(m_var_block, m_num_vars * m_var_size, vid);
+
+      for (Index_type r = 0; r < m_var_size; r++) {
+        const Index_type i = m_sfc_order.empty() ? r : m_sfc_order[r];
+        for (Index_type v = 0; v < m_num_vars; ++v) {
+          m_var_block[r*m_num_vars + v] = i + v;
+        }
+      }
+    }
 
-    for (Index_type i = 0; i < m_var_size; i++) {
-      var[i] = i + v;
+    for (Index_type v = 0; v < m_num_vars; ++v) {
+      m_vars[v] = m_var_block + v;
     }
+
+  } else {
+
+    for (Index_type v = 0; v < m_num_vars; ++v) {
+      allocAndInitData(m_vars[v], m_var_size, vid);
+      auto reset_var = scopedMoveData(m_vars[v], m_var_size, vid);
+
+      Real_ptr var = m_vars[v];
+
+      for (Index_type i = 0; i < m_var_size; i++) {
+        var[i] = i + v;
+      }
+    }
+
+    renumber_lists(ordering, vid);
+    for (Index_type v = 0; v < m_num_vars; ++v) {
+      renumber_var(m_vars[v], vid);
+    }
+
+  }
+
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    create_plans(vid);
   }
 
   const bool separate_buffers = (getMPIDataSpace(vid) == DataSpace::Copy);
@@ -104,8 +149,12 @@ void HALO_PACKING::setUp(VariantID vid, size_t tune_idx)
 
 void HALO_PACKING::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  for (Real_ptr var : m_vars) {
-    checksum[vid][tune_idx] += calcChecksum(var, m_var_size, vid);
+  if (m_interleaved_vars) {
+    checksum[vid][tune_idx] += calcInterleavedVarsChecksum(m_var_block, m_num_vars, vid);
+  } else {
+    for (Index_type v = 0; v < m_num_vars; ++v) {
+      checksum[vid][tune_idx] += calcVarChecksum(m_vars[v], vid);
+    }
   }
 
   const bool separate_buffers = (getMPIDataSpace(vid) == DataSpace::Copy);
@@ -146,8 +195,12 @@ void HALO_PACKING::tearDown(VariantID vid, size_t tune_idx)
   m_send_buffers.clear();
   m_pack_buffers.clear();
 
-  for (int v = 0; v < m_num_vars; ++v) {
-    deallocData(m_vars[v], vid);
+  if (m_interleaved_vars) {
+    deallocData(m_var_block, vid);
+  } else {
+    for (int v = 0; v < m_num_vars; ++v) {
+      deallocData(m_vars[v], vid);
+    }
   }
   m_vars.clear();
 
@@ -372,6 +372,95 @@ void HALO_PACKING_FUSED::runOpenMPVariantWorkGroup(VariantID vid)
 #endif
 }
 
+template < typename segment_helper >
+void HALO_PACKING_FUSED::runOpenMPVariantCompressed(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALO_PACKING_FUSED_DATA_SETUP;
+  HALO_BASE_PLAN_DATA_SETUP;
+
+  HALO_PACKING_FUSED_COMPRESSED_FUSER_SETUP;
+
+  startTimer();
+  for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+    Index_type pack_index = 0;
+
+    for (Index_type l = 0; l < num_neighbors; ++l) {
+      Real_ptr buffer = pack_buffers[l];
+      HaloSegment* plan = pack_plans[l];
+      Index_type plan_len = pack_plan_lengths[l];
+      Index_type len = pack_index_list_lengths[l];
+      for (Index_type v = 0; v < num_vars; ++v) {
+        Real_ptr var = vars[v];
+        for (Index_type s = 0; s < plan_len; ++s) {
+          pack_segment_holders[pack_index] = segment_holder{buffer, var, plan[s]};
+          pack_index += 1;
+        }
+        buffer += len;
+      }
+    }
+    #pragma omp parallel
+    for (Index_type j = 0; j < pack_index; j++) {
+      const segment_holder holder = pack_segment_holders[j];
+      #pragma omp for nowait
+      for (Int_type r = 0; r < holder.seg.num_runs; ++r) {
+        segment_helper::pack_run(holder.buffer, holder.var, holder.seg, r);
+      }
+    }
+    if (separate_buffers) {
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Index_type len = pack_index_list_lengths[l];
+        copyData(DataSpace::Host, send_buffers[l],
+                 dataSpace, pack_buffers[l],
+                 len*num_vars);
+      }
+    }
+
+    Index_type unpack_index = 0;
+
+    for (Index_type l = 0; l < num_neighbors; ++l) {
+      Real_ptr buffer = unpack_buffers[l];
+      HaloSegment* plan = unpack_plans[l];
+      Index_type plan_len = unpack_plan_lengths[l];
+      Index_type len = unpack_index_list_lengths[l];
+      if (separate_buffers) {
+        copyData(dataSpace, unpack_buffers[l],
+                 DataSpace::Host, recv_buffers[l],
+                 len*num_vars);
+      }
+
+      for (Index_type v = 0; v < num_vars; ++v) {
+        Real_ptr var = vars[v];
+        for (Index_type s = 0; s < plan_len; ++s) {
+          unpack_segment_holders[unpack_index] = segment_holder{buffer, var, plan[s]};
+          unpack_index += 1;
+        }
+        buffer += len;
+      }
+    }
+    #pragma omp parallel
+    for (Index_type j = 0; j < unpack_index; j++) {
+      const segment_holder holder = unpack_segment_holders[j];
+      #pragma omp for nowait
+      for (Int_type r = 0; r < holder.seg.num_runs; ++r) {
+        segment_helper::unpack_run(holder.buffer, holder.var, holder.seg, r);
+      }
+    }
+
+  }
+  stopTimer();
+
+  HALO_PACKING_FUSED_COMPRESSED_FUSER_TEARDOWN;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
 void HALO_PACKING_FUSED::runOpenMPVariant(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
@@ -403,6 +492,22 @@ void HALO_PACKING_FUSED::runOpenMPVariant(VariantID vid, size_t tune_idx)
     });
 
   }
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(halo_segment_helpers{}, [&](auto segment_helper) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantCompressed<decltype(segment_helper)>(vid);
+
+      }
+
+      t += 1;
+
+    });
+
+  }
 }
 
 void HALO_PACKING_FUSED::setOpenMPTuningDefinitions(VariantID vid)
@@ -422,6 +527,16 @@ void HALO_PACKING_FUSED::setOpenMPTuningDefinitions(VariantID vid)
     });
 
   }
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(halo_segment_helpers{}, [&](auto segment_helper) {
+
+      addVariantTuningName(vid, "compressed_"+decltype(segment_helper)::get_name());
+
+    });
+
+  }
 }
 
 } // end namespace comm
@@ -20,7 +20,7 @@ HALO_PACKING_FUSED::HALO_PACKING_FUSED(const RunParams& params)
 {
   setDefaultReps(200);
 
-  m_num_vars = s_num_vars_default;
+  m_num_vars = m_halo_num_vars;
   m_var_size = m_grid_plus_halo_size ;
 
   setItsPerRep( m_num_vars * (m_var_size - getActualProblemSize()) );
@@ -73,6 +73,10 @@ void HALO_PACKING_FUSED::setUp(VariantID vid, size_t tune_idx)
     }
   }
 
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    create_plans(vid);
+  }
+
   const bool separate_buffers = (getMPIDataSpace(vid) == DataSpace::Copy);
 
   m_pack_buffers.resize(s_num_neighbors, nullptr);
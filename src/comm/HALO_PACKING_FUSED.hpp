@@ -39,6 +39,12 @@
 ///   }
 /// }
 ///
+/// The "compressed_block_copy" and "compressed_simd" tunings of the Base
+/// Seq and OpenMP variants fuse the segments of the compressed plans of
+/// HALO_base in place of the index lists, copying each strided run with
+/// std::copy or with a SIMD loop. As in HALO_PACKING, the bytes per rep
+/// count the index lists for every tuning.
+///
 
 #ifndef RAJAPerf_Comm_HALO_PACKING_FUSED_HPP
 #define RAJAPerf_Comm_HALO_PACKING_FUSED_HPP
@@ -77,6 +83,26 @@
   delete[] unpack_lens;
 
 
+#define HALO_PACKING_FUSED_COMPRESSED_FUSER_SETUP \
+  struct segment_holder { \
+    Real_ptr buffer; \
+    Real_ptr var; \
+    HaloSegment seg; \
+  }; \
+  Index_type num_pack_segments = 0; \
+  Index_type num_unpack_segments = 0; \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    num_pack_segments += num_vars * pack_plan_lengths[l]; \
+    num_unpack_segments += num_vars * unpack_plan_lengths[l]; \
+  } \
+  segment_holder* pack_segment_holders = new segment_holder[num_pack_segments]; \
+  segment_holder* unpack_segment_holders = new segment_holder[num_unpack_segments];
+
+#define HALO_PACKING_FUSED_COMPRESSED_FUSER_TEARDOWN \
+  delete[] pack_segment_holders; \
+  delete[] unpack_segment_holders;
+
+
 #define HALO_PACKING_FUSED_MANUAL_LAMBDA_FUSER_SETUP \
   auto make_pack_lambda = [](Real_ptr buffer, Int_ptr list, Real_ptr var) { \
     return [=](Index_type i) { \
@@ -160,6 +186,11 @@ public:
   template < size_t block_size, typename dispatch_helper >
   void runHipVariantWorkGroup(VariantID vid);
 
+  template < typename segment_helper >
+  void runSeqVariantCompressed(VariantID vid);
+  template < typename segment_helper >
+  void runOpenMPVariantCompressed(VariantID vid);
+
 private:
   static const size_t default_gpu_block_size = 1024;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
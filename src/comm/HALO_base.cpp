@@ -13,12 +13,71 @@
 #include <utility>
 #include <cmath>
 #include <map>
+#include <numeric>
+#include <vector>
 
 namespace rajaperf
 {
 namespace comm
 {
 
+namespace
+{
+
+//
+// Compress an index list into segments of strided runs, greedily taking
+// the longest run of constant positive stride from each entry and then as
+// many following runs of the same shape at a constant distance as match.
+//
+std::vector<HaloSegment> compressList(const Int_type* list, Index_type len)
+{
+  std::vector<HaloSegment> segments;
+
+  Index_type p = 0;
+  while (p < len) {
+
+    Index_type run_len = 1;
+    Int_type elem_stride = 1;
+    if (p + 1 < len && list[p+1] > list[p]) {
+      elem_stride = list[p+1] - list[p];
+      run_len = 2;
+      while (p + run_len < len &&
+             list[p+run_len] - list[p+run_len-1] == elem_stride) {
+        run_len += 1;
+      }
+    }
+
+    Index_type num_runs = 1;
+    Int_type run_stride = 0;
+    Index_type q = p + run_len;
+    if (q + run_len <= len &&
+        list[q] - list[p] >= run_len * elem_stride) {
+      run_stride = list[q] - list[p];
+      while (q + run_len <= len) {
+        const Int_type run_start = list[p] + num_runs * run_stride;
+        bool match = true;
+        for (Index_type k = 0; k < run_len && match; ++k) {
+          match = (list[q+k] == run_start + k * elem_stride);
+        }
+        if (!match) {
+          break;
+        }
+        num_runs += 1;
+        q += run_len;
+      }
+    }
+
+    segments.push_back(HaloSegment{static_cast<Int_type>(p), list[p],
+                                   static_cast<Int_type>(run_len), elem_stride,
+                                   static_cast<Int_type>(num_runs), run_stride});
+    p = q;
+  }
+
+  return segments;
+}
+
+} // end unnamed namespace
+
 Index_type HALO_base::s_grid_dims_default[3] {100, 100, 100};
 Index_type HALO_base::s_halo_width_default = 1;
 Index_type HALO_base::s_num_vars_default = 3;
@@ -30,12 +89,22 @@ HALO_base::HALO_base(KernelID kid, const RunParams& params)
                          s_grid_dims_default[1] *
                          s_grid_dims_default[2] );
 
-  double cbrt_run_size = std::cbrt(getTargetProblemSize());
+  if (params.getHaloGridDims()[0] > 0) {
+    m_grid_dims[0] = params.getHaloGridDims()[0];
+    m_grid_dims[1] = params.getHaloGridDims()[1];
+    m_grid_dims[2] = params.getHaloGridDims()[2];
+  } else {
+    double cbrt_run_size = std::cbrt(getTargetProblemSize());
 
-  m_grid_dims[0] = cbrt_run_size;
-  m_grid_dims[1] = cbrt_run_size;
-  m_grid_dims[2] = cbrt_run_size;
-  m_halo_width = s_halo_width_default;
+    m_grid_dims[0] = cbrt_run_size;
+    m_grid_dims[1] = cbrt_run_size;
+    m_grid_dims[2] = cbrt_run_size;
+  }
+  m_halo_width = (params.getHaloWidth() > 0) ? params.getHaloWidth()
+                                             : s_halo_width_default;
+  m_halo_num_vars = (params.getHaloNumVars() > 0) ? params.getHaloNumVars()
+                                                  : s_num_vars_default;
+  m_interleaved_vars = params.getHaloInterleavedVars();
 
   m_grid_plus_halo_dims[0] = m_grid_dims[0] + 2*m_halo_width;
   m_grid_plus_halo_dims[1] = m_grid_dims[1] + 2*m_halo_width;
@@ -44,7 +113,9 @@ HALO_base::HALO_base(KernelID kid, const RunParams& params)
                           m_grid_plus_halo_dims[1] *
                           m_grid_plus_halo_dims[2] ;
 
-  setActualProblemSize( m_grid_dims[0] * m_grid_dims[1] * m_grid_dims[1] );
+  setActualProblemSize( m_grid_dims[0] * m_grid_dims[1] * m_grid_dims[2] );
+
+  m_message_bytes_metric = addMetricName("avg message bytes");
 }
 
 HALO_base::~HALO_base()
@@ -52,7 +123,7 @@ HALO_base::~HALO_base()
 }
 
 void HALO_base::setUp_base(const int my_mpi_rank, const int* mpi_dims,
-                                   VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+                                   VariantID vid, size_t tune_idx)
 {
   m_mpi_ranks.resize(s_num_neighbors, -1);
   m_send_tags.resize(s_num_neighbors, -1);
@@ -66,11 +137,20 @@ void HALO_base::setUp_base(const int my_mpi_rank, const int* mpi_dims,
       m_recv_tags, m_unpack_index_lists, m_unpack_index_list_lengths,
       m_halo_width, m_grid_dims,
       s_num_neighbors, vid);
+
+  Index_type message_len = 0;
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    message_len += m_halo_num_vars * m_pack_index_list_lengths[l];
+  }
+  setMetric(vid, tune_idx, m_message_bytes_metric,
+            static_cast<double>(message_len * sizeof(Real_type)) / s_num_neighbors);
 }
 
 void HALO_base::tearDown_base(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
+  destroy_plans(vid);
   destroy_lists(m_pack_index_lists, m_unpack_index_lists, s_num_neighbors, vid);
+  m_sfc_order.clear();
   m_unpack_index_list_lengths.clear();
   m_unpack_index_lists.clear();
   m_recv_tags.clear();
@@ -309,5 +389,183 @@ void HALO_base::destroy_lists(
   }
 }
 
+//
+// Function to compress packing and unpacking index lists into plans of
+// strided runs, after any renumbering or interleaving of the lists.
+//
+void HALO_base::create_plans(VariantID vid)
+{
+  m_pack_plans.resize(s_num_neighbors, nullptr);
+  m_pack_plan_lengths.resize(s_num_neighbors, 0);
+  m_unpack_plans.resize(s_num_neighbors, nullptr);
+  m_unpack_plan_lengths.resize(s_num_neighbors, 0);
+
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    {
+      auto reset_list = scopedMoveData(m_pack_index_lists[l], m_pack_index_list_lengths[l], vid);
+      std::vector<HaloSegment> plan =
+          compressList(m_pack_index_lists[l], m_pack_index_list_lengths[l]);
+      m_pack_plan_lengths[l] = plan.size();
+      allocData(m_pack_plans[l], m_pack_plan_lengths[l], vid);
+      copyData(getDataSpace(vid), m_pack_plans[l],
+               DataSpace::Host, plan.data(), m_pack_plan_lengths[l]);
+    }
+    {
+      auto reset_list = scopedMoveData(m_unpack_index_lists[l], m_unpack_index_list_lengths[l], vid);
+      std::vector<HaloSegment> plan =
+          compressList(m_unpack_index_lists[l], m_unpack_index_list_lengths[l]);
+      m_unpack_plan_lengths[l] = plan.size();
+      allocData(m_unpack_plans[l], m_unpack_plan_lengths[l], vid);
+      copyData(getDataSpace(vid), m_unpack_plans[l],
+               DataSpace::Host, plan.data(), m_unpack_plan_lengths[l]);
+    }
+  }
+}
+
+//
+// Function to destroy packing and unpacking plans.
+//
+void HALO_base::destroy_plans(VariantID vid)
+{
+  for (size_t l = 0; l < m_pack_plans.size(); ++l) {
+    deallocData(m_pack_plans[l], vid);
+  }
+  for (size_t l = 0; l < m_unpack_plans.size(); ++l) {
+    deallocData(m_unpack_plans[l], vid);
+  }
+  m_unpack_plan_lengths.clear();
+  m_unpack_plans.clear();
+  m_pack_plan_lengths.clear();
+  m_pack_plans.clear();
+}
+
+//
+// Function to renumber the grid along a space-filling curve and remap
+// packing and unpacking index lists to the new numbering.
+//
+void HALO_base::renumber_lists(SFCOrdering ordering, VariantID vid)
+{
+  m_sfc_order.clear();
+
+  if (ordering == SFCOrdering::Lexicographic) {
+    return;
+  }
+
+  m_sfc_order.resize(m_grid_plus_halo_size);
+  std::iota(m_sfc_order.begin(), m_sfc_order.end(), 0);
+  sortBySFC(m_sfc_order.data(), m_grid_plus_halo_size,
+            m_grid_plus_halo_dims[0],
+            m_grid_plus_halo_dims[0] * m_grid_plus_halo_dims[1],
+            ordering);
+
+  std::vector<Int_type> new_idx(m_grid_plus_halo_size);
+  for (Index_type r = 0; r < m_grid_plus_halo_size; ++r) {
+    new_idx[m_sfc_order[r]] = r;
+  }
+
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    {
+      auto reset_list = scopedMoveData(m_pack_index_lists[l], m_pack_index_list_lengths[l], vid);
+      Int_ptr pack_list = m_pack_index_lists[l];
+      for (Index_type i = 0; i < m_pack_index_list_lengths[l]; ++i) {
+        pack_list[i] = new_idx[pack_list[i]];
+      }
+    }
+    {
+      auto reset_list = scopedMoveData(m_unpack_index_lists[l], m_unpack_index_list_lengths[l], vid);
+      Int_ptr unpack_list = m_unpack_index_lists[l];
+      for (Index_type i = 0; i < m_unpack_index_list_lengths[l]; ++i) {
+        unpack_list[i] = new_idx[unpack_list[i]];
+      }
+    }
+  }
+}
+
+//
+// Function to permute grid variable into the numbering set by renumber_lists.
+//
+void HALO_base::renumber_var(Real_ptr& var, VariantID vid)
+{
+  if (m_sfc_order.empty()) {
+    return;
+  }
+
+  auto reset_var = scopedMoveData(var, m_grid_plus_halo_size, vid);
+
+  std::vector<Real_type> natural_var(var, var + m_grid_plus_halo_size);
+  for (Index_type r = 0; r < m_grid_plus_halo_size; ++r) {
+    var[r] = natural_var[m_sfc_order[r]];
+  }
+}
+
+//
+// Function to compute checksum of grid variable in lexicographic numbering
+// so renumbered tunings checksum the same as the default.
+//
+long double HALO_base::calcVarChecksum(Real_ptr& var, VariantID vid)
+{
+  if (m_sfc_order.empty()) {
+    return calcChecksum(var, m_grid_plus_halo_size, vid);
+  }
+
+  auto reset_var = scopedMoveData(var, m_grid_plus_halo_size, vid);
+
+  std::vector<Real_type> natural_var(m_grid_plus_halo_size);
+  for (Index_type r = 0; r < m_grid_plus_halo_size; ++r) {
+    natural_var[m_sfc_order[r]] = var[r];
+  }
+
+  return calcChecksum(DataSpace::Host, natural_var.data(), m_grid_plus_halo_size, vid);
+}
+
+//
+// Function to scale packing and unpacking index lists so they index
+// num_vars variables interleaved in one array, var v at offset v.
+//
+void HALO_base::interleave_lists(const Index_type num_vars, VariantID vid)
+{
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    {
+      auto reset_list = scopedMoveData(m_pack_index_lists[l], m_pack_index_list_lengths[l], vid);
+      Int_ptr pack_list = m_pack_index_lists[l];
+      for (Index_type i = 0; i < m_pack_index_list_lengths[l]; ++i) {
+        pack_list[i] *= num_vars;
+      }
+    }
+    {
+      auto reset_list = scopedMoveData(m_unpack_index_lists[l], m_unpack_index_list_lengths[l], vid);
+      Int_ptr unpack_list = m_unpack_index_lists[l];
+      for (Index_type i = 0; i < m_unpack_index_list_lengths[l]; ++i) {
+        unpack_list[i] *= num_vars;
+      }
+    }
+  }
+}
+
+//
+// Function to compute checksum of num_vars interleaved grid variables
+// one variable at a time in lexicographic numbering so the interleaved
+// layout checksums the same as separate variables.
+//
+long double HALO_base::calcInterleavedVarsChecksum(Real_ptr& vars,
+                                                   const Index_type num_vars,
+                                                   VariantID vid)
+{
+  auto reset_vars = scopedMoveData(vars, num_vars * m_grid_plus_halo_size, vid);
+
+  long double vars_checksum = 0.0;
+
+  std::vector<Real_type> natural_var(m_grid_plus_halo_size);
+  for (Index_type v = 0; v < num_vars; ++v) {
+    for (Index_type r = 0; r < m_grid_plus_halo_size; ++r) {
+      const Index_type g = m_sfc_order.empty() ? r : m_sfc_order[r];
+      natural_var[g] = vars[r*num_vars + v];
+    }
+    vars_checksum += calcChecksum(DataSpace::Host, natural_var.data(), m_grid_plus_halo_size, vid);
+  }
+
+  return vars_checksum;
+}
+
 } // end namespace comm
 } // end namespace rajaperf
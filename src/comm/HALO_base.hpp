@@ -9,6 +9,10 @@
 ///
 /// HALO_base provides a common starting point for the other HALO_ classes.
 ///
+/// Besides the index lists it can make compressed pack and unpack plans,
+/// which describe each list as segments of strided runs, so packing reads
+/// a few segments instead of one index per packed value.
+///
 
 #ifndef RAJAPerf_Comm_HALO_BASE_HPP
 #define RAJAPerf_Comm_HALO_BASE_HPP
@@ -22,6 +26,12 @@
   std::vector<Int_ptr> unpack_index_lists = m_unpack_index_lists; \
   std::vector<Index_type> unpack_index_list_lengths = m_unpack_index_list_lengths;
 
+#define HALO_BASE_PLAN_DATA_SETUP \
+  std::vector<HaloSegment*> pack_plans = m_pack_plans; \
+  std::vector<Index_type> pack_plan_lengths = m_pack_plan_lengths; \
+  std::vector<HaloSegment*> unpack_plans = m_unpack_plans; \
+  std::vector<Index_type> unpack_plan_lengths = m_unpack_plan_lengths;
+
 #define HALO_PACK_BODY \
   buffer[i] = var[list[i]];
 
@@ -30,9 +40,12 @@
 
 
 #include "common/KernelBase.hpp"
+#include "common/SpaceFillingCurve.hpp"
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
+#include <string>
 #include <vector>
 
 namespace rajaperf
@@ -76,6 +89,96 @@ using hip_workgroup_dispatch_helpers = camp::list<
 namespace comm
 {
 
+//
+// Segment of a compressed pack or unpack plan holding num_runs runs of
+// run_len list entries. Entry k of run r indexes the variable at
+// start + r*run_stride + k*elem_stride and the buffer at
+// offset + r*run_len + k.
+//
+struct HaloSegment
+{
+  Int_type offset;
+  Int_type start;
+  Int_type run_len;
+  Int_type elem_stride;
+  Int_type num_runs;
+  Int_type run_stride;
+};
+
+//
+// Pack and unpack one run of a segment with block copies, runs of
+// non-adjacent values fall back to a loop.
+//
+struct halo_block_copy_helper
+{
+  static std::string get_name() { return "block_copy"; }
+
+  static void pack_run(Real_ptr buffer, const Real_type* var,
+                       const HaloSegment& seg, Int_type r)
+  {
+    Real_ptr dst = buffer + seg.offset + r*seg.run_len;
+    const Real_type* src = var + seg.start + r*seg.run_stride;
+    if (seg.elem_stride == 1) {
+      std::copy(src, src + seg.run_len, dst);
+    } else {
+      for (Int_type k = 0; k < seg.run_len; ++k) {
+        dst[k] = src[k*seg.elem_stride];
+      }
+    }
+  }
+
+  static void unpack_run(const Real_type* buffer, Real_ptr var,
+                         const HaloSegment& seg, Int_type r)
+  {
+    const Real_type* src = buffer + seg.offset + r*seg.run_len;
+    Real_ptr dst = var + seg.start + r*seg.run_stride;
+    if (seg.elem_stride == 1) {
+      std::copy(src, src + seg.run_len, dst);
+    } else {
+      for (Int_type k = 0; k < seg.run_len; ++k) {
+        dst[k*seg.elem_stride] = src[k];
+      }
+    }
+  }
+};
+
+//
+// Pack and unpack one run of a segment with SIMD loops, using strided
+// loads or stores for runs of non-adjacent values.
+//
+struct halo_simd_helper
+{
+  static std::string get_name() { return "simd"; }
+
+  static void pack_run(Real_ptr buffer, const Real_type* var,
+                       const HaloSegment& seg, Int_type r)
+  {
+    Real_ptr dst = buffer + seg.offset + r*seg.run_len;
+    const Real_type* src = var + seg.start + r*seg.run_stride;
+    const Int_type elem_stride = seg.elem_stride;
+    RAJAPERF_OMP_SIMD
+    for (Int_type k = 0; k < seg.run_len; ++k) {
+      dst[k] = src[k*elem_stride];
+    }
+  }
+
+  static void unpack_run(const Real_type* buffer, Real_ptr var,
+                         const HaloSegment& seg, Int_type r)
+  {
+    const Real_type* src = buffer + seg.offset + r*seg.run_len;
+    Real_ptr dst = var + seg.start + r*seg.run_stride;
+    const Int_type elem_stride = seg.elem_stride;
+    RAJAPERF_OMP_SIMD
+    for (Int_type k = 0; k < seg.run_len; ++k) {
+      dst[k*elem_stride] = src[k];
+    }
+  }
+};
+
+using halo_segment_helpers = camp::list<
+    halo_block_copy_helper,
+    halo_simd_helper >;
+
 class HALO_base : public KernelBase
 {
 public:
@@ -132,6 +235,11 @@ protected:
 
   Index_type m_grid_dims[3];
   Index_type m_halo_width;
+  Index_type m_halo_num_vars;
+  bool m_interleaved_vars;
+
+  // kernel metric of the average bytes of the message to each neighbor
+  size_t m_message_bytes_metric;
 
   Index_type m_grid_plus_halo_dims[3];
   Index_type m_grid_plus_halo_size;
@@ -146,6 +254,16 @@ protected:
   std::vector<Int_ptr> m_unpack_index_lists;
   std::vector<Index_type > m_unpack_index_list_lengths;
 
+  // compressed plans of the index lists, empty unless made by create_plans
+  std::vector<HaloSegment*> m_pack_plans;
+  std::vector<Index_type > m_pack_plan_lengths;
+  std::vector<HaloSegment*> m_unpack_plans;
+  std::vector<Index_type > m_unpack_plan_lengths;
+
+  // grid index of each entry in space-filling curve numbering,
+  // empty when the grid is numbered lexicographically
+  std::vector<Int_type> m_sfc_order;
+
   Extent make_boundary_extent(
     const message_type msg_type,
     const int (&boundary_offset)[3],
@@ -170,6 +288,18 @@ protected:
       std::vector<Int_ptr>& unpack_index_lists,
       const Index_type num_neighbors,
       VariantID vid);
+
+  void create_plans(VariantID vid);
+  void destroy_plans(VariantID vid);
+
+  void renumber_lists(SFCOrdering ordering, VariantID vid);
+  void renumber_var(Real_ptr& var, VariantID vid);
+  long double calcVarChecksum(Real_ptr& var, VariantID vid);
+
+  void interleave_lists(const Index_type num_vars, VariantID vid);
+  long double calcInterleavedVarsChecksum(Real_ptr& vars,
+                                          const Index_type num_vars,
+                                          VariantID vid);
 };
 
 } // end namespace comm
@@ -14,9 +14,12 @@
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <cstring>
 #include <stdexcept>
+#include <vector>
 #include <unistd.h>
 
 namespace rajaperf
@@ -594,6 +597,104 @@ long double calcChecksum(Complex_ptr ptr, Size_type len,
   return tchk;
 }
 
+namespace
+{
+
+// Number of entries summed serially in each block of a blocked checksum.
+// Fixed so block boundaries, and so the result, do not depend on threads.
+constexpr Size_type checksum_block_size = 1024;
+
+inline long double checksumValue(Int_type val) { return val; }
+inline long double checksumValue(Real_type val) { return val; }
+inline long double checksumValue(const Complex_type& val)
+{
+  return real(val)+imag(val);
+}
+
+/*
+ * Weighted sum of entries [jbegin, jend) with the serial checksum weights
+ * |sin(j+1)|+0.5. sin is evaluated once per block and advanced by the
+ * angle addition recurrence; blocks are short enough that plain long double
+ * summation stays within checksum tolerance of the serial result.
+ */
+template < typename T >
+long double calcChecksumBlock(const T* ptr, Size_type jbegin, Size_type jend)
+{
+  const long double sin_step = std::sin(1.0L);
+  const long double cos_step = std::cos(1.0L);
+  long double sin_j = std::sin(jbegin+1.0L);
+  long double cos_j = std::cos(jbegin+1.0L);
+
+  long double tchk = 0.0;
+  for (Size_type j = jbegin; j < jend; ++j) {
+    tchk += (std::abs(sin_j)+0.5L) * checksumValue(ptr[j]);
+    const long double sin_next = sin_j*cos_step + cos_j*sin_step;
+    cos_j = cos_j*cos_step - sin_j*sin_step;
+    sin_j = sin_next;
+  }
+  return tchk;
+}
+
+/*
+ * Sum blocks in parallel and combine the block sums pairwise in a fixed
+ * order.
+ */
+template < typename T >
+long double calcChecksumBlockedImpl(const T* ptr, Size_type len,
+                                    Real_type scale_factor)
+{
+  const Size_type num_blocks =
+      (len + checksum_block_size - 1) / checksum_block_size;
+
+  if (num_blocks == 0) {
+    return 0.0;
+  }
+
+  std::vector<long double> block_sums(num_blocks);
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  #pragma omp parallel for schedule(static) if(num_blocks > 1)
+#endif
+  for (Size_type b = 0; b < num_blocks; ++b) {
+    const Size_type jbegin = b * checksum_block_size;
+    const Size_type jend = std::min(jbegin + checksum_block_size, len);
+    block_sums[b] = calcChecksumBlock(ptr, jbegin, jend);
+  }
+
+  for (Size_type stride = 1; stride < num_blocks; stride *= 2) {
+    for (Size_type b = 0; b + stride < num_blocks; b += 2*stride) {
+      block_sums[b] += block_sums[b + stride];
+    }
+  }
+
+  long double tchk = block_sums[0];
+  tchk *= scale_factor;
+  return tchk;
+}
+
+}  // closing brace for anonymous namespace
+
+/*
+ * Calculate and return checksum for data arrays in parallel.
+ */
+long double calcChecksumBlocked(Int_ptr ptr, Size_type len,
+                                Real_type scale_factor)
+{
+  return calcChecksumBlockedImpl(ptr, len, scale_factor);
+}
+
+long double calcChecksumBlocked(Real_ptr ptr, Size_type len,
+                                Real_type scale_factor)
+{
+  return calcChecksumBlockedImpl(ptr, len, scale_factor);
+}
+
+long double calcChecksumBlocked(Complex_ptr ptr, Size_type len,
+                                Real_type scale_factor)
+{
+  return calcChecksumBlockedImpl(ptr, len, scale_factor);
+}
+
 }  // closing brace for detail namespace
 
 
@@ -146,6 +146,8 @@ void initData(Real_type& d);
  * where weight is a simple function of elemtn index.
  *
  * Checksumn is multiplied by given scale factor.
+ *
+ * This is the serial reference algorithm.
  */
 long double calcChecksum(Int_ptr d, Size_type len,
                          Real_type scale_factor);
@@ -156,6 +158,22 @@ long double calcChecksum(Real_ptr d, Size_type len,
 long double calcChecksum(Complex_ptr d, Size_type len,
                          Real_type scale_factor);
 
+/*!
+ * \brief Calculate and return checksum for data arrays in parallel.
+ *
+ * Computes the same weighted sum as calcChecksum, within rounding, over
+ * fixed size blocks and combines block sums pairwise so the result does
+ * not depend on the number of threads.
+ */
+long double calcChecksumBlocked(Int_ptr d, Size_type len,
+                                Real_type scale_factor);
+///
+long double calcChecksumBlocked(Real_ptr d, Size_type len,
+                                Real_type scale_factor);
+///
+long double calcChecksumBlocked(Complex_ptr d, Size_type len,
+                                Real_type scale_factor);
+
 }  // closing brace for detail namespace
 
 
@@ -228,6 +246,18 @@ inline void copyData(DataSpace dst_dataSpace, T* dst_ptr,
   detail::copyData(dst_dataSpace, dst_ptr, src_dataSpace, src_ptr, nbytes);
 }
 
+/*!
+ * \brief Copy data from one host accessible array to another, converting
+ *        each entry to the type of the destination array.
+ */
+template <typename D, typename S>
+inline void convertData(D* dst_ptr, const S* src_ptr, Size_type len)
+{
+  for (Size_type i = 0; i < len; ++i) {
+    dst_ptr[i] = static_cast<D>(src_ptr[i]);
+  }
+}
+
 /*!
  * \brief Move data array into new dataSpace.
  */
@@ -379,7 +409,7 @@ inline void allocAndInitDataRandValue(DataSpace dataSpace, T*& ptr, Size_type le
  */
 template <typename T>
 inline long double calcChecksum(DataSpace dataSpace, T* ptr, Size_type len, Size_type align,
-                                Real_type scale_factor)
+                                Real_type scale_factor, bool blocked_checksum = false)
 {
   T* check_ptr = ptr;
   T* copied_ptr = nullptr;
@@ -393,7 +423,8 @@ inline long double calcChecksum(DataSpace dataSpace, T* ptr, Size_type len, Size
     check_ptr = copied_ptr;
   }
 
-  auto val = detail::calcChecksum(check_ptr, len, scale_factor);
+  auto val = blocked_checksum ? detail::calcChecksumBlocked(check_ptr, len, scale_factor)
+                              : detail::calcChecksum(check_ptr, len, scale_factor);
 
   if (check_dataSpace != dataSpace) {
     deallocData(check_dataSpace, copied_ptr);
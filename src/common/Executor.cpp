@@ -41,6 +41,7 @@
 #include <fstream>
 #include <cmath>
 #include <algorithm>
+#include <utility>
 
 #include <unistd.h>
 
@@ -785,12 +786,30 @@ void Executor::outputRunData()
     file = openOutputFile(out_fprefix + "-timing-" + RunParams::CombinerOptToStr(combiner) + ".csv");
     writeCSVReport(*file, CSVRepMode::Timing, combiner, 6 /* prec */);
 
+    file = openOutputFile(out_fprefix + "-timeperiter-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+    writeCSVReport(*file, CSVRepMode::TimePerIteration, combiner, 3 /* prec */);
+
+    file = openOutputFile(out_fprefix + "-bandwidth-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+    writeCSVReport(*file, CSVRepMode::Bandwidth, combiner, 3 /* prec */);
+
     if ( haveReferenceVariant() ) {
       file = openOutputFile(out_fprefix + "-speedup-" + RunParams::CombinerOptToStr(combiner) + ".csv");
       writeCSVReport(*file, CSVRepMode::Speedup, combiner, 3 /* prec */);
     }
   }
 
+  {
+    bool have_metrics = false;
+    for (KernelBase* kern : kernels) {
+      have_metrics = have_metrics || (kern->getNumMetrics() > 0);
+    }
+    if ( have_metrics ) {
+      file = openOutputFile(out_fprefix + "-metrics.csv");
+      writeCSVReport(*file, CSVRepMode::Metric,
+                     RunParams::CombinerOpt::Average, 3 /* prec */);
+    }
+  }
+
   file = openOutputFile(out_fprefix + "-checksum.txt");
   writeChecksumReport(*file);
 
@@ -841,9 +860,28 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
     const string kernel_col_name("Kernel  ");
     const string sepchr(" , ");
 
+    //
+    // Rows of the report are the kernels, or the metrics of each kernel
+    // for the metric report.
+    //
+    vector<pair<KernelBase*, size_t>> rows;
+    vector<string> row_names;
+    for (KernelBase* kern : kernels) {
+      if ( mode == CSVRepMode::Metric ) {
+        for (size_t im = 0; im < kern->getNumMetrics(); ++im) {
+          rows.emplace_back(kern, im);
+          row_names.emplace_back(kern->getName() + " (" +
+                                 kern->getMetricName(im) + ")");
+        }
+      } else {
+        rows.emplace_back(kern, 0);
+        row_names.emplace_back(kern->getName());
+      }
+    }
+
     size_t kercol_width = kernel_col_name.size();
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    for (size_t ir = 0; ir < rows.size(); ++ir) {
+      kercol_width = max(kercol_width, row_names[ir].size());
     }
     kercol_width++;
 
@@ -898,9 +936,9 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
     //
     // Print row of data for variants of each kernel.
     //
-    for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      KernelBase* kern = kernels[ik];
-      file <<left<< setw(kercol_width) << kern->getName();
+    for (size_t ir = 0; ir < rows.size(); ++ir) {
+      KernelBase* kern = rows[ir].first;
+      file <<left<< setw(kercol_width) << row_names[ir];
       for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
         VariantID vid = variant_ids[iv];
         for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
@@ -910,9 +948,21 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
                (!kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) ||
                 !kern->hasVariantTuningDefined(vid, tuning_name)) ) {
             file << "Not run";
-          } else if ( (mode == CSVRepMode::Timing) &&
+          } else if ( (mode == CSVRepMode::Timing ||
+                       mode == CSVRepMode::TimePerIteration ||
+                       mode == CSVRepMode::Bandwidth ||
+                       mode == CSVRepMode::Metric) &&
                       !kern->hasVariantTuningDefined(vid, tuning_name) ) {
             file << "Not run";
+          } else if ( mode == CSVRepMode::Metric ) {
+            const double metric =
+                kern->getMetric(vid, kern->getVariantTuningIndex(vid, tuning_name),
+                                rows[ir].second);
+            if ( std::isnan(metric) ) {
+              file << "n/a";
+            } else {
+              file << setprecision(prec) << std::fixed << metric;
+            }
           } else {
             file << setprecision(prec) << std::fixed
                  << getReportDataEntry(mode, combiner, kern, vid,
@@ -1447,6 +1497,10 @@ void Executor::writeChecksumReport(ostream& file)
 string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner)
 {
   string title;
+  if ( mode == CSVRepMode::Metric ) {
+    // kernel metrics are those of the last pass, not combined over passes
+    return string("Kernel Metric Report ");
+  }
   switch ( combiner ) {
     case RunParams::CombinerOpt::Average : {
       title = string("Mean ");
@@ -1467,6 +1521,14 @@ string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner
       title += string("Runtime Report (sec.) ");
       break;
     }
+    case CSVRepMode::TimePerIteration : {
+      title += string("Runtime per Iteration Report (nsec.) ");
+      break;
+    }
+    case CSVRepMode::Bandwidth : {
+      title += string("Bandwidth Report (GB/s) ");
+      break;
+    }
     case CSVRepMode::Speedup : {
       if ( haveReferenceVariant() ) {
         title += string("Speedup Report (T_ref/T_var)") +
@@ -1506,6 +1568,25 @@ long double Executor::getReportDataEntry(CSVRepMode mode,
       }
       break;
     }
+    case CSVRepMode::TimePerIteration : {
+      const long double its = static_cast<long double>(kern->getRunReps()) *
+                              kern->getItsPerRep();
+      if ( its > 0.0 ) {
+        retval = 1.0e9 *
+                 getReportDataEntry(CSVRepMode::Timing, combiner, kern, vid, tune_idx) /
+                 its;
+      }
+      break;
+    }
+    case CSVRepMode::Bandwidth : {
+      const long double time =
+          getReportDataEntry(CSVRepMode::Timing, combiner, kern, vid, tune_idx);
+      if ( time > 0.0 ) {
+        retval = 1.0e-9 * static_cast<long double>(kern->getRunReps()) *
+                 kern->getBytesPerRep(vid, tune_idx) / time;
+      }
+      break;
+    }
     case CSVRepMode::Speedup : {
       if ( haveReferenceVariant() ) {
         if ( kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) &&
@@ -65,6 +65,9 @@ private:
   enum CSVRepMode {
     Timing = 0,
     Speedup,
+    TimePerIteration,
+    Bandwidth,
+    Metric,
 
     NumRepModes // Keep this one last and DO NOT remove (!!)
   };
@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Complex fast Fourier transforms of power of two length, used by the
+/// "fft_overlap_save" tunings of convolution kernels so the suite needs
+/// no FFT library.
+///
+/// The transforms are iterative radix-2 decimation in time transforms,
+/// in place on separate arrays of real and imaginary parts, taking the
+/// twiddle factors and bit reversal permutation from a plan made once for
+/// each length. The inverse transform is the forward transform with the
+/// real and imaginary parts swapped, scaled by 1/n.
+///
+
+#ifndef RAJAPerf_FFTUtils_HPP
+#define RAJAPerf_FFTUtils_HPP
+
+#include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+
+#include <cmath>
+#include <utility>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Smallest power of two greater than or equal to n.
+ */
+inline Index_type fftLength(Index_type n)
+{
+  Index_type len = 1;
+  while (len < n) {
+    len *= 2;
+  }
+  return len;
+}
+
+/*!
+ * \brief Number of Real_type values in a plan for transforms of length n.
+ */
+inline Index_type fftPlanSize(Index_type n)
+{
+  return n;
+}
+
+/*!
+ * \brief Make a plan for transforms of length n, a power of two.
+ *
+ * plan holds fftPlanSize(n) values, the real parts of the twiddle factors
+ * exp(-2 pi i k / n) for k in [0, n/2) followed by their imaginary parts.
+ * rev holds n values, the bit reversal permutation.
+ */
+inline void initFFTPlan(Index_type n, Real_ptr plan, Index_ptr rev)
+{
+  const Real_type two_pi = 2.0 * std::acos(-1.0);
+  for (Index_type k = 0; k < n/2; ++k) {
+    plan[k]       = std::cos(two_pi * k / n);
+    plan[n/2 + k] = -std::sin(two_pi * k / n);
+  }
+
+  Index_type log2_n = 0;
+  while ((Index_type(1) << log2_n) < n) {
+    ++log2_n;
+  }
+  for (Index_type k = 0; k < n; ++k) {
+    Index_type r = 0;
+    for (Index_type b = 0; b < log2_n; ++b) {
+      r |= ((k >> b) & 1) << (log2_n - 1 - b);
+    }
+    rev[k] = r;
+  }
+}
+
+/*!
+ * \brief Forward transform of length n of the values re[k] + i im[k].
+ */
+inline void fftForward(Index_type n, Real_ptr re, Real_ptr im,
+                       const Real_type* plan, const Index_type* rev)
+{
+  for (Index_type k = 0; k < n; ++k) {
+    const Index_type r = rev[k];
+    if (k < r) {
+      std::swap(re[k], re[r]);
+      std::swap(im[k], im[r]);
+    }
+  }
+
+  const Real_type* wr = plan;
+  const Real_type* wi = plan + n/2;
+
+  for (Index_type len = 2; len <= n; len *= 2) {
+    const Index_type half = len / 2;
+    const Index_type step = n / len;
+    for (Index_type start = 0; start < n; start += len) {
+      Real_ptr ure = re + start;
+      Real_ptr uim = im + start;
+      Real_ptr vre = re + start + half;
+      Real_ptr vim = im + start + half;
+      RAJAPERF_OMP_SIMD
+      for (Index_type k = 0; k < half; ++k) {
+        const Real_type w_re = wr[k*step];
+        const Real_type w_im = wi[k*step];
+        const Real_type t_re = vre[k]*w_re - vim[k]*w_im;
+        const Real_type t_im = vre[k]*w_im + vim[k]*w_re;
+        vre[k] = ure[k] - t_re;
+        vim[k] = uim[k] - t_im;
+        ure[k] += t_re;
+        uim[k] += t_im;
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Inverse transform of length n of the values re[k] + i im[k],
+ *        scaled by 1/n.
+ */
+inline void fftInverse(Index_type n, Real_ptr re, Real_ptr im,
+                       const Real_type* plan, const Index_type* rev)
+{
+  fftForward(n, im, re, plan, rev);
+
+  const Real_type scale = 1.0 / n;
+  RAJAPERF_OMP_SIMD
+  for (Index_type k = 0; k < n; ++k) {
+    re[k] *= scale;
+    im[k] *= scale;
+  }
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -185,6 +185,7 @@ void KernelBase::setVariantDefined(VariantID vid)
   }
 
   checksum[vid].resize(variant_tuning_names[vid].size(), 0.0);
+  metric[vid].resize(variant_tuning_names[vid].size());
   num_exec[vid].resize(variant_tuning_names[vid].size(), 0);
   min_time[vid].resize(variant_tuning_names[vid].size(), std::numeric_limits<double>::max());
   max_time[vid].resize(variant_tuning_names[vid].size(), -std::numeric_limits<double>::max());
@@ -428,6 +429,16 @@ void KernelBase::runKernel(VariantID vid, size_t tune_idx)
 #endif
 }
 
+void KernelBase::setMetric(VariantID vid, size_t tune_idx, size_t midx,
+                           double value)
+{
+  std::vector<double>& tuning_metrics = metric[vid].at(tune_idx);
+  if (tuning_metrics.size() <= midx) {
+    tuning_metrics.resize(midx + 1, nan(""));
+  }
+  tuning_metrics[midx] = value;
+}
+
 void KernelBase::print(std::ostream& os) const
 {
   os << "\nKernelBase::print..." << std::endl;
@@ -505,7 +516,7 @@ void KernelBase::doOnceCaliMetaBegin(VariantID vid, size_t tune_idx)
     cali_set_double(Reps_attr,(double)getRunReps());
     cali_set_double(Iters_Rep_attr,(double)getItsPerRep());
     cali_set_double(Kernels_Rep_attr,(double)getKernelsPerRep());
-    cali_set_double(Bytes_Rep_attr,(double)getBytesPerRep());
+    cali_set_double(Bytes_Rep_attr,(double)getBytesPerRep(vid, tune_idx));
     cali_set_double(Flops_Rep_attr,(double)getFLOPsPerRep());
     cali_set_double(BlockSize_attr, getBlockSize());
   }
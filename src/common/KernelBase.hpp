@@ -98,8 +98,23 @@ public:
   void setItsPerRep(Index_type its) { its_per_rep = its; };
   void setKernelsPerRep(Index_type nkerns) { kernels_per_rep = nkerns; };
   void setBytesPerRep(Index_type bytes) { bytes_per_rep = bytes;}
+  // override bytes per rep for a variant tuning that moves a different
+  // number of bytes, such as a tuning with smaller data types
+  void setVariantTuningBytesPerRep(VariantID vid, size_t tune_idx,
+                                   Index_type bytes)
+  {
+    if (tuning_bytes_per_rep[vid].size() <= tune_idx) {
+      tuning_bytes_per_rep[vid].resize(tune_idx + 1, -1);
+    }
+    tuning_bytes_per_rep[vid][tune_idx] = bytes;
+  }
   void setFLOPsPerRep(Index_type FLOPs) { FLOPs_per_rep = FLOPs; }
   void setBlockSize(Index_type size) { kernel_block_size = size; }
+  size_t addMetricName(std::string mname)
+  {
+    metric_names.emplace_back(std::move(mname));
+    return metric_names.size() - 1;
+  }
 
   void setUsesFeature(FeatureID fid) { uses_feature[fid] = true; }
 
@@ -146,8 +161,17 @@ public:
   Index_type getItsPerRep() const { return its_per_rep; };
   Index_type getKernelsPerRep() const { return kernels_per_rep; };
   Index_type getBytesPerRep() const { return bytes_per_rep; }
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const
+  {
+    return ( tune_idx < tuning_bytes_per_rep[vid].size() &&
+             tuning_bytes_per_rep[vid][tune_idx] >= 0 )
+           ? tuning_bytes_per_rep[vid][tune_idx] : bytes_per_rep;
+  }
   Index_type getFLOPsPerRep() const { return FLOPs_per_rep; }
   double getBlockSize() const { return kernel_block_size; }
+  size_t getNumMetrics() const { return metric_names.size(); }
+  const std::string& getMetricName(size_t midx) const
+  { return metric_names.at(midx); }
 
   Index_type getTargetProblemSize() const;
   Index_type getRunReps() const;
@@ -219,6 +243,13 @@ public:
   Checksum_type getChecksum(VariantID vid, size_t tune_idx) const
   { return checksum[vid].at(tune_idx); }
 
+  // get kernel specific metric of executed variant/tuning, nan if not set
+  double getMetric(VariantID vid, size_t tune_idx, size_t midx) const
+  {
+    std::vector<double> const& tuning_metrics = metric[vid].at(tune_idx);
+    return (midx < tuning_metrics.size()) ? tuning_metrics[midx] : nan("");
+  }
+
   void execute(VariantID vid, size_t tune_idx);
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -327,6 +358,21 @@ public:
         ptr, len, getDataAlignment());
   }
 
+  template <typename T>
+  void allocAndConvertData(T*& ptr, const Real_type* src_ptr, Size_type len,
+                           VariantID vid)
+  {
+    rajaperf::allocData(getDataSpace(vid),
+        ptr, len, getDataAlignment());
+    rajaperf::convertData(ptr, src_ptr, len);
+  }
+
+  template <typename D, typename S>
+  void convertData(D* dst_ptr, const S* src_ptr, Size_type len)
+  {
+    rajaperf::convertData(dst_ptr, src_ptr, len);
+  }
+
   template <typename T>
   rajaperf::AutoDataMover<T> scopedMoveData(T*& ptr, Size_type len, VariantID vid)
   {
@@ -353,21 +399,24 @@ public:
   long double calcChecksum(DataSpace dataSpace, T* ptr, Size_type len, VariantID RAJAPERF_UNUSED_ARG(vid))
   {
     return rajaperf::calcChecksum(dataSpace,
-      ptr, len, getDataAlignment(), 1.0);
+      ptr, len, getDataAlignment(), 1.0,
+      run_params.getBlockedChecksum());
   }
 
   template <typename T>
   long double calcChecksum(T* ptr, Size_type len, VariantID vid)
   {
     return rajaperf::calcChecksum(getDataSpace(vid),
-      ptr, len, getDataAlignment(), 1.0);
+      ptr, len, getDataAlignment(), 1.0,
+      run_params.getBlockedChecksum());
   }
 
   template <typename T>
   long double calcChecksum(T* ptr, Size_type len, Real_type scale_factor, VariantID vid)
   {
     return rajaperf::calcChecksum(getDataSpace(vid),
-      ptr, len, getDataAlignment(), scale_factor);
+      ptr, len, getDataAlignment(), scale_factor,
+      run_params.getBlockedChecksum());
   }
 
   void startTimer()
@@ -469,6 +518,10 @@ protected:
   std::vector<Checksum_type> checksum[NumVariants];
   Checksum_type checksum_scale_factor;
 
+  // set kernel specific metric midx, returned by addMetricName, of
+  // variant/tuning, e.g. in setUp or tearDown
+  void setMetric(VariantID vid, size_t tune_idx, size_t midx, double value);
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
   int did;
 #endif
@@ -499,14 +552,18 @@ private:
   Index_type its_per_rep;
   Index_type kernels_per_rep;
   Index_type bytes_per_rep;
+  std::vector<Index_type> tuning_bytes_per_rep[NumVariants];
   Index_type FLOPs_per_rep;
   double kernel_block_size = nan(""); // Set default value for non GPU kernels
+  std::vector<std::string> metric_names;
 
   VariantID running_variant;
   size_t running_tuning;
 
   std::vector<int> num_exec[NumVariants];
 
+  std::vector<std::vector<double>> metric[NumVariants];
+
   RAJA::Timer timer;
 
 #if defined(RAJA_PERFSUITE_USE_CALIPER)
@@ -0,0 +1,220 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Views and helpers for running kernels with their arrays stored in
+/// different data layouts.
+///
+/// Kernels with several arrays of the same length treat them as components
+/// of one array of elements, and access component k of element i through a
+/// view as view(k, i). The layouts are
+///
+///   SoA    structure of arrays, component k of all elements is contiguous
+///   AoS    array of structures, all components of element i are contiguous
+///   AoSoA  array of structures of arrays, elements are grouped in blocks
+///          of block_size elements stored in SoA layout
+///
+/// SoA and AoS are RAJA Views with permuted layouts. AoSoA is a RAJA View
+/// with a three dimensional layout indexed by (block, component, element
+/// in block). The AoSoA block sizes are set by the CMake variable
+/// RAJA_PERFSUITE_AOSOA_BLOCKSIZES.
+///
+/// Layout tunings copy kernel data into the layout before timing and back
+/// afterwards, so each layout computes the same checksum.
+///
+
+#ifndef RAJAPerf_LayoutUtils_HPP
+#define RAJAPerf_LayoutUtils_HPP
+
+#include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief View of num_comps components of len elements in SoA layout.
+ */
+template < typename T >
+struct SoAView
+{
+  using view_type = RAJA::View<T, RAJA::Layout<2, Index_type, 1>>;
+
+  static Index_type storageSize(Index_type num_comps, Index_type len)
+  {
+    return num_comps * len;
+  }
+
+  SoAView(T* data, Index_type num_comps, Index_type len)
+    : view(data, RAJA::make_permuted_layout( {{num_comps, len}},
+                     RAJA::as_array<RAJA::Perm<0, 1> >::get() ) )
+  { }
+
+  T& operator()(Index_type k, Index_type i) const { return view(k, i); }
+
+  view_type view;
+};
+
+/*!
+ * \brief View of num_comps components of len elements in AoS layout.
+ */
+template < typename T >
+struct AoSView
+{
+  using view_type = RAJA::View<T, RAJA::Layout<2, Index_type, 0>>;
+
+  static Index_type storageSize(Index_type num_comps, Index_type len)
+  {
+    return num_comps * len;
+  }
+
+  AoSView(T* data, Index_type num_comps, Index_type len)
+    : view(data, RAJA::make_permuted_layout( {{num_comps, len}},
+                     RAJA::as_array<RAJA::Perm<1, 0> >::get() ) )
+  { }
+
+  T& operator()(Index_type k, Index_type i) const { return view(k, i); }
+
+  view_type view;
+};
+
+/*!
+ * \brief View of num_comps components of len elements in AoSoA layout
+ *        with blocks of block_size elements.
+ *
+ * The last block is padded to block_size elements.
+ */
+template < typename T, Index_type block_size >
+struct AoSoAView
+{
+  using view_type = RAJA::View<T, RAJA::Layout<3, Index_type, 2>>;
+
+  static Index_type numBlocks(Index_type len)
+  {
+    return (len + block_size - 1) / block_size;
+  }
+
+  static Index_type storageSize(Index_type num_comps, Index_type len)
+  {
+    return numBlocks(len) * num_comps * block_size;
+  }
+
+  AoSoAView(T* data, Index_type num_comps, Index_type len)
+    : view(data, RAJA::make_permuted_layout(
+                     {{numBlocks(len), num_comps, block_size}},
+                     RAJA::as_array<RAJA::Perm<0, 1, 2> >::get() ) )
+  { }
+
+  T& operator()(Index_type k, Index_type i) const
+  {
+    return view(i / block_size, k, i % block_size);
+  }
+
+  view_type view;
+};
+
+
+/*!
+ * \brief Helpers naming the view type and tuning of each layout tuning,
+ *        used with seq_for to generate layout tunings.
+ */
+struct soa_layout_helper
+{
+  template < typename T >
+  using view_type = SoAView<T>;
+  static std::string get_name() { return "SoA"; }
+};
+
+struct aos_layout_helper
+{
+  template < typename T >
+  using view_type = AoSView<T>;
+  static std::string get_name() { return "AoS"; }
+};
+
+template < size_t block_size >
+struct aosoa_layout_helper
+{
+  template < typename T >
+  using view_type = AoSoAView<T, static_cast<Index_type>(block_size)>;
+  static std::string get_name() { return "AoSoA_"+std::to_string(block_size); }
+};
+
+namespace detail
+{
+
+template < typename aosoa_block_sizes >
+struct make_layout_helpers;
+
+template < size_t... block_sizes >
+struct make_layout_helpers<camp::list<camp::integral_constant<size_t, block_sizes>...>>
+{
+  using type = camp::list< soa_layout_helper,
+                           aos_layout_helper,
+                           aosoa_layout_helper<block_sizes>... >;
+};
+
+}  // closing brace for detail namespace
+
+using layout_helpers = typename detail::make_layout_helpers<
+    rajaperf::configuration::aosoa_block_sizes>::type;
+
+
+/*!
+ * \brief Copy the arrays in comps, each holding component k of len
+ *        elements, into view.
+ */
+template < typename view_type, typename T >
+void copyToLayout(view_type const& view, std::vector<T*> const& comps,
+                  Index_type len)
+{
+  for (size_t k = 0; k < comps.size(); ++k) {
+    for (Index_type i = 0; i < len; ++i) {
+      view(k, i) = comps[k][i];
+    }
+  }
+}
+
+/*!
+ * \brief Copy the components of len elements in view back into the arrays
+ *        in comps.
+ */
+template < typename view_type, typename T >
+void copyFromLayout(std::vector<T*> const& comps, view_type const& view,
+                    Index_type len)
+{
+  for (size_t k = 0; k < comps.size(); ++k) {
+    for (Index_type i = 0; i < len; ++i) {
+      comps[k][i] = view(k, i);
+    }
+  }
+}
+
+/*!
+ * \brief Return pointers to the num_comps components of len elements
+ *        stored consecutively in data, as in the strided arrays of Lcals
+ *        kernels.
+ */
+template < typename T >
+std::vector<T*> getComponents(T* data, Index_type num_comps, Index_type len)
+{
+  std::vector<T*> comps(num_comps);
+  for (Index_type k = 0; k < num_comps; ++k) {
+    comps[k] = data + k * len;
+  }
+  return comps;
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,175 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Non-temporal (streaming) stores, used by the "nontemporal_simd" and
+/// "nontemporal_intrinsics" tunings of kernels that write arrays they do
+/// not read again.
+///
+/// A store to a cache line that is not in cache first reads the line
+/// (read for ownership), so a kernel writing n bytes of an array larger
+/// than the last level cache moves 2n bytes. Non-temporal stores write
+/// whole lines to memory without reading them or keeping them in cache.
+///
+///   nontemporal_simd        '#pragma omp simd nontemporal(...)' through
+///                           RAJAPERF_OMP_SIMD_NONTEMPORAL, or with
+///                           'parallel for' through
+///                           RAJAPERF_OMP_PARALLEL_FOR_SIMD_NONTEMPORAL.
+///                           The clause is new in OpenMP 5.0, older
+///                           compilers get the pragma without it, and
+///                           builds without OpenMP get nothing. It is a
+///                           hint, which compilers may ignore.
+///
+///   nontemporal_intrinsics  x86 streaming store intrinsics (AVX or SSE2)
+///                           through nontemporalStore, followed by a store
+///                           fence. The tuning is only built when
+///                           RAJAPERF_USE_NONTEMPORAL_INTRINSICS is defined.
+///
+/// The kernels count the same bytes per rep for every tuning, so the
+/// timings of these tunings beside the default give the bandwidth gained
+/// by avoiding the reads for ownership.
+///
+
+#ifndef RAJAPerf_NontemporalStoreUtils_HPP
+#define RAJAPerf_NontemporalStoreUtils_HPP
+
+#include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+
+#include <cstdint>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#define RAJAPERF_USE_NONTEMPORAL_INTRINSICS
+#endif
+
+#if defined(_OPENMP) && (_OPENMP >= 201811)
+#define RAJAPERF_OMP_SIMD_NONTEMPORAL(...) \
+  RAJAPERF_PRAGMA(omp simd nontemporal(__VA_ARGS__))
+#define RAJAPERF_OMP_PARALLEL_FOR_SIMD_NONTEMPORAL(...) \
+  RAJAPERF_PRAGMA(omp parallel for simd nontemporal(__VA_ARGS__))
+#elif defined(_OPENMP)
+#define RAJAPERF_OMP_SIMD_NONTEMPORAL(...) \
+  RAJAPERF_PRAGMA(omp simd)
+#define RAJAPERF_OMP_PARALLEL_FOR_SIMD_NONTEMPORAL(...) \
+  RAJAPERF_PRAGMA(omp parallel for simd)
+#else
+#define RAJAPERF_OMP_SIMD_NONTEMPORAL(...)
+#define RAJAPERF_OMP_PARALLEL_FOR_SIMD_NONTEMPORAL(...)
+#endif
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+//
+// Vector of width values of type T written with one streaming store,
+// from an array aligned to the vector.
+//
+template < typename T >
+struct nontemporal_vector
+{
+  static constexpr Index_type width = 1;
+  static void store(T* dst, const T* vals) { dst[0] = vals[0]; }
+  static void fence() { }
+};
+
+#if defined(__AVX__)
+
+template < >
+struct nontemporal_vector<double>
+{
+  static constexpr Index_type width = 4;
+  static void store(double* dst, const double* vals)
+  {
+    _mm256_stream_pd(dst, _mm256_load_pd(vals));
+  }
+  static void fence() { _mm_sfence(); }
+};
+
+template < >
+struct nontemporal_vector<float>
+{
+  static constexpr Index_type width = 8;
+  static void store(float* dst, const float* vals)
+  {
+    _mm256_stream_ps(dst, _mm256_load_ps(vals));
+  }
+  static void fence() { _mm_sfence(); }
+};
+
+#elif defined(__SSE2__)
+
+template < >
+struct nontemporal_vector<double>
+{
+  static constexpr Index_type width = 2;
+  static void store(double* dst, const double* vals)
+  {
+    _mm_stream_pd(dst, _mm_load_pd(vals));
+  }
+  static void fence() { _mm_sfence(); }
+};
+
+template < >
+struct nontemporal_vector<float>
+{
+  static constexpr Index_type width = 4;
+  static void store(float* dst, const float* vals)
+  {
+    _mm_stream_ps(dst, _mm_load_ps(vals));
+  }
+  static void fence() { _mm_sfence(); }
+};
+
+#endif
+
+}  // closing brace for detail namespace
+
+/*!
+ * \brief Set dst[i] = value(i) for i in [ibegin, iend) with streaming
+ *        stores where the target has them.
+ *
+ * Elements before the first aligned vector and after the last whole
+ * vector use ordinary stores. Ends with a store fence, so the stores are
+ * visible to other threads after a following barrier.
+ */
+template < typename T, typename VALUE >
+inline void nontemporalStore(T* dst, Index_type ibegin, Index_type iend,
+                             VALUE&& value)
+{
+  using vector = detail::nontemporal_vector<T>;
+  constexpr Index_type width = vector::width;
+  constexpr std::uintptr_t align = width * sizeof(T);
+
+  Index_type i = ibegin;
+  for ( ; i < iend &&
+          reinterpret_cast<std::uintptr_t>(dst + i) % align != 0; ++i) {
+    dst[i] = value(i);
+  }
+
+  for ( ; i + width <= iend; i += width) {
+    alignas(align) T vals[width];
+    for (Index_type k = 0; k < width; ++k) {
+      vals[k] = value(i + k);
+    }
+    vector::store(dst + i, vals);
+  }
+
+  for ( ; i < iend; ++i) {
+    dst[i] = value(i);
+  }
+
+  vector::fence();
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
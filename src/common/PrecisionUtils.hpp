@@ -0,0 +1,290 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Types and helpers for running kernels in a floating point precision
+/// other than Real_type.
+///
+/// Each precision helper names a storage type, used for kernel arrays, and
+/// a compute type, used for scalars and arithmetic. The reduced precision
+/// storage types are emulated: values are stored in 16 bits and converted
+/// to float for arithmetic.
+///
+
+#ifndef RAJAPerf_PrecisionUtils_HPP
+#define RAJAPerf_PrecisionUtils_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/KernelBase.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Storage type with bfloat16 format, 8 bit exponent and 7 bit
+ *        mantissa, converted to float for arithmetic.
+ */
+struct BFloat16_type
+{
+  uint16_t bits;
+
+  BFloat16_type() = default;
+
+  BFloat16_type(float val)
+  {
+    uint32_t u;
+    std::memcpy(&u, &val, sizeof(u));
+    if ((u & 0x7fffffffu) > 0x7f800000u) {
+      bits = static_cast<uint16_t>((u >> 16) | 0x0040u); // quiet nan
+    } else {
+      u += 0x7fffu + ((u >> 16) & 1u); // round to nearest even
+      bits = static_cast<uint16_t>(u >> 16);
+    }
+  }
+
+  operator float() const
+  {
+    const uint32_t u = static_cast<uint32_t>(bits) << 16;
+    float val;
+    std::memcpy(&val, &u, sizeof(val));
+    return val;
+  }
+
+  BFloat16_type& operator+=(float val) { return *this = float(*this) + val; }
+  BFloat16_type& operator-=(float val) { return *this = float(*this) - val; }
+  BFloat16_type& operator*=(float val) { return *this = float(*this) * val; }
+  BFloat16_type& operator/=(float val) { return *this = float(*this) / val; }
+};
+
+/*!
+ * \brief Storage type with IEEE binary16 format, 5 bit exponent and
+ *        10 bit mantissa, converted to float for arithmetic.
+ *
+ * Values beyond the binary16 range (65504) are stored as infinity.
+ */
+struct Half_type
+{
+  uint16_t bits;
+
+  Half_type() = default;
+
+  Half_type(float val)
+  {
+    uint32_t u;
+    std::memcpy(&u, &val, sizeof(u));
+    const uint32_t sign = (u >> 16) & 0x8000u;
+    const uint32_t abs_u = u & 0x7fffffffu;
+
+    if (abs_u >= 0x7f800000u) {
+      // inf or nan
+      bits = static_cast<uint16_t>(sign | 0x7c00u |
+                                   ((abs_u > 0x7f800000u) ? 0x0200u : 0u));
+    } else if (abs_u >= 0x477ff000u) {
+      // rounds beyond largest finite value
+      bits = static_cast<uint16_t>(sign | 0x7c00u);
+    } else if (abs_u >= 0x38800000u) {
+      // normal, rebias exponent and round mantissa to nearest even
+      uint32_t h = abs_u - 0x38000000u;
+      h += 0x0fffu + ((h >> 13) & 1u);
+      bits = static_cast<uint16_t>(sign | (h >> 13));
+    } else if (abs_u >= 0x33000000u) {
+      // subnormal, shift in the implicit bit and round to nearest even
+      const uint32_t mant = (abs_u & 0x007fffffu) | 0x00800000u;
+      const uint32_t shift = 126u - (abs_u >> 23);
+      uint32_t h = mant >> shift;
+      const uint32_t rem = mant & ((1u << shift) - 1u);
+      const uint32_t half = 1u << (shift - 1u);
+      if (rem > half || (rem == half && (h & 1u))) {
+        h += 1u;
+      }
+      bits = static_cast<uint16_t>(sign | h);
+    } else {
+      bits = static_cast<uint16_t>(sign);
+    }
+  }
+
+  operator float() const
+  {
+    const uint32_t sign = static_cast<uint32_t>(bits & 0x8000u) << 16;
+    const uint32_t expo = (bits >> 10) & 0x1fu;
+    const uint32_t mant = bits & 0x03ffu;
+
+    float val;
+    if (expo == 0x1fu) {
+      const uint32_t u = sign | 0x7f800000u | (mant << 13);
+      std::memcpy(&val, &u, sizeof(val));
+    } else if (expo != 0u) {
+      const uint32_t u = sign | ((expo + 112u) << 23) | (mant << 13);
+      std::memcpy(&val, &u, sizeof(val));
+    } else {
+      val = static_cast<float>(mant) * 5.9604644775390625e-8f; // 2^-24
+      if (sign) {
+        val = -val;
+      }
+    }
+    return val;
+  }
+
+  Half_type& operator+=(float val) { return *this = float(*this) + val; }
+  Half_type& operator-=(float val) { return *this = float(*this) - val; }
+  Half_type& operator*=(float val) { return *this = float(*this) * val; }
+  Half_type& operator/=(float val) { return *this = float(*this) / val; }
+};
+
+
+/*!
+ * \brief Helpers naming the storage and compute types of each precision
+ *        tuning, used with seq_for to generate precision tunings.
+ */
+struct fp64_precision_helper
+{
+  using storage_type = double;
+  using compute_type = double;
+  static std::string get_name() { return "fp64"; }
+};
+
+struct fp32_precision_helper
+{
+  using storage_type = float;
+  using compute_type = float;
+  static std::string get_name() { return "fp32"; }
+};
+
+struct bf16_precision_helper
+{
+  using storage_type = BFloat16_type;
+  using compute_type = float;
+  static std::string get_name() { return "bf16"; }
+};
+
+struct fp16_precision_helper
+{
+  using storage_type = Half_type;
+  using compute_type = float;
+  static std::string get_name() { return "fp16"; }
+};
+
+using precision_helpers = camp::list<
+    fp64_precision_helper,
+    fp32_precision_helper,
+    bf16_precision_helper,
+    fp16_precision_helper >;
+
+/*!
+ * \brief Return true if the precision is that of Real_type, which is run
+ *        by the default tuning and so has no precision tuning.
+ */
+template < typename precision_helper >
+constexpr bool isDefaultPrecision(precision_helper)
+{
+  return std::is_same<typename precision_helper::storage_type, Real_type>::value;
+}
+
+/*!
+ * \brief Return bytes per rep of a precision tuning given the bytes per rep
+ *        of the default tuning, which moves Real_type data.
+ */
+template < typename precision_helper >
+constexpr Index_type getPrecisionBytesPerRep(Index_type real_bytes_per_rep)
+{
+  return real_bytes_per_rep *
+         static_cast<Index_type>(sizeof(typename precision_helper::storage_type)) /
+         static_cast<Index_type>(sizeof(Real_type));
+}
+
+/*!
+ * \brief Run the precision tuning with index tune_idx, if any, by calling
+ *        run_precision(precision_helper), and advance the tuning index t
+ *        past the precision tunings.
+ */
+template < typename RunPrecision >
+void runPrecisionTunings(size_t tune_idx, size_t& t,
+                         RunPrecision&& run_precision)
+{
+  seq_for(precision_helpers{}, [&](auto precision_helper) {
+    if (!isDefaultPrecision(precision_helper)) {
+      if (tune_idx == t) {
+        run_precision(precision_helper);
+      }
+      t += 1;
+    }
+  });
+}
+
+/*!
+ * \brief Add a tuning per precision other than Real_type to the kernel,
+ *        in the order run by runPrecisionTunings, with bytes per rep scaled
+ *        to the storage type of the tuning.
+ */
+inline void addPrecisionTuningDefinitions(KernelBase& kernel, VariantID vid)
+{
+  seq_for(precision_helpers{}, [&](auto precision_helper) {
+    if (!isDefaultPrecision(precision_helper)) {
+      kernel.addVariantTuningName(vid, decltype(precision_helper)::get_name());
+      kernel.setVariantTuningBytesPerRep(vid,
+          kernel.getNumVariantTunings(vid) - 1,
+          getPrecisionBytesPerRep<decltype(precision_helper)>(
+              kernel.getBytesPerRep()));
+    }
+  });
+}
+
+/*!
+ * \brief Return true if the tuning name is that of a precision tuning.
+ */
+inline bool isPrecisionTuningName(const std::string& tuning_name)
+{
+  bool is_precision_tuning = false;
+  seq_for(precision_helpers{}, [&](auto precision_helper) {
+    if (tuning_name == decltype(precision_helper)::get_name()) {
+      is_precision_tuning = true;
+    }
+  });
+  return is_precision_tuning;
+}
+
+}  // closing brace for rajaperf namespace
+
+//
+// Define run<variant>Variant to run run<variant>VariantDefault for the
+// "default" tuning and run<variant>VariantPrecision for a tuning per
+// precision other than Real_type, only for base_vid, and define
+// set<variant>TuningDefinitions to name those tunings and scale their bytes
+// per rep to the storage type.
+//
+#define RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(kernel, variant, base_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    if (tune_idx == t) {                                                       \
+      run##variant##VariantDefault(vid);                                       \
+    }                                                                          \
+    t += 1;                                                                    \
+    if (vid == base_vid) {                                                     \
+      runPrecisionTunings(tune_idx, t, [&](auto precision_helper) {            \
+        run##variant##VariantPrecision<decltype(precision_helper)>(vid);       \
+      });                                                                      \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    addVariantTuningName(vid, "default");                                      \
+    if (vid == base_vid) {                                                     \
+      addPrecisionTuningDefinitions(*this, vid);                               \
+    }                                                                          \
+  }
+
+#endif  // closing endif for header file include guard
@@ -44,12 +44,15 @@
 #include "lcals/FIRST_DIFF.hpp"
 #include "lcals/FIRST_MIN.hpp"
 #include "lcals/FIRST_SUM.hpp"
+#include "lcals/FIRST_SUM_ORIG.hpp"
 #include "lcals/GEN_LIN_RECUR.hpp"
+#include "lcals/GEN_LIN_RECUR_ORIG.hpp"
 #include "lcals/HYDRO_1D.hpp"
 #include "lcals/HYDRO_2D.hpp"
 #include "lcals/INT_PREDICT.hpp"
 #include "lcals/PLANCKIAN.hpp"
 #include "lcals/TRIDIAG_ELIM.hpp"
+#include "lcals/TRIDIAG_ELIM_ORIG.hpp"
 
 //
 // Polybench kernels...
@@ -60,6 +63,7 @@
 #include "polybench/POLYBENCH_ATAX.hpp"
 #include "polybench/POLYBENCH_FDTD_2D.hpp"
 #include "polybench/POLYBENCH_FLOYD_WARSHALL.hpp"
+#include "polybench/POLYBENCH_FLOYD_WARSHALL_ORIG.hpp"
 #include "polybench/POLYBENCH_GEMM.hpp"
 #include "polybench/POLYBENCH_GEMVER.hpp"
 #include "polybench/POLYBENCH_GESUMMV.hpp"
@@ -89,6 +93,9 @@
 #include "apps/LTIMES.hpp"
 #include "apps/LTIMES_NOVIEW.hpp"
 #include "apps/MASS3DEA.hpp"
+#include "apps/MASS3DOP_PA.hpp"
+#include "apps/MASS3DOP_EA.hpp"
+#include "apps/MASS3DOP_CSR.hpp"
 #include "apps/MASS3DPA.hpp"
 #include "apps/NODAL_ACCUMULATION_3D.hpp"
 #include "apps/PRESSURE.hpp"
@@ -104,18 +111,36 @@
 #include "algorithm/REDUCE_SUM.hpp"
 #include "algorithm/MEMSET.hpp"
 #include "algorithm/MEMCPY.hpp"
+#include "algorithm/HISTOGRAM.hpp"
+#include "algorithm/POINTER_CHASE.hpp"
 
 //
 // Comm kernels...
 //
 #include "comm/HALO_PACKING.hpp"
 #include "comm/HALO_PACKING_FUSED.hpp"
+#include "comm/HALO_EXCHANGE_SHMEM.hpp"
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
 #include "comm/HALO_SENDRECV.hpp"
 #include "comm/HALO_EXCHANGE.hpp"
 #include "comm/HALO_EXCHANGE_FUSED.hpp"
+#include "comm/HALO_EXCHANGE_OVERLAP.hpp"
 #endif
 
+//
+// Indirect kernels...
+//
+#include "indirect/GATHER.hpp"
+#include "indirect/SCATTER.hpp"
+#include "indirect/GATHER_SCATTER.hpp"
+
+//
+// Sparse kernels...
+//
+#include "sparse/SPMV_CSR.hpp"
+#include "sparse/SPMV_ELL.hpp"
+#include "sparse/SPMV_SELL.hpp"
+
 
 #include <iostream>
 
@@ -143,6 +168,8 @@ static const std::string GroupNames [] =
   std::string("Apps"),
   std::string("Algorithm"),
   std::string("Comm"),
+  std::string("Indirect"),
+  std::string("Sparse"),
 
   std::string("Unknown Group")  // Keep this at the end and DO NOT remove....
 
@@ -194,12 +221,15 @@ static const std::string KernelNames [] =
   std::string("Lcals_FIRST_DIFF"),
   std::string("Lcals_FIRST_MIN"),
   std::string("Lcals_FIRST_SUM"),
+  std::string("Lcals_FIRST_SUM_ORIG"),
   std::string("Lcals_GEN_LIN_RECUR"),
+  std::string("Lcals_GEN_LIN_RECUR_ORIG"),
   std::string("Lcals_HYDRO_1D"),
   std::string("Lcals_HYDRO_2D"),
   std::string("Lcals_INT_PREDICT"),
   std::string("Lcals_PLANCKIAN"),
   std::string("Lcals_TRIDIAG_ELIM"),
+  std::string("Lcals_TRIDIAG_ELIM_ORIG"),
 
 //
 // Polybench kernels...
@@ -210,6 +240,7 @@ static const std::string KernelNames [] =
   std::string("Polybench_ATAX"),
   std::string("Polybench_FDTD_2D"),
   std::string("Polybench_FLOYD_WARSHALL"),
+  std::string("Polybench_FLOYD_WARSHALL_ORIG"),
   std::string("Polybench_GEMM"),
   std::string("Polybench_GEMVER"),
   std::string("Polybench_GESUMMV"),
@@ -239,6 +270,9 @@ static const std::string KernelNames [] =
   std::string("Apps_LTIMES"),
   std::string("Apps_LTIMES_NOVIEW"),
   std::string("Apps_MASS3DEA"),
+  std::string("Apps_MASS3DOP_PA"),
+  std::string("Apps_MASS3DOP_EA"),
+  std::string("Apps_MASS3DOP_CSR"),
   std::string("Apps_MASS3DPA"),
   std::string("Apps_NODAL_ACCUMULATION_3D"),
   std::string("Apps_PRESSURE"),
@@ -254,18 +288,36 @@ static const std::string KernelNames [] =
   std::string("Algorithm_REDUCE_SUM"),
   std::string("Algorithm_MEMSET"),
   std::string("Algorithm_MEMCPY"),
+  std::string("Algorithm_HISTOGRAM"),
+  std::string("Algorithm_POINTER_CHASE"),
 
 //
 // Comm kernels...
 //
   std::string("Comm_HALO_PACKING"),
   std::string("Comm_HALO_PACKING_FUSED"),
+  std::string("Comm_HALO_EXCHANGE_SHMEM"),
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
   std::string("Comm_HALO_SENDRECV"),
   std::string("Comm_HALO_EXCHANGE"),
   std::string("Comm_HALO_EXCHANGE_FUSED"),
+  std::string("Comm_HALO_EXCHANGE_OVERLAP"),
 #endif
 
+//
+// Indirect kernels...
+//
+  std::string("Indirect_GATHER"),
+  std::string("Indirect_SCATTER"),
+  std::string("Indirect_GATHER_SCATTER"),
+
+//
+// Sparse kernels...
+//
+  std::string("Sparse_SPMV_CSR"),
+  std::string("Sparse_SPMV_ELL"),
+  std::string("Sparse_SPMV_SELL"),
+
   std::string("Unknown Kernel")  // Keep this at the end and DO NOT remove....
 
 }; // END KernelNames
@@ -793,10 +845,18 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new lcals::FIRST_SUM(run_params);
        break;
     }
+    case Lcals_FIRST_SUM_ORIG : {
+       kernel = new lcals::FIRST_SUM_ORIG(run_params);
+       break;
+    }
     case Lcals_GEN_LIN_RECUR : {
        kernel = new lcals::GEN_LIN_RECUR(run_params);
        break;
     }
+    case Lcals_GEN_LIN_RECUR_ORIG : {
+       kernel = new lcals::GEN_LIN_RECUR_ORIG(run_params);
+       break;
+    }
     case Lcals_HYDRO_1D : {
        kernel = new lcals::HYDRO_1D(run_params);
        break;
@@ -817,6 +877,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new lcals::TRIDIAG_ELIM(run_params);
        break;
     }
+    case Lcals_TRIDIAG_ELIM_ORIG : {
+       kernel = new lcals::TRIDIAG_ELIM_ORIG(run_params);
+       break;
+    }
 
 //
 // Polybench kernels...
@@ -845,6 +909,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new polybench::POLYBENCH_FLOYD_WARSHALL(run_params);
        break;
     }
+    case Polybench_FLOYD_WARSHALL_ORIG : {
+       kernel = new polybench::POLYBENCH_FLOYD_WARSHALL_ORIG(run_params);
+       break;
+    }
     case Polybench_GEMM : {
        kernel = new polybench::POLYBENCH_GEMM(run_params);
        break;
@@ -938,6 +1006,18 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::MASS3DEA(run_params);
        break;
     }      
+    case Apps_MASS3DOP_PA : {
+       kernel = new apps::MASS3DOP_PA(run_params);
+       break;
+    }
+    case Apps_MASS3DOP_EA : {
+       kernel = new apps::MASS3DOP_EA(run_params);
+       break;
+    }
+    case Apps_MASS3DOP_CSR : {
+       kernel = new apps::MASS3DOP_CSR(run_params);
+       break;
+    }
     case Apps_MASS3DPA : {
        kernel = new apps::MASS3DPA(run_params);
        break;
@@ -986,6 +1066,14 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new algorithm::MEMCPY(run_params);
        break;
     }
+    case Algorithm_HISTOGRAM: {
+       kernel = new algorithm::HISTOGRAM(run_params);
+       break;
+    }
+    case Algorithm_POINTER_CHASE: {
+       kernel = new algorithm::POINTER_CHASE(run_params);
+       break;
+    }
 
 //
 // Comm kernels...
@@ -998,6 +1086,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new comm::HALO_PACKING_FUSED(run_params);
        break;
     }
+    case Comm_HALO_EXCHANGE_SHMEM : {
+       kernel = new comm::HALO_EXCHANGE_SHMEM(run_params);
+       break;
+    }
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
     case Comm_HALO_SENDRECV : {
        kernel = new comm::HALO_SENDRECV(run_params);
@@ -1011,8 +1103,44 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new comm::HALO_EXCHANGE_FUSED(run_params);
        break;
     }
+    case Comm_HALO_EXCHANGE_OVERLAP : {
+       kernel = new comm::HALO_EXCHANGE_OVERLAP(run_params);
+       break;
+    }
 #endif
 
+//
+// Indirect kernels...
+//
+    case Indirect_GATHER : {
+       kernel = new indirect::GATHER(run_params);
+       break;
+    }
+    case Indirect_SCATTER : {
+       kernel = new indirect::SCATTER(run_params);
+       break;
+    }
+    case Indirect_GATHER_SCATTER : {
+       kernel = new indirect::GATHER_SCATTER(run_params);
+       break;
+    }
+
+//
+// Sparse kernels...
+//
+    case Sparse_SPMV_CSR : {
+       kernel = new sparse::SPMV_CSR(run_params);
+       break;
+    }
+    case Sparse_SPMV_ELL : {
+       kernel = new sparse::SPMV_ELL(run_params);
+       break;
+    }
+    case Sparse_SPMV_SELL : {
+       kernel = new sparse::SPMV_SELL(run_params);
+       break;
+    }
+
     default: {
       getCout() << "\n Unknown Kernel ID = " << kid << std::endl;
     }
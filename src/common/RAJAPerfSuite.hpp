@@ -53,6 +53,8 @@ enum GroupID {
   Apps,
   Algorithm,
   Comm,
+  Indirect,
+  Sparse,
 
   NumGroups // Keep this one last and DO NOT remove (!!)
 
@@ -104,12 +106,15 @@ enum KernelID {
   Lcals_FIRST_DIFF,
   Lcals_FIRST_MIN,
   Lcals_FIRST_SUM,
+  Lcals_FIRST_SUM_ORIG,
   Lcals_GEN_LIN_RECUR,
+  Lcals_GEN_LIN_RECUR_ORIG,
   Lcals_HYDRO_1D,
   Lcals_HYDRO_2D,
   Lcals_INT_PREDICT,
   Lcals_PLANCKIAN,
   Lcals_TRIDIAG_ELIM,
+  Lcals_TRIDIAG_ELIM_ORIG,
 
 //
 // Polybench kernels...
@@ -120,6 +125,7 @@ enum KernelID {
   Polybench_ATAX,
   Polybench_FDTD_2D,
   Polybench_FLOYD_WARSHALL,
+  Polybench_FLOYD_WARSHALL_ORIG,
   Polybench_GEMM,
   Polybench_GEMVER,
   Polybench_GESUMMV,
@@ -149,6 +155,9 @@ enum KernelID {
   Apps_LTIMES,
   Apps_LTIMES_NOVIEW,
   Apps_MASS3DEA,
+  Apps_MASS3DOP_PA,
+  Apps_MASS3DOP_EA,
+  Apps_MASS3DOP_CSR,
   Apps_MASS3DPA,
   Apps_NODAL_ACCUMULATION_3D,
   Apps_PRESSURE,
@@ -164,18 +173,36 @@ enum KernelID {
   Algorithm_REDUCE_SUM,
   Algorithm_MEMSET,
   Algorithm_MEMCPY,
+  Algorithm_HISTOGRAM,
+  Algorithm_POINTER_CHASE,
 
 //
 // Comm kernels...
 //
   Comm_HALO_PACKING,
   Comm_HALO_PACKING_FUSED,
+  Comm_HALO_EXCHANGE_SHMEM,
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
   Comm_HALO_SENDRECV,
   Comm_HALO_EXCHANGE,
   Comm_HALO_EXCHANGE_FUSED,
+  Comm_HALO_EXCHANGE_OVERLAP,
 #endif
 
+//
+// Indirect kernels...
+//
+  Indirect_GATHER,
+  Indirect_SCATTER,
+  Indirect_GATHER_SCATTER,
+
+//
+// Sparse kernels...
+//
+  Sparse_SPMV_CSR,
+  Sparse_SPMV_ELL,
+  Sparse_SPMV_SELL,
+
   NumKernels // Keep this one last and NEVER comment out (!!)
 
 };
@@ -0,0 +1,207 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Helpers for running first-order linear recurrences,
+///
+///   x[i] = a[i] * x[i-1] + b[i]
+///
+/// in parallel. Each step of such a recurrence is the affine map
+/// x -> a[i]*x + b[i], and the composition of affine maps is associative,
+/// so the value entering any range of steps may be found by a scan of the
+/// maps of the preceding ranges. The parallel algorithms here compose the
+/// maps of each block of steps, scan the block maps, and then rerun the
+/// steps of each block starting from its scanned value.
+///
+/// The recurrence is given by two callables:
+///   map(i)          returns the AffineMap of step i, and
+///   step(i, x_prev) runs step i given the value entering it and returns
+///                   the value leaving it.
+///
+
+#ifndef RAJAPerf_RecurrenceUtils_HPP
+#define RAJAPerf_RecurrenceUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Affine map x -> a*x + b.
+ */
+struct AffineMap
+{
+  Real_type a;
+  Real_type b;
+};
+
+/*!
+ * \brief Return the map that applies first and then second.
+ */
+inline AffineMap composeAffineMaps(const AffineMap& first,
+                                   const AffineMap& second)
+{
+  return AffineMap{ second.a * first.a, second.a * first.b + second.b };
+}
+
+/*!
+ * \brief Apply map to x.
+ */
+inline Real_type applyAffineMap(const AffineMap& map, Real_type x)
+{
+  return map.a * x + map.b;
+}
+
+/*!
+ * \brief Number of steps per block used by recursive doubling.
+ */
+constexpr Index_type recurrence_block_size = 2048;
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+/*!
+ * \brief Run the recurrence over [ibegin, iend) starting from x_init with
+ *        one block of steps per thread. The block maps are scanned
+ *        serially by each thread, as in the SCAN kernel.
+ *
+ * thread_maps must hold at least omp_get_max_threads() entries.
+ * Returns the value leaving the last step.
+ */
+template < typename MAP, typename STEP >
+Real_type affineRecurrenceScan(Index_type ibegin, Index_type iend,
+                               Real_type x_init,
+                               MAP&& map, STEP&& step,
+                               std::vector<AffineMap>& thread_maps)
+{
+  const Index_type n = iend - ibegin;
+  if (n <= 0) {
+    return x_init;
+  }
+  const int p0 = static_cast<int>(std::min(n,
+                     static_cast<Index_type>(thread_maps.size())));
+
+  Real_type x_final = x_init;
+
+  #pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Index_type step_size = n / p;
+    const Index_type local_begin = pid * step_size + ibegin;
+    const Index_type local_end = (pid == p-1) ? iend : (pid+1) * step_size + ibegin;
+
+    if (pid != p-1) {
+      AffineMap local_map{1.0, 0.0};
+      for (Index_type i = local_begin; i < local_end; ++i ) {
+        local_map = composeAffineMaps(local_map, map(i));
+      }
+      thread_maps[pid] = local_map;
+    }
+
+    #pragma omp barrier
+
+    Real_type x = x_init;
+    for (int ip = 0; ip < pid; ++ip) {
+      x = applyAffineMap(thread_maps[ip], x);
+    }
+
+    for (Index_type i = local_begin; i < local_end; ++i ) {
+      x = step(i, x);
+    }
+
+    if (pid == p-1) {
+      x_final = x;
+    }
+  }
+
+  return x_final;
+}
+
+/*!
+ * \brief Run the recurrence over [ibegin, iend) starting from x_init with
+ *        blocks of recurrence_block_size steps. The block maps are scanned
+ *        in parallel by recursive doubling, taking log2(number of blocks)
+ *        parallel passes.
+ *
+ * block_maps and block_maps_tmp must hold at least
+ * (iend - ibegin + recurrence_block_size - 1) / recurrence_block_size
+ * entries. Returns the value leaving the last step.
+ */
+template < typename MAP, typename STEP >
+Real_type affineRecurrenceRecursiveDoubling(Index_type ibegin, Index_type iend,
+                                            Real_type x_init,
+                                            MAP&& map, STEP&& step,
+                                            std::vector<AffineMap>& block_maps,
+                                            std::vector<AffineMap>& block_maps_tmp)
+{
+  const Index_type n = iend - ibegin;
+  if (n <= 0) {
+    return x_init;
+  }
+  const Index_type nblocks =
+      (n + recurrence_block_size - 1) / recurrence_block_size;
+
+  AffineMap* maps_in = block_maps.data();
+  AffineMap* maps_out = block_maps_tmp.data();
+
+  Real_type x_final = x_init;
+
+  #pragma omp parallel
+  {
+    #pragma omp for
+    for (Index_type ib = 0; ib < nblocks; ++ib) {
+      const Index_type local_begin = ibegin + ib * recurrence_block_size;
+      const Index_type local_end = std::min(local_begin + recurrence_block_size, iend);
+      AffineMap local_map{1.0, 0.0};
+      for (Index_type i = local_begin; i < local_end; ++i ) {
+        local_map = composeAffineMaps(local_map, map(i));
+      }
+      maps_in[ib] = local_map;
+    }
+
+    // inclusive scan of the block maps, each thread swaps its own copy of
+    // the pointers so all agree on where the scanned maps end up
+    AffineMap* scan_in = maps_in;
+    AffineMap* scan_out = maps_out;
+    for (Index_type dist = 1; dist < nblocks; dist *= 2) {
+      #pragma omp for
+      for (Index_type ib = 0; ib < nblocks; ++ib) {
+        scan_out[ib] = (ib >= dist) ? composeAffineMaps(scan_in[ib-dist], scan_in[ib])
+                                    : scan_in[ib];
+      }
+      std::swap(scan_in, scan_out);
+    }
+
+    #pragma omp for
+    for (Index_type ib = 0; ib < nblocks; ++ib) {
+      const Index_type local_begin = ibegin + ib * recurrence_block_size;
+      const Index_type local_end = std::min(local_begin + recurrence_block_size, iend);
+      Real_type x = (ib == 0) ? x_init : applyAffineMap(scan_in[ib-1], x_init);
+      for (Index_type i = local_begin; i < local_end; ++i ) {
+        x = step(i, x);
+      }
+      if (ib == nblocks-1) {
+        x_final = x;
+      }
+    }
+  }
+
+  return x_final;
+}
+
+#endif
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,267 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Reproducible sums, used by the "pairwise" and "binned" tunings of
+/// floating point sum reductions.
+///
+/// The result of a floating point sum depends on the order of the
+/// additions, so sums computed with OpenMP reductions change with the
+/// number of threads and the schedule. The sums here give the same bits
+/// for any number of threads:
+///
+///   pairwise  sums fixed blocks of reproducible_sum_block_size terms in
+///             index order, then sums the block sums by a fixed binary
+///             tree. The OpenMP and sequential sums are identical.
+///
+///   binned    finds the maximum magnitude M of the n terms, then splits
+///             each term into three parts, each rounded to a multiple of
+///             a power of two set by M and n, as in the binned summation
+///             of ReproBLAS. The parts at each level sum exactly in any
+///             order, so only the final addition of the levels rounds.
+///             This reads the terms twice.
+///
+/// Both assume IEEE arithmetic with round to nearest, so they must not be
+/// compiled with reassociation of floating point operations allowed
+/// (e.g. -ffast-math). The binned sum assumes finite terms with n*M and
+/// the smallest bin in the normal range.
+///
+/// Kernels take the sums through a sum helper, pairwise_sum_helper or
+/// binned_sum_helper, which also names the tuning. The checksum report
+/// shows how far the results of these tunings are from those of the
+/// default tuning, and the timing reports show their cost.
+///
+
+#ifndef RAJAPerf_ReproducibleSumUtils_HPP
+#define RAJAPerf_ReproducibleSumUtils_HPP
+
+#include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Number of terms per block of pairwise sums.
+ */
+const Index_type reproducible_sum_block_size = 1024;
+
+namespace detail
+{
+
+inline Index_type pairwiseSumNumBlocks(Index_type len)
+{
+  return (len + reproducible_sum_block_size - 1) / reproducible_sum_block_size;
+}
+
+//
+// Sum the n values in partials by a binary tree fixed by n.
+//
+inline Real_type pairwiseTreeSum(Real_ptr partials, Index_type n)
+{
+  for (Index_type s = 1; s < n; s *= 2) {
+    for (Index_type b = 0; b + s < n; b += 2*s) {
+      partials[b] += partials[b + s];
+    }
+  }
+  return (n > 0) ? partials[0] : 0.0;
+}
+
+//
+// Set the bin constants of a binned sum of n terms of magnitude at most
+// max_abs. Adding and subtracting sigma[k] rounds a value to a multiple of
+// ulp(sigma[k]), and any n of those multiples sum exactly.
+//
+inline void binnedSumSigmas(Index_type n, Real_type max_abs,
+                            Real_type (&sigma)[3])
+{
+  int log2_n = 0;
+  while ((Index_type(1) << log2_n) < n) {
+    ++log2_n;
+  }
+
+  int e_max;
+  std::frexp(max_abs, &e_max);
+
+  // n * max_abs < 2^(e - 1) and each level keeps 51 - log2_n bits
+  int e = e_max + log2_n + 1;
+  for (int k = 0; k < 3; ++k) {
+    sigma[k] = std::ldexp(1.5, e);
+    e -= 51 - log2_n;
+  }
+}
+
+}  // closing brace for detail namespace
+
+/*!
+ * \brief Pairwise sum of term(i) for i in [ibegin, iend).
+ *
+ * work holds workspaceSize(iend - ibegin) values.
+ */
+struct pairwise_sum_helper
+{
+  static std::string get_name() { return "pairwise"; }
+
+  static Index_type workspaceSize(Index_type len)
+  {
+    return detail::pairwiseSumNumBlocks(len);
+  }
+
+  template < typename TERM >
+  static Real_type sumSeq(Index_type ibegin, Index_type iend,
+                          TERM&& term, Real_ptr work)
+  {
+    const Index_type nblocks = detail::pairwiseSumNumBlocks(iend - ibegin);
+
+    for (Index_type b = 0; b < nblocks; ++b) {
+      const Index_type bbegin = ibegin + b * reproducible_sum_block_size;
+      const Index_type bend = std::min(bbegin + reproducible_sum_block_size, iend);
+      Real_type sum = 0.0;
+      for (Index_type i = bbegin; i < bend; ++i) {
+        sum += term(i);
+      }
+      work[b] = sum;
+    }
+
+    return detail::pairwiseTreeSum(work, nblocks);
+  }
+
+  template < typename TERM >
+  static Real_type sumOpenMP(Index_type ibegin, Index_type iend,
+                             TERM&& term, Real_ptr work)
+  {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    const Index_type nblocks = detail::pairwiseSumNumBlocks(iend - ibegin);
+
+    #pragma omp parallel for
+    for (Index_type b = 0; b < nblocks; ++b) {
+      const Index_type bbegin = ibegin + b * reproducible_sum_block_size;
+      const Index_type bend = std::min(bbegin + reproducible_sum_block_size, iend);
+      Real_type sum = 0.0;
+      for (Index_type i = bbegin; i < bend; ++i) {
+        sum += term(i);
+      }
+      work[b] = sum;
+    }
+
+    return detail::pairwiseTreeSum(work, nblocks);
+#else
+    return sumSeq(ibegin, iend, term, work);
+#endif
+  }
+};
+
+/*!
+ * \brief Binned sum of term(i) for i in [ibegin, iend).
+ *
+ * Uses no workspace.
+ */
+struct binned_sum_helper
+{
+  static std::string get_name() { return "binned"; }
+
+  static Index_type workspaceSize(Index_type RAJAPERF_UNUSED_ARG(len))
+  {
+    return 0;
+  }
+
+  template < typename TERM >
+  static Real_type sumSeq(Index_type ibegin, Index_type iend,
+                          TERM&& term, Real_ptr RAJAPERF_UNUSED_ARG(work))
+  {
+    Real_type max_abs = 0.0;
+    for (Index_type i = ibegin; i < iend; ++i) {
+      max_abs = std::max(max_abs, std::abs(term(i)));
+    }
+    if (max_abs == 0.0) {
+      return 0.0;
+    }
+
+    Real_type sigma[3];
+    detail::binnedSumSigmas(iend - ibegin, max_abs, sigma);
+    const Real_type sigma0 = sigma[0];
+    const Real_type sigma1 = sigma[1];
+    const Real_type sigma2 = sigma[2];
+
+    Real_type bin0 = 0.0;
+    Real_type bin1 = 0.0;
+    Real_type bin2 = 0.0;
+    for (Index_type i = ibegin; i < iend; ++i) {
+      Real_type r = term(i);
+      const Real_type q0 = (sigma0 + r) - sigma0;
+      r -= q0;
+      const Real_type q1 = (sigma1 + r) - sigma1;
+      r -= q1;
+      const Real_type q2 = (sigma2 + r) - sigma2;
+      bin0 += q0;
+      bin1 += q1;
+      bin2 += q2;
+    }
+
+    return bin0 + (bin1 + bin2);
+  }
+
+  template < typename TERM >
+  static Real_type sumOpenMP(Index_type ibegin, Index_type iend,
+                             TERM&& term, Real_ptr work)
+  {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    RAJAPERF_UNUSED_VAR(work);
+
+    Real_type max_abs = 0.0;
+    #pragma omp parallel for reduction(max:max_abs)
+    for (Index_type i = ibegin; i < iend; ++i) {
+      max_abs = std::max(max_abs, std::abs(term(i)));
+    }
+    if (max_abs == 0.0) {
+      return 0.0;
+    }
+
+    Real_type sigma[3];
+    detail::binnedSumSigmas(iend - ibegin, max_abs, sigma);
+    const Real_type sigma0 = sigma[0];
+    const Real_type sigma1 = sigma[1];
+    const Real_type sigma2 = sigma[2];
+
+    Real_type bin0 = 0.0;
+    Real_type bin1 = 0.0;
+    Real_type bin2 = 0.0;
+    #pragma omp parallel for reduction(+:bin0, bin1, bin2)
+    for (Index_type i = ibegin; i < iend; ++i) {
+      Real_type r = term(i);
+      const Real_type q0 = (sigma0 + r) - sigma0;
+      r -= q0;
+      const Real_type q1 = (sigma1 + r) - sigma1;
+      r -= q1;
+      const Real_type q2 = (sigma2 + r) - sigma2;
+      bin0 += q0;
+      bin1 += q1;
+      bin2 += q2;
+    }
+
+    return bin0 + (bin1 + bin2);
+#else
+    return sumSeq(ibegin, iend, term, work);
+#endif
+  }
+};
+
+/*!
+ * \brief Sum helpers used with seq_for to generate reproducible sum
+ *        tunings.
+ */
+using reproducible_sum_helpers = camp::list< pairwise_sum_helper,
+                                             binned_sum_helper >;
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
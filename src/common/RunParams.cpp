@@ -43,6 +43,17 @@ RunParams::RunParams(int argc, char** argv)
    mpi_size(1),
    mpi_rank(0),
    mpi_3d_division({-1, -1, -1}),
+   shmem_3d_division({2, 2, 2}),
+   halo_width(-1),
+   halo_num_vars(-1),
+   halo_grid_dims({-1, -1, -1}),
+   halo_interleaved_vars(false),
+   histogram_num_bins(-1),
+   histogram_distribution("uniform"),
+   indirect_index_pattern("random"),
+   indirect_index_stride(-1),
+   sparse_matrix("laplace7"),
+   fir_coefflen(-1),
    pf_tol(0.1),
    checkrun_reps(1),
    reference_variant(),
@@ -71,6 +82,7 @@ RunParams::RunParams(int argc, char** argv)
    add_to_spot_config(),
 #endif
    disable_warmup(false),
+   blocked_checksum(false),
    run_kernels(),
    run_variants()
 {
@@ -128,6 +140,23 @@ void RunParams::print(std::ostream& str) const
   for (size_t j = 0; j < 3; ++j) {
     str << "\n\t" << mpi_3d_division[j];
   }
+  str << "\n shmem_3d_division = ";
+  for (size_t j = 0; j < 3; ++j) {
+    str << "\n\t" << shmem_3d_division[j];
+  }
+  str << "\n halo_width = " << halo_width;
+  str << "\n halo_num_vars = " << halo_num_vars;
+  str << "\n halo_grid_dims = ";
+  for (size_t j = 0; j < 3; ++j) {
+    str << "\n\t" << halo_grid_dims[j];
+  }
+  str << "\n halo_var_layout = " << (halo_interleaved_vars ? "interleaved" : "separate");
+  str << "\n histogram_num_bins = " << histogram_num_bins;
+  str << "\n histogram_distribution = " << histogram_distribution;
+  str << "\n indirect_index_pattern = " << indirect_index_pattern;
+  str << "\n indirect_index_stride = " << indirect_index_stride;
+  str << "\n sparse_matrix = " << sparse_matrix;
+  str << "\n fir_coefflen = " << fir_coefflen;
   str << "\n pf_tol = " << pf_tol;
   str << "\n checkrun_reps = " << checkrun_reps;
   str << "\n reference_variant = " << reference_variant;
@@ -142,6 +171,8 @@ void RunParams::print(std::ostream& str) const
 
   str << "\n disable_warmup = " << disable_warmup;
 
+  str << "\n blocked_checksum = " << blocked_checksum;
+
   str << "\n seq data space = " << getDataSpaceName(seqDataSpace);
   str << "\n omp data space = " << getDataSpaceName(ompDataSpace);
   str << "\n omp target data space = " << getDataSpaceName(ompTargetDataSpace);
@@ -496,6 +527,249 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--shmem_3d_division") ) {
+
+      int num_got = 0;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          num_got += 1;
+          int number = ::atoi( opt.c_str() );
+          if ( number <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --shmem_3d_division POSITIVE values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else if (num_got <= 3) {
+            shmem_3d_division[num_got-1] = number;
+          }
+          ++i;
+        }
+      }
+      if (num_got != 3) {
+        getCout() << "\nBad input:"
+                  << " must give --shmem_3d_division three values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--halo_width") ) {
+
+      i++;
+      if ( i < argc ) {
+        halo_width = ::atoi( argv[i] );
+        if ( halo_width <= 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --halo_width a POSITIVE value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --halo_width a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--halo_num_vars") ) {
+
+      i++;
+      if ( i < argc ) {
+        halo_num_vars = ::atoi( argv[i] );
+        if ( halo_num_vars <= 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --halo_num_vars a POSITIVE value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --halo_num_vars a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--halo_grid_dims") ) {
+
+      int num_got = 0;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          num_got += 1;
+          int number = ::atoi( opt.c_str() );
+          if ( number <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --halo_grid_dims POSITIVE values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else if (num_got <= 3) {
+            halo_grid_dims[num_got-1] = number;
+          }
+          ++i;
+        }
+      }
+      if (num_got != 3) {
+        getCout() << "\nBad input:"
+                  << " must give --halo_grid_dims three values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--halo_var_layout") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string layout( argv[i] );
+        if ( layout == std::string("separate") ) {
+          halo_interleaved_vars = false;
+        } else if ( layout == std::string("interleaved") ) {
+          halo_interleaved_vars = true;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --halo_var_layout separate or interleaved"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --halo_var_layout a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--histogram_num_bins") ) {
+
+      i++;
+      if ( i < argc ) {
+        histogram_num_bins = ::atoi( argv[i] );
+        if ( histogram_num_bins <= 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --histogram_num_bins a POSITIVE value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --histogram_num_bins a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--histogram_distribution") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string distribution( argv[i] );
+        if ( distribution == std::string("uniform") ||
+             distribution == std::string("zipf") ||
+             distribution == std::string("clustered") ) {
+          histogram_distribution = distribution;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --histogram_distribution uniform, zipf or clustered"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --histogram_distribution a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--indirect_index_pattern") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string pattern( argv[i] );
+        if ( pattern == std::string("identity") ||
+             pattern == std::string("stride") ||
+             pattern == std::string("blocked_random") ||
+             pattern == std::string("random") ||
+             pattern == std::string("sorted_random") ) {
+          indirect_index_pattern = pattern;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --indirect_index_pattern identity, stride,"
+                    << " blocked_random, random or sorted_random"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --indirect_index_pattern a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--indirect_index_stride") ) {
+
+      i++;
+      if ( i < argc ) {
+        indirect_index_stride = ::atoi( argv[i] );
+        if ( indirect_index_stride <= 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --indirect_index_stride a POSITIVE value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --indirect_index_stride a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--sparse_matrix") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string matrix( argv[i] );
+        if ( matrix == std::string("laplace7") ||
+             matrix == std::string("laplace27") ||
+             matrix == std::string("random") ) {
+          sparse_matrix = matrix;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --sparse_matrix laplace7, laplace27 or random"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --sparse_matrix a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--fir_coefflen") ) {
+
+      i++;
+      if ( i < argc ) {
+        fir_coefflen = ::atoi( argv[i] );
+        if ( fir_coefflen <= 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --fir_coefflen a POSITIVE value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --fir_coefflen a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--pass-fail-tol") ||
                 opt == std::string("-pftol") ) {
 
@@ -796,6 +1070,10 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
 
       disable_warmup = true;
 
+    } else if ( std::string(argv[i]) == std::string("--blocked-checksum") ) {
+
+      blocked_checksum = true;
+
     } else if ( std::string(argv[i]) == std::string("--checkrun") ) {
 
       input_state = CheckRun;
@@ -985,6 +1263,8 @@ void RunParams::printHelpMessage(std::ostream& str) const
 
   str << "\t --disable-warmup (disable warmup kernels) [Default is run warmup kernels that are relevant to kernels selected to run]\n\n";
 
+  str << "\t --blocked-checksum (compute checksums in parallel over fixed size blocks) [Default is serial reference checksum]\n\n";
+
   str << "\t --kernels, -k <space-separated strings> [Default is run all]\n"
       << "\t      (names of individual kernels and/or groups of kernels to run)\n"
       << "\t      See '--print-kernels'/'-pk' option for list of valid kernel and group names.\n"
@@ -1083,6 +1363,72 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --mpi_3d_division 2 3 5 (runs 3d MPI kernels on a 2 by 3 by 5 grid)\n\n";
 
+  str << "\t --shmem_3d_division <space-separated ints> [default is 2 2 2]\n"
+      << "\t      (number of emulated ranks in each dimension of a 3d grid\n"
+      << "\t       for shared-memory halo exchange kernels)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --shmem_3d_division 4 2 2 (exchanges halos among 16 emulated ranks)\n\n";
+
+  str << "\t --halo_width <int> [default is 1]\n"
+      << "\t      (width of the halo in comm kernels)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --halo_width 4 (exchanges halos four zones deep)\n\n";
+
+  str << "\t --halo_num_vars <int> [default is 3]\n"
+      << "\t      (number of variables exchanged in comm kernels)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --halo_num_vars 8 (packs eight variables into each message)\n\n";
+
+  str << "\t --halo_grid_dims <space-separated ints> [no default]\n"
+      << "\t      (zones per rank in each dimension of comm kernel grids,\n"
+      << "\t       overrides the grid size derived from problem size)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --halo_grid_dims 400 50 50 (runs comm kernels on a 400 by 50 by 50 grid)\n\n";
+
+  str << "\t --halo_var_layout <string> [default is separate]\n"
+      << "\t      (layout of comm kernel variables, separate arrays or\n"
+      << "\t       interleaved in one array; interleaved is only\n"
+      << "\t       supported by Comm_HALO_PACKING)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --halo_var_layout interleaved\n\n";
+
+  str << "\t --histogram_num_bins <int> [default is 1024]\n"
+      << "\t      (number of distinct target addresses in histogram kernels)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --histogram_num_bins 16 (scatters all adds to 16 addresses)\n\n";
+
+  str << "\t --histogram_distribution <string> [default is uniform]\n"
+      << "\t      (distribution of histogram kernel bin indices, uniform,\n"
+      << "\t       zipf or clustered)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --histogram_distribution zipf\n\n";
+
+  str << "\t --indirect_index_pattern <string> [default is random]\n"
+      << "\t      (pattern of index arrays in Indirect kernels, identity,\n"
+      << "\t       stride, blocked_random, random or sorted_random)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --indirect_index_pattern blocked_random\n\n";
+
+  str << "\t --indirect_index_stride <int> [default is 8]\n"
+      << "\t      (stride of the stride index pattern, and number of\n"
+      << "\t       consecutive indices in each block of the blocked_random\n"
+      << "\t       index pattern, in Indirect kernels)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --indirect_index_stride 64\n\n";
+
+  str << "\t --sparse_matrix <string> [default is laplace7]\n"
+      << "\t      (matrix used by Sparse kernels, laplace7 or laplace27 for\n"
+      << "\t       the 7 or 27 point Laplacian on a 3d grid, or random for\n"
+      << "\t       a random graph)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --sparse_matrix laplace27\n\n";
+
+  str << "\t --fir_coefflen <int> [default is 16]\n"
+      << "\t      (number of taps of the FIR kernel, GPU variants run\n"
+      << "\t       up to 4096 taps)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --fir_coefflen 1024\n\n";
+
   str << "\t --tunings, -t <space-separated strings> [Default is run all]\n"
       << "\t      (names of tunings to run)\n"
       << "\t      Note: knowing which tunings are available requires knowledge about the variants,\n"
@@ -1708,6 +2054,27 @@ void RunParams::processKernelInput()
        !(invalid_exclude_feature_input.empty()) ) {
     input_state = BadInput;
   }
+
+  //
+  // Interleaved halo variable layout is only implemented in HALO_PACKING;
+  // reject it when other comm kernels would silently ignore it.
+  //
+
+  if ( halo_interleaved_vars ) {
+    for (KIDset::iterator kid_it = run_kernels.begin();
+         kid_it != run_kernels.end(); ++kid_it) {
+      KernelID kid = *kid_it;
+      if ( getFullKernelName(kid).find(getGroupName(Comm)) == 0 &&
+           kid != Comm_HALO_PACKING ) {
+        getCout() << "\nBad input:"
+                  << " --halo_var_layout interleaved is only supported by "
+                  << getFullKernelName(Comm_HALO_PACKING)
+                  << ", not " << getFullKernelName(kid)
+                  << std::endl;
+        input_state = BadInput;
+      }
+    }
+  }
    
 }
 
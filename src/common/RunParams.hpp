@@ -139,6 +139,22 @@ public:
   int getMPIRank() const { return mpi_rank; }
   bool validMPI3DDivision() const { return (mpi_3d_division[0]*mpi_3d_division[1]*mpi_3d_division[2] == mpi_size); }
   std::array<int, 3> const& getMPI3DDivision() const { return mpi_3d_division; }
+  std::array<int, 3> const& getShmem3DDivision() const { return shmem_3d_division; }
+
+  int getHaloWidth() const { return halo_width; }
+  int getHaloNumVars() const { return halo_num_vars; }
+  std::array<int, 3> const& getHaloGridDims() const { return halo_grid_dims; }
+  bool getHaloInterleavedVars() const { return halo_interleaved_vars; }
+
+  int getHistogramNumBins() const { return histogram_num_bins; }
+  const std::string& getHistogramDistribution() const { return histogram_distribution; }
+
+  const std::string& getIndirectIndexPattern() const { return indirect_index_pattern; }
+  int getIndirectIndexStride() const { return indirect_index_stride; }
+
+  const std::string& getSparseMatrix() const { return sparse_matrix; }
+
+  int getFirCoefflen() const { return fir_coefflen; }
 
   DataSpace getSeqDataSpace() const { return seqDataSpace; }
   DataSpace getOmpDataSpace() const { return ompDataSpace; }
@@ -181,6 +197,8 @@ public:
 
   bool getDisableWarmup() const { return disable_warmup; }
 
+  bool getBlockedChecksum() const { return blocked_checksum; }
+
   const std::set<KernelID>& getKernelIDsToRun() const { return run_kernels; }
   const std::set<VariantID>& getVariantIDsToRun() const { return run_variants; }
   VariantID getReferenceVariantID() const { return reference_vid; }
@@ -236,6 +254,17 @@ private:
   int mpi_size;           /*!< Number of MPI ranks */
   int mpi_rank;           /*!< Rank of this MPI process */
   std::array<int, 3> mpi_3d_division; /*!< Number of MPI ranks in each dimension of a 3D grid */
+  std::array<int, 3> shmem_3d_division; /*!< Number of emulated shared-memory ranks in each dimension of a 3D grid */
+  int halo_width;        /*!< Halo width for comm kernels (-1 -> kernel default) */
+  int halo_num_vars;     /*!< Number of variables for comm kernels (-1 -> kernel default) */
+  std::array<int, 3> halo_grid_dims; /*!< Grid dimensions per rank for comm kernels (-1 -> from problem size) */
+  bool halo_interleaved_vars; /*!< true -> store comm kernel variables interleaved */
+  int histogram_num_bins; /*!< Number of bins for histogram kernels (-1 -> kernel default) */
+  std::string histogram_distribution; /*!< Distribution of histogram bin indices */
+  std::string indirect_index_pattern; /*!< Pattern of index arrays for indirect kernels */
+  int indirect_index_stride; /*!< Stride or block length of indirect kernel index patterns (-1 -> kernel default) */
+  std::string sparse_matrix; /*!< Matrix used by sparse kernels */
+  int fir_coefflen;      /*!< Number of taps of FIR kernel (-1 -> kernel default) */
 
   double pf_tol;         /*!< pct RAJA variant run time can exceed base for
                               each PM case to pass/fail acceptance */
@@ -300,6 +329,8 @@ private:
 
   bool disable_warmup;
 
+  bool blocked_checksum; /*!< true -> use blocked parallel checksum */
+
   std::set<KernelID>  run_kernels;
   std::set<VariantID> run_variants;
 
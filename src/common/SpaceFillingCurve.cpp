@@ -0,0 +1,183 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SpaceFillingCurve.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace
+{
+
+/*
+ * Transform coordinates in place into the "transposed" Hilbert index
+ * (J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004).
+ */
+void hilbertAxesToTranspose(uint32_t* X, int nbits, int ndims)
+{
+  const uint32_t M = 1u << (nbits - 1);
+
+  // Inverse undo excess work
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    const uint32_t P = Q - 1;
+    for (int i = 0; i < ndims; ++i) {
+      if (X[i] & Q) {
+        X[0] ^= P;
+      } else {
+        const uint32_t t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int i = 1; i < ndims; ++i) {
+    X[i] ^= X[i-1];
+  }
+  uint32_t t = 0;
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    if (X[ndims-1] & Q) {
+      t ^= Q - 1;
+    }
+  }
+  for (int i = 0; i < ndims; ++i) {
+    X[i] ^= t;
+  }
+}
+
+template < typename IdxT >
+void sortBySFCImpl(IdxT* indices, Index_type len,
+                   Index_type jp, Index_type kp, SFCOrdering ordering)
+{
+  if (ordering == SFCOrdering::Lexicographic || len <= 1) {
+    return;
+  }
+
+  const int ndims = (kp > 0) ? 3 : 2;
+
+  auto decompose = [=](Index_type ip, uint32_t* coords) {
+    Index_type rem = ip;
+    coords[2] = 0;
+    if (ndims == 3) {
+      coords[2] = static_cast<uint32_t>(rem / kp);
+      rem = rem % kp;
+    }
+    coords[1] = static_cast<uint32_t>(rem / jp);
+    coords[0] = static_cast<uint32_t>(rem % jp);
+  };
+
+  uint32_t max_coord = 0;
+  for (Index_type ii = 0; ii < len; ++ii) {
+    uint32_t coords[3];
+    decompose(static_cast<Index_type>(indices[ii]), coords);
+    max_coord = std::max(max_coord,
+                         std::max(coords[0], std::max(coords[1], coords[2])));
+  }
+
+  int nbits = 1;
+  while ( (max_coord >> nbits) != 0 ) {
+    ++nbits;
+  }
+
+  std::vector<std::pair<uint64_t, IdxT>> keyed(len);
+  for (Index_type ii = 0; ii < len; ++ii) {
+    uint32_t coords[3];
+    decompose(static_cast<Index_type>(indices[ii]), coords);
+    keyed[ii] = std::make_pair(calcSFCKey(ordering, ndims, coords, nbits),
+                               indices[ii]);
+  }
+
+  std::stable_sort(keyed.begin(), keyed.end(),
+                   [](const std::pair<uint64_t, IdxT>& a,
+                      const std::pair<uint64_t, IdxT>& b) {
+                     return a.first < b.first;
+                   });
+
+  for (Index_type ii = 0; ii < len; ++ii) {
+    indices[ii] = keyed[ii].second;
+  }
+}
+
+}  // closing brace for anonymous namespace
+
+
+/*
+ * Return tuning name for given ordering.
+ */
+std::string getSFCOrderingName(SFCOrdering ordering)
+{
+  switch (ordering) {
+    case SFCOrdering::Morton : return "morton";
+    case SFCOrdering::Hilbert : return "hilbert";
+    default : return "default";
+  }
+}
+
+/*
+ * Return ordering for given tuning name.
+ */
+SFCOrdering getSFCOrderingFromName(const std::string& name)
+{
+  for (int io = 0; io < static_cast<int>(SFCOrdering::NumOrderings); ++io) {
+    SFCOrdering ordering = static_cast<SFCOrdering>(io);
+    if (name == getSFCOrderingName(ordering)) {
+      return ordering;
+    }
+  }
+  return SFCOrdering::Lexicographic;
+}
+
+/*
+ * Compute curve key by interleaving coordinate bits, most significant
+ * first, after applying the Hilbert transform if requested.
+ */
+uint64_t calcSFCKey(SFCOrdering ordering, int ndims,
+                    const uint32_t* coords, int nbits)
+{
+  uint32_t X[3] = {0, 0, 0};
+
+  // Slowest varying coordinate first so ties in a level follow k, j, i.
+  for (int d = 0; d < ndims; ++d) {
+    X[d] = coords[ndims-1-d];
+  }
+
+  if (ordering == SFCOrdering::Hilbert) {
+    hilbertAxesToTranspose(X, nbits, ndims);
+  }
+
+  uint64_t key = 0;
+  for (int b = nbits-1; b >= 0; --b) {
+    for (int d = 0; d < ndims; ++d) {
+      key = (key << 1) | ((X[d] >> b) & 1u);
+    }
+  }
+
+  return key;
+}
+
+/*
+ * Sort structured grid indices along space-filling curve.
+ */
+void sortBySFC(Index_type* indices, Index_type len,
+               Index_type jp, Index_type kp, SFCOrdering ordering)
+{
+  sortBySFCImpl(indices, len, jp, kp, ordering);
+}
+
+void sortBySFC(Int_type* indices, Index_type len,
+               Index_type jp, Index_type kp, SFCOrdering ordering)
+{
+  sortBySFCImpl(indices, len, jp, kp, ordering);
+}
+
+}  // closing brace for rajaperf namespace
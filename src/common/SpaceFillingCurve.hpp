@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for ordering structured mesh indices along space-filling curves.
+///
+/// Kernels use these to renumber index lists (and optionally data) before
+/// the timed loop so the effect of traversal locality can be measured as
+/// a tuning of an otherwise unchanged kernel.
+///
+
+#ifndef RAJAPerf_SpaceFillingCurve_HPP
+#define RAJAPerf_SpaceFillingCurve_HPP
+
+#include "RPTypes.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Enumeration of supported index orderings.
+ *
+ * Lexicographic is the natural (i fastest, then j, then k) ordering.
+ */
+enum struct SFCOrdering : int {
+  Lexicographic = 0,
+  Morton,
+  Hilbert,
+
+  NumOrderings // Keep this one last and NEVER comment out (!!)
+};
+
+/*!
+ * \brief Return tuning name for given ordering.
+ *
+ * Lexicographic ordering maps to the default tuning name.
+ */
+std::string getSFCOrderingName(SFCOrdering ordering);
+
+/*!
+ * \brief Return ordering for given tuning name.
+ *
+ * Names that do not match an ordering (e.g., GPU block size tunings)
+ * map to Lexicographic.
+ */
+SFCOrdering getSFCOrderingFromName(const std::string& name);
+
+/*!
+ * \brief Return position of point with given coordinates along curve.
+ *
+ * ndims must be 2 or 3 and each coordinate must be less than 2^nbits,
+ * with ndims * nbits <= 63.
+ */
+uint64_t calcSFCKey(SFCOrdering ordering, int ndims,
+                    const uint32_t* coords, int nbits);
+
+/*!
+ * \brief Stable sort array of linear indices into a structured grid with
+ *        strides (1, jp, kp) along the given curve.
+ *
+ * A 2d grid is indicated by kp == 0. Lexicographic ordering leaves the
+ * array unchanged.
+ */
+void sortBySFC(Index_type* indices, Index_type len,
+               Index_type jp, Index_type kp, SFCOrdering ordering);
+
+void sortBySFC(Int_type* indices, Index_type len,
+               Index_type jp, Index_type kp, SFCOrdering ordering);
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
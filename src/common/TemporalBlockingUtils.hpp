@@ -0,0 +1,355 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Helpers for running stencil kernels with temporal blocking, so several
+/// time steps are applied to a part of the grid while it is in cache
+/// rather than sweeping the whole grid once per time step.
+///
+/// A kernel is given as a number of sweeps and a callable
+///
+///   sweep(s, ibegin, iend)  runs sweep s on outer indices [ibegin, iend)
+///
+/// where sweep s reads only values written by sweep s-1 (or earlier) at
+/// outer indices within one of the indices it writes, and each array is
+/// either updated in place or alternates with another array between
+/// sweeps, as in the Polybench stencil kernels. Sweeps are tiled in the
+/// outer index only and run in time tiles of a given number of sweeps.
+/// Every point is computed once per sweep from the same values as in an
+/// untiled run, so results are identical.
+///
+/// Two tilings are provided:
+///
+///   trapezoid  each time tile runs the sweeps of every spatial tile over
+///              a range that shrinks by one index per sweep at each end,
+///              then fills the gaps between tiles, which grow by one
+///              index per sweep at each end. Tiles of each kind are
+///              independent and run in parallel.
+///   wavefront  each time tile walks blocks of outer indices with sweep
+///              q running two blocks behind sweep q-1. The sweeps and
+///              chunks of the blocks at each step run in parallel.
+///
+/// The time tile depths, in kernel time steps, are set by the CMake
+/// variable RAJA_PERFSUITE_TIME_TILE_DEPTHS.
+///
+
+#ifndef RAJAPerf_TemporalBlockingUtils_HPP
+#define RAJAPerf_TemporalBlockingUtils_HPP
+
+#include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Bytes of data touched by the sweeps of one tile, sized to stay
+ *        in a mid level cache.
+ */
+constexpr Index_type temporal_tile_bytes = 512*1024;
+
+/*!
+ * \brief Bytes of data per unit of parallel work in wavefront tiling.
+ */
+constexpr Index_type temporal_chunk_bytes = 4*1024;
+
+namespace detail
+{
+
+// Outer extent of trapezoid tiles, which must be at least twice the
+// number of sweeps per time tile so the gaps between tiles are disjoint.
+inline Index_type trapezoidTileSize(Index_type sweeps_per_tile,
+                                    Index_type bytes_per_index)
+{
+  return std::max(2*sweeps_per_tile, temporal_tile_bytes / bytes_per_index);
+}
+
+inline Index_type wavefrontChunkSize(Index_type bytes_per_index)
+{
+  return std::max(Index_type(1), temporal_chunk_bytes / bytes_per_index);
+}
+
+// Outer extent of wavefront blocks, so the blocks between the first and
+// last sweep of a time tile fit in temporal_tile_bytes, as a multiple of
+// the chunk size.
+inline Index_type wavefrontBlockSize(Index_type sweeps_per_tile,
+                                     Index_type bytes_per_index)
+{
+  const Index_type chunk_size = wavefrontChunkSize(bytes_per_index);
+  const Index_type block_size =
+      temporal_tile_bytes / (2*sweeps_per_tile*bytes_per_index);
+  return std::max(Index_type(1), block_size / chunk_size) * chunk_size;
+}
+
+// Outer index at the start of trapezoid tile k of ntiles in [ibegin, iend).
+inline Index_type trapezoidTileBegin(Index_type ibegin, Index_type iend,
+                                     Index_type ntiles, Index_type k)
+{
+  return ibegin + k * (iend - ibegin) / ntiles;
+}
+
+}  // closing brace for detail namespace
+
+/*!
+ * \brief Run nsweeps sweeps over [ibegin, iend) in time tiles of
+ *        sweeps_per_tile sweeps with trapezoid tiles.
+ *
+ * bytes_per_index is the size of the data of all arrays at one outer index.
+ */
+template < typename SWEEP >
+void trapezoidTemporalTilesSeq(Index_type ibegin, Index_type iend,
+                               Index_type nsweeps, Index_type sweeps_per_tile,
+                               Index_type bytes_per_index,
+                               SWEEP&& sweep)
+{
+  const Index_type n = iend - ibegin;
+  if (n <= 0) {
+    return;
+  }
+  const Index_type tile_size =
+      detail::trapezoidTileSize(sweeps_per_tile, bytes_per_index);
+  const Index_type ntiles = std::max(Index_type(1), n / tile_size);
+
+  for (Index_type s0 = 0; s0 < nsweeps; s0 += sweeps_per_tile) {
+    const Index_type d = std::min(sweeps_per_tile, nsweeps - s0);
+
+    for (Index_type k = 0; k < ntiles; ++k) {
+      const Index_type tbegin = detail::trapezoidTileBegin(ibegin, iend, ntiles, k);
+      const Index_type tend = detail::trapezoidTileBegin(ibegin, iend, ntiles, k+1);
+      for (Index_type q = 0; q < d; ++q) {
+        const Index_type lo = (k == 0) ? tbegin : tbegin + q;
+        const Index_type hi = (k == ntiles-1) ? tend : tend - q;
+        sweep(s0 + q, lo, hi);
+      }
+    }
+
+    for (Index_type k = 1; k < ntiles; ++k) {
+      const Index_type b = detail::trapezoidTileBegin(ibegin, iend, ntiles, k);
+      for (Index_type q = 1; q < d; ++q) {
+        sweep(s0 + q, b - q, b + q);
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Run nsweeps sweeps over [ibegin, iend) in time tiles of
+ *        sweeps_per_tile sweeps with wavefront tiling.
+ *
+ * bytes_per_index is the size of the data of all arrays at one outer index.
+ */
+template < typename SWEEP >
+void wavefrontTemporalTilesSeq(Index_type ibegin, Index_type iend,
+                               Index_type nsweeps, Index_type sweeps_per_tile,
+                               Index_type bytes_per_index,
+                               SWEEP&& sweep)
+{
+  const Index_type n = iend - ibegin;
+  if (n <= 0) {
+    return;
+  }
+  const Index_type block_size =
+      detail::wavefrontBlockSize(sweeps_per_tile, bytes_per_index);
+  const Index_type nblocks = (n + block_size - 1) / block_size;
+
+  for (Index_type s0 = 0; s0 < nsweeps; s0 += sweeps_per_tile) {
+    const Index_type d = std::min(sweeps_per_tile, nsweeps - s0);
+
+    for (Index_type w = 0; w < nblocks + 2*(d-1); ++w) {
+      for (Index_type q = 0; q < d; ++q) {
+        const Index_type p = w - 2*q;
+        if (p >= 0 && p < nblocks) {
+          const Index_type lo = ibegin + p * block_size;
+          const Index_type hi = std::min(lo + block_size, iend);
+          sweep(s0 + q, lo, hi);
+        }
+      }
+    }
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+/*!
+ * \brief Run nsweeps sweeps over [ibegin, iend) in time tiles of
+ *        sweeps_per_tile sweeps with trapezoid tiles, running the tiles
+ *        and the gaps between them in parallel.
+ */
+template < typename SWEEP >
+void trapezoidTemporalTilesOpenMP(Index_type ibegin, Index_type iend,
+                                  Index_type nsweeps, Index_type sweeps_per_tile,
+                                  Index_type bytes_per_index,
+                                  SWEEP&& sweep)
+{
+  const Index_type n = iend - ibegin;
+  if (n <= 0) {
+    return;
+  }
+  const Index_type tile_size =
+      detail::trapezoidTileSize(sweeps_per_tile, bytes_per_index);
+  const Index_type ntiles = std::max(Index_type(1), n / tile_size);
+
+  #pragma omp parallel
+  for (Index_type s0 = 0; s0 < nsweeps; s0 += sweeps_per_tile) {
+    const Index_type d = std::min(sweeps_per_tile, nsweeps - s0);
+
+    #pragma omp for schedule(dynamic, 1)
+    for (Index_type k = 0; k < ntiles; ++k) {
+      const Index_type tbegin = detail::trapezoidTileBegin(ibegin, iend, ntiles, k);
+      const Index_type tend = detail::trapezoidTileBegin(ibegin, iend, ntiles, k+1);
+      for (Index_type q = 0; q < d; ++q) {
+        const Index_type lo = (k == 0) ? tbegin : tbegin + q;
+        const Index_type hi = (k == ntiles-1) ? tend : tend - q;
+        sweep(s0 + q, lo, hi);
+      }
+    }
+
+    #pragma omp for schedule(dynamic, 1)
+    for (Index_type k = 1; k < ntiles; ++k) {
+      const Index_type b = detail::trapezoidTileBegin(ibegin, iend, ntiles, k);
+      for (Index_type q = 1; q < d; ++q) {
+        sweep(s0 + q, b - q, b + q);
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Run nsweeps sweeps over [ibegin, iend) in time tiles of
+ *        sweeps_per_tile sweeps with wavefront tiling, running the chunks
+ *        of the blocks of all sweeps at each wavefront step in parallel.
+ */
+template < typename SWEEP >
+void wavefrontTemporalTilesOpenMP(Index_type ibegin, Index_type iend,
+                                  Index_type nsweeps, Index_type sweeps_per_tile,
+                                  Index_type bytes_per_index,
+                                  SWEEP&& sweep)
+{
+  const Index_type n = iend - ibegin;
+  if (n <= 0) {
+    return;
+  }
+  const Index_type block_size =
+      detail::wavefrontBlockSize(sweeps_per_tile, bytes_per_index);
+  const Index_type chunk_size = detail::wavefrontChunkSize(bytes_per_index);
+  const Index_type chunks_per_block = block_size / chunk_size;
+  const Index_type nblocks = (n + block_size - 1) / block_size;
+
+  #pragma omp parallel
+  for (Index_type s0 = 0; s0 < nsweeps; s0 += sweeps_per_tile) {
+    const Index_type d = std::min(sweeps_per_tile, nsweeps - s0);
+
+    for (Index_type w = 0; w < nblocks + 2*(d-1); ++w) {
+      #pragma omp for schedule(static)
+      for (Index_type ic = 0; ic < d * chunks_per_block; ++ic) {
+        const Index_type q = ic / chunks_per_block;
+        const Index_type p = w - 2*q;
+        if (p >= 0 && p < nblocks) {
+          const Index_type lo = ibegin + p * block_size +
+                                (ic % chunks_per_block) * chunk_size;
+          const Index_type hi = std::min(lo + chunk_size, iend);
+          if (lo < hi) {
+            sweep(s0 + q, lo, hi);
+          }
+        }
+      }
+    }
+  }
+}
+
+#endif
+
+
+/*!
+ * \brief Helpers naming the tiling and time tile depth of each temporal
+ *        blocking tuning, used with seq_for to generate the tunings.
+ *
+ * time_tile_depth is in time steps of the kernel; kernels with several
+ * sweeps per time step multiply it by their sweeps per time step.
+ */
+template < size_t depth >
+struct trapezoid_tiling_helper
+{
+  static constexpr Index_type time_tile_depth = static_cast<Index_type>(depth);
+  static std::string get_name() { return "trapezoid_"+std::to_string(depth); }
+
+  template < typename SWEEP >
+  static void runSeq(Index_type ibegin, Index_type iend,
+                     Index_type nsweeps, Index_type sweeps_per_tile,
+                     Index_type bytes_per_index, SWEEP&& sweep)
+  {
+    trapezoidTemporalTilesSeq(ibegin, iend, nsweeps, sweeps_per_tile,
+                              bytes_per_index, std::forward<SWEEP>(sweep));
+  }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  template < typename SWEEP >
+  static void runOpenMP(Index_type ibegin, Index_type iend,
+                        Index_type nsweeps, Index_type sweeps_per_tile,
+                        Index_type bytes_per_index, SWEEP&& sweep)
+  {
+    trapezoidTemporalTilesOpenMP(ibegin, iend, nsweeps, sweeps_per_tile,
+                                 bytes_per_index, std::forward<SWEEP>(sweep));
+  }
+#endif
+};
+
+template < size_t depth >
+struct wavefront_tiling_helper
+{
+  static constexpr Index_type time_tile_depth = static_cast<Index_type>(depth);
+  static std::string get_name() { return "wavefront_"+std::to_string(depth); }
+
+  template < typename SWEEP >
+  static void runSeq(Index_type ibegin, Index_type iend,
+                     Index_type nsweeps, Index_type sweeps_per_tile,
+                     Index_type bytes_per_index, SWEEP&& sweep)
+  {
+    wavefrontTemporalTilesSeq(ibegin, iend, nsweeps, sweeps_per_tile,
+                              bytes_per_index, std::forward<SWEEP>(sweep));
+  }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  template < typename SWEEP >
+  static void runOpenMP(Index_type ibegin, Index_type iend,
+                        Index_type nsweeps, Index_type sweeps_per_tile,
+                        Index_type bytes_per_index, SWEEP&& sweep)
+  {
+    wavefrontTemporalTilesOpenMP(ibegin, iend, nsweeps, sweeps_per_tile,
+                                 bytes_per_index, std::forward<SWEEP>(sweep));
+  }
+#endif
+};
+
+namespace detail
+{
+
+template < typename time_tile_depths >
+struct make_temporal_tiling_helpers;
+
+template < size_t... depths >
+struct make_temporal_tiling_helpers<camp::list<camp::integral_constant<size_t, depths>...>>
+{
+  using type = camp::list< trapezoid_tiling_helper<depths>...,
+                           wavefront_tiling_helper<depths>... >;
+};
+
+}  // closing brace for detail namespace
+
+using temporal_tiling_helpers = typename detail::make_temporal_tiling_helpers<
+    rajaperf::configuration::time_tile_depths>::type;
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
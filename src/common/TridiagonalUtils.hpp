@@ -0,0 +1,138 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Parallel cyclic reduction (PCR) solver for tridiagonal systems with
+/// constant coefficients,
+///
+///   lower * x[j-1] + diag * x[j] + upper * x[j+1] = rhs(j),
+///
+/// for j in [jbegin, jend), given the values x[jbegin-1] and x[jend] at
+/// the ends.
+///
+/// Each PCR step eliminates the neighbors at distance s from every
+/// equation, coupling it to the equations at distance 2s, so after
+/// ceil(log2(m)) steps for m equations each equation holds one unknown.
+/// The equations of a step are independent, so the steps vectorize, at
+/// the cost of O(m log m) operations where the Thomas algorithm takes
+/// O(m) operations in a sequential recurrence.
+///
+/// The solver works in a workspace holding each array of coefficients
+/// with m identity equations on each side, so equations near the ends
+/// need no special cases.
+///
+
+#ifndef RAJAPerf_TridiagonalUtils_HPP
+#define RAJAPerf_TridiagonalUtils_HPP
+
+#include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+
+#include <utility>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Number of Real_type values in a workspace for solveTridiagonalPCR
+ *        for systems of m equations.
+ */
+inline Index_type tridiagonalPCRWorkspaceSize(Index_type m)
+{
+  return 8 * 3 * m;
+}
+
+/*!
+ * \brief Initialize a workspace for solveTridiagonalPCR for systems of m
+ *        equations.
+ *
+ * Sets the identity equations around each array, which solveTridiagonalPCR
+ * reads but never writes, so a workspace may be reused for any number of
+ * systems of m equations.
+ */
+inline void initTridiagonalPCRWorkspace(Index_type m, Real_ptr work)
+{
+  for (Index_type k = 0; k < 2; ++k) {
+    Real_ptr a = work + (4*k + 0) * 3 * m;
+    Real_ptr b = work + (4*k + 1) * 3 * m;
+    Real_ptr c = work + (4*k + 2) * 3 * m;
+    Real_ptr r = work + (4*k + 3) * 3 * m;
+    for (Index_type j = 0; j < 3 * m; ++j) {
+      a[j] = 0.0;
+      b[j] = 1.0;
+      c[j] = 0.0;
+      r[j] = 0.0;
+    }
+  }
+}
+
+/*!
+ * \brief Solve the tridiagonal system for x[j], j in [jbegin, jend), by
+ *        parallel cyclic reduction.
+ *
+ * x_lo and x_hi are the values of x[jbegin-1] and x[jend]. rhs(j) returns
+ * the right hand side of equation j and sol(j, x) is called with the
+ * solution for each j. work is a workspace initialized for systems of
+ * jend - jbegin equations by initTridiagonalPCRWorkspace.
+ */
+template < typename RHS, typename SOL >
+void solveTridiagonalPCR(Index_type jbegin, Index_type jend,
+                         Real_type lower, Real_type diag, Real_type upper,
+                         Real_type x_lo, Real_type x_hi,
+                         RHS&& rhs, SOL&& sol,
+                         Real_ptr work)
+{
+  const Index_type m = jend - jbegin;
+  if (m <= 0) {
+    return;
+  }
+
+  Real_ptr a_in = work + 0 * 3 * m + m;
+  Real_ptr b_in = work + 1 * 3 * m + m;
+  Real_ptr c_in = work + 2 * 3 * m + m;
+  Real_ptr r_in = work + 3 * 3 * m + m;
+  Real_ptr a_out = work + 4 * 3 * m + m;
+  Real_ptr b_out = work + 5 * 3 * m + m;
+  Real_ptr c_out = work + 6 * 3 * m + m;
+  Real_ptr r_out = work + 7 * 3 * m + m;
+
+  for (Index_type j = 0; j < m; ++j) {
+    a_in[j] = lower;
+    b_in[j] = diag;
+    c_in[j] = upper;
+    r_in[j] = rhs(jbegin + j);
+  }
+  a_in[0] = 0.0;
+  r_in[0] -= lower * x_lo;
+  c_in[m-1] = 0.0;
+  r_in[m-1] -= upper * x_hi;
+
+  for (Index_type s = 1; s < m; s *= 2) {
+    RAJAPERF_OMP_SIMD
+    for (Index_type j = 0; j < m; ++j) {
+      const Real_type k_lo = a_in[j] / b_in[j-s];
+      const Real_type k_hi = c_in[j] / b_in[j+s];
+      a_out[j] = -a_in[j-s] * k_lo;
+      b_out[j] = b_in[j] - c_in[j-s] * k_lo - a_in[j+s] * k_hi;
+      c_out[j] = -c_in[j+s] * k_hi;
+      r_out[j] = r_in[j] - r_in[j-s] * k_lo - r_in[j+s] * k_hi;
+    }
+    std::swap(a_in, a_out);
+    std::swap(b_in, b_out);
+    std::swap(c_in, c_out);
+    std::swap(r_in, r_out);
+  }
+
+  for (Index_type j = 0; j < m; ++j) {
+    sol(jbegin + j, r_in[j] / b_in[j]);
+  }
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
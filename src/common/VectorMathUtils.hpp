@@ -0,0 +1,308 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Math functions that vectorize, used by the "vecmath" and "libmvec"
+/// tunings of kernels dominated by calls to exp, log or sqrt.
+///
+/// Calls to the C math library do not vectorize unless the compiler is
+/// allowed to ignore errno (e.g. -ffast-math), so loops calling them run
+/// one element at a time. The functions in namespace vecmath are branch
+/// free, inline and do not set errno, so loops calling them vectorize
+/// under '#pragma omp simd'. They are polynomial approximations with the
+/// following maximum errors, measured against the C math library:
+///
+///   vecmath::exp   1 ulp   for x in [-708, 709], inf or 0 beyond range
+///   vecmath::log   1 ulp   for finite x > 0 (normal numbers)
+///   vecmath::sqrt  1 ulp   for finite x >= 0 (normal numbers)
+///
+/// Results for other inputs (negative, subnormal, nan) are not specified.
+///
+/// When RAJA_PERFSUITE_ENABLE_LIBMVEC is defined, libmvec::exp and
+/// libmvec::log call the vector versions of exp and log in the GNU C
+/// library's libmvec, which are accurate to 4 ulp. libmvec has no sqrt.
+///
+/// Kernels take the functions through a math helper, vecmath_helper or
+/// libmvec_helper, which also names the tuning. The checksum report shows
+/// how far the results of these tunings are from those of the default
+/// tuning, alongside their run times.
+///
+/// The exp clamp uses 64 bit integer compares, so on x86 loops calling
+/// vecmath::exp vectorize with SSE4.2 or later.
+///
+/// The functions work on the bits of doubles, so they and the tunings using
+/// them are only defined when Real_type is double (RAJAPERF_USE_VECMATH).
+///
+
+#ifndef RAJAPerf_VectorMathUtils_HPP
+#define RAJAPerf_VectorMathUtils_HPP
+
+#include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(RP_USE_DOUBLE)
+#define RAJAPERF_USE_VECMATH
+#endif
+
+#if defined(RAJAPERF_USE_VECMATH)
+
+#if defined(RAJA_PERFSUITE_ENABLE_LIBMVEC)
+extern "C" {
+#if defined(_OPENMP)
+#pragma omp declare simd notinbranch
+#endif
+double rajaperf_libmvec_exp(double) __asm__("exp");
+#if defined(_OPENMP)
+#pragma omp declare simd notinbranch
+#endif
+double rajaperf_libmvec_log(double) __asm__("log");
+}
+#endif
+
+namespace rajaperf
+{
+namespace vecmath
+{
+
+namespace detail
+{
+
+inline double asDouble(int64_t i)
+{
+  double d;
+  std::memcpy(&d, &i, sizeof(d));
+  return d;
+}
+
+inline int64_t asInt(double d)
+{
+  int64_t i;
+  std::memcpy(&i, &d, sizeof(i));
+  return i;
+}
+
+// 2^n for n in [-1022, 1023]
+inline double pow2(int64_t n)
+{
+  return asDouble((n + 1023) << 52);
+}
+
+}  // closing brace for detail namespace
+
+/*!
+ * \brief Return n as a double, exact for |n| < 2^51.
+ *
+ * Uses integer addition rather than an int64 to double conversion, which
+ * has no vector instruction on x86 before AVX-512.
+ */
+inline double indexToDouble(int64_t n)
+{
+  const double shifter = 6755399441055744.0; // 1.5 * 2^52
+  return detail::asDouble(detail::asInt(shifter) + n) - shifter;
+}
+
+/*!
+ * \brief Vectorizable exp.
+ *
+ * Reduces x = n*ln2 + r with |r| <= ln2/2 and evaluates a degree 13
+ * Taylor polynomial for exp(r), scaling by 2^n in two steps so results
+ * in the subnormal range are not flushed to zero.
+ */
+inline double exp(double x)
+{
+  const double log2e = 1.4426950408889634;
+  const double ln2_hi = 6.93147180369123816490e-01;
+  const double ln2_lo = 1.90821492927058770002e-10;
+  const double shifter = 6755399441055744.0; // 1.5 * 2^52
+
+  // clamp x to [-746, 710], beyond which the scaling below overflows to
+  // inf or underflows to 0 as exp(x) does. The clamp uses masks on the
+  // bits, as compilers do not if-convert floating point selects unless
+  // floating point exceptions are ignored. Nonnegative doubles order as
+  // signed integers and negative doubles as unsigned integers.
+  const int64_t x_hi = 0x4086300000000000LL; // 710.0
+  const uint64_t x_lo = 0xc087500000000000ULL; // -746.0
+  uint64_t ix = static_cast<uint64_t>(detail::asInt(x));
+  const uint64_t above = -static_cast<uint64_t>(static_cast<int64_t>(ix) > x_hi);
+  ix = (ix & ~above) | (static_cast<uint64_t>(x_hi) & above);
+  const uint64_t below = -static_cast<uint64_t>(ix > x_lo);
+  ix = (ix & ~below) | (x_lo & below);
+  const double xc = detail::asDouble(static_cast<int64_t>(ix));
+
+  // round x*log2e to the nearest integer n
+  const double kn = xc * log2e + shifter;
+  const double n = kn - shifter;
+  const int64_t in = detail::asInt(kn) - detail::asInt(shifter);
+
+  const double r = (xc - n * ln2_hi) - n * ln2_lo;
+
+  double p = 1.0 / 6227020800.0;
+  p = p * r + 1.0 / 479001600.0;
+  p = p * r + 1.0 / 39916800.0;
+  p = p * r + 1.0 / 3628800.0;
+  p = p * r + 1.0 / 362880.0;
+  p = p * r + 1.0 / 40320.0;
+  p = p * r + 1.0 / 5040.0;
+  p = p * r + 1.0 / 720.0;
+  p = p * r + 1.0 / 120.0;
+  p = p * r + 1.0 / 24.0;
+  p = p * r + 1.0 / 6.0;
+  p = p * r + 0.5;
+  p = p * r * r + r;
+  p = p + 1.0;
+
+  const int64_t in1 = in >> 1;
+  return p * detail::pow2(in1) * detail::pow2(in - in1);
+}
+
+/*!
+ * \brief Vectorizable log.
+ *
+ * Writes x = m*2^e with m in [sqrt(1/2), sqrt(2)) and evaluates
+ * log(m) = 2*atanh(f/(2+f)), f = m-1, by its odd series to degree 21.
+ */
+inline double log(double x)
+{
+  const double ln2_hi = 6.93147180369123816490e-01;
+  const double ln2_lo = 1.90821492927058770002e-10;
+  const int64_t sqrt_half_bits = 0x3fe6a09e667f3bcdLL; // sqrt(1/2)
+
+  // shift so the exponent rounds m to [sqrt(1/2), sqrt(2))
+  const int64_t ix = detail::asInt(x) - sqrt_half_bits;
+  const int64_t e = (ix >> 52);
+  const double m = detail::asDouble(detail::asInt(x) - (e << 52));
+
+  const double f = m - 1.0;
+  const double s = f / (2.0 + f);
+  const double s2 = s * s;
+
+  double p = 2.0 / 21.0;
+  p = p * s2 + 2.0 / 19.0;
+  p = p * s2 + 2.0 / 17.0;
+  p = p * s2 + 2.0 / 15.0;
+  p = p * s2 + 2.0 / 13.0;
+  p = p * s2 + 2.0 / 11.0;
+  p = p * s2 + 2.0 / 9.0;
+  p = p * s2 + 2.0 / 7.0;
+  p = p * s2 + 2.0 / 5.0;
+  p = p * s2 + 2.0 / 3.0;
+  p = p * s2;
+
+  // log(m) = 2s + s*p = f - s*(f - p)
+  const double hfsq = 0.5 * f * f;
+  const double de = indexToDouble(e);
+  const double log_m_lo = s * (hfsq + p) + de * ln2_lo;
+
+  return de * ln2_hi + (f - (hfsq - log_m_lo));
+}
+
+/*!
+ * \brief Vectorizable sqrt.
+ *
+ * Refines an initial estimate of 1/sqrt(x) from its bit pattern by Newton
+ * iterations, then corrects sqrt(x) = x/sqrt(x) with one more step.
+ */
+inline double sqrt(double x)
+{
+  const double y0 = detail::asDouble(0x5fe6eb50c7b537a9LL - (detail::asInt(x) >> 1));
+
+  double y = y0;
+  y = y * (1.5 - 0.5 * x * y * y);
+  y = y * (1.5 - 0.5 * x * y * y);
+  y = y * (1.5 - 0.5 * x * y * y);
+  y = y * (1.5 - 0.5 * x * y * y);
+
+  const double s = x * y;
+  return s + 0.5 * y * (x - s * s);
+}
+
+/*!
+ * \brief Return a if x >= 0 and b otherwise.
+ *
+ * The test is done on the bits of x, so loops using it in place of a
+ * branch on x vectorize. The result for x nan is not specified.
+ */
+inline double selectNonNegative(double x, double a, double b)
+{
+  // negative doubles other than -0 order above -0 as unsigned integers
+  const uint64_t neg_zero_bits = 0x8000000000000000ULL;
+  const uint64_t mask = -static_cast<uint64_t>(
+      static_cast<uint64_t>(detail::asInt(x)) <= neg_zero_bits);
+  const uint64_t bits =
+      (static_cast<uint64_t>(detail::asInt(a)) & mask) |
+      (static_cast<uint64_t>(detail::asInt(b)) & ~mask);
+  return detail::asDouble(static_cast<int64_t>(bits));
+}
+
+}  // closing brace for vecmath namespace
+
+#if defined(RAJA_PERFSUITE_ENABLE_LIBMVEC)
+namespace libmvec
+{
+
+/*!
+ * \brief exp from libmvec when called in a loop under '#pragma omp simd'.
+ */
+inline double exp(double x)
+{
+  return rajaperf_libmvec_exp(x);
+}
+
+/*!
+ * \brief log from libmvec when called in a loop under '#pragma omp simd'.
+ */
+inline double log(double x)
+{
+  return rajaperf_libmvec_log(x);
+}
+
+}  // closing brace for libmvec namespace
+#endif
+
+/*!
+ * \brief Helpers naming the math functions and tuning of each vector math
+ *        tuning.
+ */
+struct vecmath_helper
+{
+  static double exp(double x) { return vecmath::exp(x); }
+  static double log(double x) { return vecmath::log(x); }
+  static double sqrt(double x) { return vecmath::sqrt(x); }
+  static std::string get_name() { return "vecmath"; }
+};
+
+#if defined(RAJA_PERFSUITE_ENABLE_LIBMVEC)
+struct libmvec_helper
+{
+  static double exp(double x) { return libmvec::exp(x); }
+  static double log(double x) { return libmvec::log(x); }
+  static std::string get_name() { return "libmvec"; }
+};
+#endif
+
+/*!
+ * \brief Math helpers providing exp and log, used with seq_for to generate
+ *        vector math tunings. libmvec has no sqrt, so kernels using sqrt
+ *        use vecmath_helper alone.
+ */
+using vecmath_helpers = camp::list<
+    vecmath_helper
+#if defined(RAJA_PERFSUITE_ENABLE_LIBMVEC)
+  , libmvec_helper
+#endif
+    >;
+
+}  // closing brace for rajaperf namespace
+
+#endif  // RAJAPERF_USE_VECMATH
+
+#endif  // closing endif for header file include guard
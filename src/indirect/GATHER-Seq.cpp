@@ -0,0 +1,250 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GATHER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "IndirectData.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace indirect
+{
+
+
+void GATHER::runSeqVariantDefault(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  GATHER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          GATHER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          GATHER_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  GATHER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+#if defined(RAJAPERF_INDIRECT_USE_AVX512)
+void GATHER::runSeqVariantAVX512(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  GATHER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        gatherAVX512(y, x, idx, ibegin, iend);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GATHER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+#endif
+
+void GATHER::runSeqVariantPrefetch(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  GATHER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        const Index_type pend = std::max(ibegin, iend - indirect_prefetch_distance);
+        for (Index_type i = ibegin; i < pend; ++i ) {
+          GATHER_PREFETCH;
+          GATHER_BODY;
+        }
+        for (Index_type i = pend; i < iend; ++i ) {
+          GATHER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GATHER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void GATHER::runSeqVariantSortedIndices(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  GATHER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      Index_ptr pos;
+      Index_ptr sorted_idx;
+      allocData(pos, iend - ibegin, vid);
+      allocData(sorted_idx, iend - ibegin, vid);
+
+      sortIndexPositions(pos, idx, iend - ibegin);
+      for (Index_type k = 0; k < iend - ibegin; ++k) {
+        sorted_idx[k] = idx[pos[k]];
+      }
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 0; k < iend - ibegin; ++k ) {
+          GATHER_SORTED_BODY;
+        }
+
+      }
+      stopTimer();
+
+      deallocData(pos, vid);
+      deallocData(sorted_idx, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GATHER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void GATHER::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+#if defined(RAJAPERF_INDIRECT_USE_AVX512)
+    if (tune_idx == t) {
+      runSeqVariantAVX512(vid);
+    }
+
+    t += 1;
+#endif
+
+    if (tune_idx == t) {
+      runSeqVariantPrefetch(vid);
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+      runSeqVariantSortedIndices(vid);
+    }
+
+    t += 1;
+
+  }
+}
+
+void GATHER::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+#if defined(RAJAPERF_INDIRECT_USE_AVX512)
+    addVariantTuningName(vid, "avx512");
+#endif
+
+    addVariantTuningName(vid, "prefetch");
+
+    addVariantTuningName(vid, "sorted_indices");
+    // reads the positions as well as the sorted indices
+    setVariantTuningBytesPerRep(vid, getNumVariantTunings(vid) - 1,
+        getBytesPerRep() + 1*sizeof(Index_type) * getActualProblemSize());
+
+  }
+}
+
+} // end namespace indirect
+} // end namespace rajaperf
@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GATHER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+#include "IndirectData.hpp"
+
+namespace rajaperf
+{
+namespace indirect
+{
+
+
+GATHER::GATHER(const RunParams& params)
+  : KernelBase(rajaperf::Indirect_GATHER, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_pattern = params.getIndirectIndexPattern();
+  m_stride = (params.getIndirectIndexStride() > 0) ? params.getIndirectIndexStride()
+                                                   : indirect_default_stride;
+  m_indexed_len = getIndexedLength(m_pattern, getActualProblemSize());
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * getActualProblemSize() +
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * getActualProblemSize() +
+                  (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+GATHER::~GATHER()
+{
+}
+
+void GATHER::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = getActualProblemSize();
+
+  allocAndInitData(m_x, m_indexed_len, vid);
+  allocAndInitDataConst(m_y, len, 0.0, vid);
+  allocData(m_idx, len, vid);
+
+  setIndexPattern(m_idx, len, m_pattern, m_stride, 4793);
+}
+
+void GATHER::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, getActualProblemSize(), vid);
+}
+
+void GATHER::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+  deallocData(m_idx, vid);
+}
+
+} // end namespace indirect
+} // end namespace rajaperf
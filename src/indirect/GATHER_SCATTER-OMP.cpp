@@ -0,0 +1,289 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GATHER_SCATTER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "IndirectData.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace indirect
+{
+
+
+void GATHER_SCATTER::runOpenMPVariantDefault(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  GATHER_SCATTER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          GATHER_SCATTER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          GATHER_SCATTER_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GATHER_SCATTER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+#if defined(RAJAPERF_INDIRECT_USE_AVX512)
+void GATHER_SCATTER::runOpenMPVariantAVX512(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  GATHER_SCATTER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const Index_type nthreads = omp_get_num_threads();
+          const Index_type tid = omp_get_thread_num();
+          const Index_type len = iend - ibegin;
+          const Index_type cbegin = ibegin + (len * tid) / nthreads;
+          const Index_type cend = ibegin + (len * (tid + 1)) / nthreads;
+
+          gatherScatterAVX512(y, out_idx, x, in_idx, cbegin, cend);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GATHER_SCATTER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+#endif
+
+void GATHER_SCATTER::runOpenMPVariantPrefetch(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  GATHER_SCATTER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const Index_type nthreads = omp_get_num_threads();
+          const Index_type tid = omp_get_thread_num();
+          const Index_type len = iend - ibegin;
+          const Index_type cbegin = ibegin + (len * tid) / nthreads;
+          const Index_type cend = ibegin + (len * (tid + 1)) / nthreads;
+
+          const Index_type pend = std::max(cbegin, cend - indirect_prefetch_distance);
+          for (Index_type i = cbegin; i < pend; ++i ) {
+            GATHER_SCATTER_PREFETCH;
+            GATHER_SCATTER_BODY;
+          }
+          for (Index_type i = pend; i < cend; ++i ) {
+            GATHER_SCATTER_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GATHER_SCATTER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void GATHER_SCATTER::runOpenMPVariantSortedIndices(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  GATHER_SCATTER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      Index_ptr pos;
+      Index_ptr sorted_in_idx;
+      Index_ptr sorted_out_idx;
+      allocData(pos, iend - ibegin, vid);
+      allocData(sorted_in_idx, iend - ibegin, vid);
+      allocData(sorted_out_idx, iend - ibegin, vid);
+
+      sortIndexPositions(pos, out_idx, iend - ibegin);
+      for (Index_type k = 0; k < iend - ibegin; ++k) {
+        sorted_in_idx[k] = in_idx[pos[k]];
+        sorted_out_idx[k] = out_idx[pos[k]];
+      }
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type k = 0; k < iend - ibegin; ++k ) {
+          GATHER_SCATTER_SORTED_BODY;
+        }
+
+      }
+      stopTimer();
+
+      deallocData(pos, vid);
+      deallocData(sorted_in_idx, vid);
+      deallocData(sorted_out_idx, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GATHER_SCATTER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void GATHER_SCATTER::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+#if defined(RAJAPERF_INDIRECT_USE_AVX512)
+    if (tune_idx == t) {
+      runOpenMPVariantAVX512(vid);
+    }
+
+    t += 1;
+#endif
+
+    if (tune_idx == t) {
+      runOpenMPVariantPrefetch(vid);
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+      runOpenMPVariantSortedIndices(vid);
+    }
+
+    t += 1;
+
+  }
+}
+
+void GATHER_SCATTER::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+#if defined(RAJAPERF_INDIRECT_USE_AVX512)
+    addVariantTuningName(vid, "avx512");
+#endif
+
+    addVariantTuningName(vid, "prefetch");
+
+    addVariantTuningName(vid, "sorted_indices");
+
+  }
+}
+
+} // end namespace indirect
+} // end namespace rajaperf
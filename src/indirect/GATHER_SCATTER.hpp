@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// GATHER_SCATTER kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   y[out_idx[i]] = x[in_idx[i]];
+/// }
+///
+/// in_idx and out_idx follow the pattern set by --indirect_index_pattern
+/// (see indirect/IndirectData.hpp), generated with different seeds, and x
+/// and y have as many elements as the pattern indexes.
+///
+/// Tunings of the Base variants,
+///
+///   default         the loop above
+///   avx512          AVX-512 gather and scatter intrinsics, 8 elements at a time,
+///                   only on AVX-512 targets with double Real_type
+///   prefetch        software prefetch of the indirectly accessed elements
+///                   indirect_prefetch_distance iterations ahead
+///   sorted_indices  visits i in increasing order of out_idx[i], sorted
+///                   before timing, so the writes of y are in increasing
+///                   order; it reads two sorted index arrays in place of
+///                   in_idx and out_idx, so moves the same bytes per rep
+///
+
+#ifndef RAJAPerf_Indirect_GATHER_SCATTER_HPP
+#define RAJAPerf_Indirect_GATHER_SCATTER_HPP
+
+#define GATHER_SCATTER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Index_ptr in_idx = m_in_idx; \
+  Index_ptr out_idx = m_out_idx;
+
+#define GATHER_SCATTER_BODY \
+  y[out_idx[i]] = x[in_idx[i]];
+
+#define GATHER_SCATTER_PREFETCH \
+  RAJAPERF_INDIRECT_PREFETCH(&x[in_idx[i + indirect_prefetch_distance]], 0); \
+  RAJAPERF_INDIRECT_PREFETCH(&y[out_idx[i + indirect_prefetch_distance]], 1);
+
+#define GATHER_SCATTER_SORTED_BODY \
+  y[sorted_out_idx[k]] = x[sorted_in_idx[k]];
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace indirect
+{
+
+class GATHER_SCATTER : public KernelBase
+{
+public:
+
+  GATHER_SCATTER(const RunParams& params);
+
+  ~GATHER_SCATTER();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GATHER_SCATTER : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GATHER_SCATTER : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GATHER_SCATTER : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantAVX512(VariantID vid);
+  void runSeqVariantPrefetch(VariantID vid);
+  void runSeqVariantSortedIndices(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantAVX512(VariantID vid);
+  void runOpenMPVariantPrefetch(VariantID vid);
+  void runOpenMPVariantSortedIndices(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  std::string m_pattern;
+  Index_type m_stride;
+  Index_type m_indexed_len;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Index_ptr m_in_idx;
+  Index_ptr m_out_idx;
+};
+
+} // end namespace indirect
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,120 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "IndirectData.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+namespace rajaperf
+{
+namespace indirect
+{
+
+namespace
+{
+
+//
+// Random index in [0, n), for n larger than RAND_MAX too.
+//
+Index_type randomIndex(Index_type n)
+{
+  const Real_type u = static_cast<Real_type>(rand()) / (RAND_MAX + 1.0);
+  return std::min(static_cast<Index_type>(u * n), n - 1);
+}
+
+void shuffle(Index_ptr vals, Index_type n)
+{
+  for (Index_type k = n - 1; k > 0; --k) {
+    std::swap(vals[k], vals[randomIndex(k + 1)]);
+  }
+}
+
+} // end anonymous namespace
+
+
+Index_type getIndexedLength(const std::string& pattern, Index_type len)
+{
+  return (pattern == "sorted_random") ? 2 * len : len;
+}
+
+void setIndexPattern(Index_ptr idx, Index_type len,
+                     const std::string& pattern, Index_type stride,
+                     unsigned seed)
+{
+  srand(seed);
+
+  if ( pattern == "stride" ) {
+
+    Index_type i = 0;
+    for (Index_type r = 0; r < std::min(stride, len); ++r) {
+      for (Index_type j = r; j < len; j += stride) {
+        idx[i++] = j;
+      }
+    }
+
+  } else if ( pattern == "blocked_random" ) {
+
+    const Index_type num_blocks = (len + stride - 1) / stride;
+    std::vector<Index_type> blocks(num_blocks);
+    for (Index_type b = 0; b < num_blocks; ++b) {
+      blocks[b] = b;
+    }
+    shuffle(blocks.data(), num_blocks);
+
+    Index_type i = 0;
+    for (Index_type b = 0; b < num_blocks; ++b) {
+      const Index_type jbegin = blocks[b] * stride;
+      const Index_type jend = std::min(jbegin + stride, len);
+      for (Index_type j = jbegin; j < jend; ++j) {
+        idx[i++] = j;
+      }
+    }
+
+  } else if ( pattern == "random" ) {
+
+    for (Index_type i = 0; i < len; ++i) {
+      idx[i] = i;
+    }
+    shuffle(idx, len);
+
+  } else if ( pattern == "sorted_random" ) {
+
+    // selection sampling picks each of the indexed_len indices with equal
+    // probability, in increasing order
+    const Index_type indexed_len = getIndexedLength(pattern, len);
+    Index_type i = 0;
+    for (Index_type j = 0; j < indexed_len && i < len; ++j) {
+      if (randomIndex(indexed_len - j) < len - i) {
+        idx[i++] = j;
+      }
+    }
+
+  } else {
+
+    for (Index_type i = 0; i < len; ++i) {
+      idx[i] = i;
+    }
+
+  }
+}
+
+void sortIndexPositions(Index_ptr pos, Index_ptr idx, Index_type len)
+{
+  for (Index_type k = 0; k < len; ++k) {
+    pos[k] = k;
+  }
+  std::sort(pos, pos + len, [=](Index_type a, Index_type b) {
+    return idx[a] < idx[b];
+  });
+}
+
+} // end namespace indirect
+} // end namespace rajaperf
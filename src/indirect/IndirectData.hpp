@@ -0,0 +1,147 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Index arrays and helpers shared by the Indirect kernels.
+///
+/// Index arrays hold len distinct indices into an indexed array, in the
+/// pattern set by the --indirect_index_pattern option,
+///
+///   identity        idx[i] = i
+///   stride          0, s, 2s, ..., then 1, 1+s, 1+2s, ..., where s is set
+///                   by the --indirect_index_stride option
+///   blocked_random  blocks of s consecutive indices, in random order
+///   random          a random permutation
+///   sorted_random   len indices chosen at random from twice as many, in
+///                   increasing order, so the indexed array has 2*len
+///                   elements
+///
+/// The indices are distinct, so the scatter kernels have no conflicting
+/// writes.
+///
+
+#ifndef RAJAPerf_IndirectData_HPP
+#define RAJAPerf_IndirectData_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <string>
+
+#if defined(__AVX512F__) && defined(RP_USE_DOUBLE)
+#include <immintrin.h>
+#define RAJAPERF_INDIRECT_USE_AVX512
+#endif
+
+#if defined(__GNUC__)
+#define RAJAPERF_INDIRECT_PREFETCH(addr, rw) __builtin_prefetch((addr), (rw))
+#else
+#define RAJAPERF_INDIRECT_PREFETCH(addr, rw)
+#endif
+
+namespace rajaperf
+{
+namespace indirect
+{
+
+/*!
+ * \brief Number of iterations ahead that the prefetch tunings prefetch.
+ */
+const Index_type indirect_prefetch_distance = 16;
+
+/*!
+ * \brief Default of --indirect_index_stride.
+ */
+const Index_type indirect_default_stride = 8;
+
+/*!
+ * \brief Length of the array indexed by len indices in the given pattern.
+ */
+Index_type getIndexedLength(const std::string& pattern, Index_type len);
+
+/*!
+ * \brief Set idx[i], i in [0, len), to distinct indices in the given
+ *        pattern. Random patterns are generated from seed.
+ */
+void setIndexPattern(Index_ptr idx, Index_type len,
+                     const std::string& pattern, Index_type stride,
+                     unsigned seed);
+
+/*!
+ * \brief Set pos to the positions i in [0, len) ordered by idx[i], so
+ *        idx[pos[k]] increases with k.
+ */
+void sortIndexPositions(Index_ptr pos, Index_ptr idx, Index_type len);
+
+/*!
+ * \brief y[i] = x[idx[i]] for i in [ibegin, iend), 8 elements at a time
+ *        with AVX-512 gathers when the target has them.
+ */
+inline void gatherAVX512(Real_ptr y, Real_ptr x, Index_ptr idx,
+                         Index_type ibegin, Index_type iend)
+{
+  Index_type i = ibegin;
+#if defined(RAJAPERF_INDIRECT_USE_AVX512)
+  static_assert(sizeof(Index_type) == 8, "64 bit indices required");
+  for ( ; i + 8 <= iend; i += 8) {
+    const __m512i vidx = _mm512_loadu_si512(idx + i);
+    _mm512_storeu_pd(y + i, _mm512_i64gather_pd(vidx, x, sizeof(Real_type)));
+  }
+#endif
+  for ( ; i < iend; ++i) {
+    y[i] = x[idx[i]];
+  }
+}
+
+/*!
+ * \brief y[idx[i]] = x[i] for i in [ibegin, iend), 8 elements at a time
+ *        with AVX-512 scatters when the target has them.
+ */
+inline void scatterAVX512(Real_ptr y, Index_ptr idx, Real_ptr x,
+                          Index_type ibegin, Index_type iend)
+{
+  Index_type i = ibegin;
+#if defined(RAJAPERF_INDIRECT_USE_AVX512)
+  static_assert(sizeof(Index_type) == 8, "64 bit indices required");
+  for ( ; i + 8 <= iend; i += 8) {
+    const __m512i vidx = _mm512_loadu_si512(idx + i);
+    _mm512_i64scatter_pd(y, vidx, _mm512_loadu_pd(x + i), sizeof(Real_type));
+  }
+#endif
+  for ( ; i < iend; ++i) {
+    y[idx[i]] = x[i];
+  }
+}
+
+/*!
+ * \brief y[out_idx[i]] = x[in_idx[i]] for i in [ibegin, iend), 8 elements
+ *        at a time with AVX-512 gathers and scatters when the target has
+ *        them.
+ */
+inline void gatherScatterAVX512(Real_ptr y, Index_ptr out_idx,
+                                Real_ptr x, Index_ptr in_idx,
+                                Index_type ibegin, Index_type iend)
+{
+  Index_type i = ibegin;
+#if defined(RAJAPERF_INDIRECT_USE_AVX512)
+  static_assert(sizeof(Index_type) == 8, "64 bit indices required");
+  for ( ; i + 8 <= iend; i += 8) {
+    const __m512i vin = _mm512_loadu_si512(in_idx + i);
+    const __m512i vout = _mm512_loadu_si512(out_idx + i);
+    _mm512_i64scatter_pd(y, vout, _mm512_i64gather_pd(vin, x, sizeof(Real_type)),
+                         sizeof(Real_type));
+  }
+#endif
+  for ( ; i < iend; ++i) {
+    y[out_idx[i]] = x[in_idx[i]];
+  }
+}
+
+} // end namespace indirect
+} // end namespace rajaperf
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SCATTER kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   y[idx[i]] = x[i];
+/// }
+///
+/// idx follows the pattern set by --indirect_index_pattern (see
+/// indirect/IndirectData.hpp), and y has as many elements as the pattern
+/// indexes. The indices are distinct, so no two iterations write the same
+/// element of y.
+///
+/// Tunings of the Base variants,
+///
+///   default         the loop above
+///   avx512          AVX-512 scatter intrinsics, 8 elements at a time,
+///                   only on AVX-512 targets with double Real_type
+///   prefetch        software prefetch of the indirectly accessed elements
+///                   indirect_prefetch_distance iterations ahead
+///   sorted_indices  visits i in increasing order of idx[i], sorted before
+///                   timing, so the writes of y are in increasing order and
+///                   the reads of x are indirect; it also reads the array
+///                   of original positions, counted in its bytes per rep
+///
+
+#ifndef RAJAPerf_Indirect_SCATTER_HPP
+#define RAJAPerf_Indirect_SCATTER_HPP
+
+#define SCATTER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Index_ptr idx = m_idx;
+
+#define SCATTER_BODY \
+  y[idx[i]] = x[i];
+
+#define SCATTER_PREFETCH \
+  RAJAPERF_INDIRECT_PREFETCH(&y[idx[i + indirect_prefetch_distance]], 1);
+
+#define SCATTER_SORTED_BODY \
+  y[sorted_idx[k]] = x[pos[k]];
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace indirect
+{
+
+class SCATTER : public KernelBase
+{
+public:
+
+  SCATTER(const RunParams& params);
+
+  ~SCATTER();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SCATTER : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SCATTER : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SCATTER : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantAVX512(VariantID vid);
+  void runSeqVariantPrefetch(VariantID vid);
+  void runSeqVariantSortedIndices(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantAVX512(VariantID vid);
+  void runOpenMPVariantPrefetch(VariantID vid);
+  void runOpenMPVariantSortedIndices(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  std::string m_pattern;
+  Index_type m_stride;
+  Index_type m_indexed_len;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Index_ptr m_idx;
+};
+
+} // end namespace indirect
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
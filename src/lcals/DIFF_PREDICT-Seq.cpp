@@ -10,7 +10,11 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/LayoutUtils.hpp"
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +22,7 @@ namespace lcals
 {
 
 
-void DIFF_PREDICT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DIFF_PREDICT::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -88,5 +92,147 @@ void DIFF_PREDICT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+template < typename precision_helper >
+void DIFF_PREDICT::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+  // the body macros declare their scalars as Real_type
+  using Real_type = compute_type;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  storage_type* px;
+  storage_type* cx;
+  allocAndConvertData(px, m_px, m_array_length, vid);
+  allocAndConvertData(cx, m_cx, m_array_length, vid);
+
+  const Index_type offset = m_offset;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DIFF_PREDICT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DIFF_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_px, px, m_array_length);
+
+  deallocData(px, vid);
+  deallocData(cx, vid);
+}
+
+template < typename layout_helper >
+void DIFF_PREDICT::runSeqVariantLayout(VariantID vid)
+{
+  using view_type = typename layout_helper::template view_type<Real_type>;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  const Index_type num_comps = m_array_length / m_offset;
+  std::vector<Real_ptr> px_comps = getComponents(m_px, num_comps, m_offset);
+  std::vector<Real_ptr> cx_comps = getComponents(m_cx, num_comps, m_offset);
+
+  Real_ptr px_data;
+  Real_ptr cx_data;
+  allocData(px_data, view_type::storageSize(num_comps, m_offset), vid);
+  allocData(cx_data, view_type::storageSize(num_comps, m_offset), vid);
+  view_type pxv(px_data, num_comps, m_offset);
+  view_type cxv(cx_data, num_comps, m_offset);
+  copyToLayout(pxv, px_comps, m_offset);
+  copyToLayout(cxv, cx_comps, m_offset);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DIFF_PREDICT_BODY_LAYOUT;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DIFF_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  copyFromLayout(px_comps, pxv, m_offset);
+
+  deallocData(px_data, vid);
+  deallocData(cx_data, vid);
+}
+
+void DIFF_PREDICT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    runPrecisionTunings(tune_idx, t, [&](auto precision_helper) {
+      runSeqVariantPrecision<decltype(precision_helper)>(vid);
+    });
+
+    seq_for(layout_helpers{}, [&](auto layout_helper) {
+      if (tune_idx == t) {
+        runSeqVariantLayout<decltype(layout_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void DIFF_PREDICT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    addPrecisionTuningDefinitions(*this, vid);
+
+    seq_for(layout_helpers{}, [&](auto layout_helper) {
+      addVariantTuningName(vid, decltype(layout_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
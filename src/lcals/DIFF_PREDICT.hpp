@@ -66,6 +66,29 @@
   px[i + offset * 13] = cr - px[i + offset * 12]; \
   px[i + offset * 12] = cr;
 
+#define DIFF_PREDICT_BODY_LAYOUT  \
+  Real_type ar, br, cr; \
+\
+  ar         = cxv(4, i);       \
+  br         = ar - pxv(4, i);  \
+  pxv(4, i)  = ar;              \
+  cr         = br - pxv(5, i);  \
+  pxv(5, i)  = br;              \
+  ar         = cr - pxv(6, i);  \
+  pxv(6, i)  = cr;              \
+  br         = ar - pxv(7, i);  \
+  pxv(7, i)  = ar;              \
+  cr         = br - pxv(8, i);  \
+  pxv(8, i)  = br;              \
+  ar         = cr - pxv(9, i);  \
+  pxv(9, i)  = cr;              \
+  br         = ar - pxv(10, i); \
+  pxv(10, i) = ar;              \
+  cr         = br - pxv(11, i); \
+  pxv(11, i) = br;              \
+  pxv(13, i) = cr - pxv(12, i); \
+  pxv(12, i) = cr;
+
 
 #include "common/KernelBase.hpp"
 
@@ -95,6 +118,19 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename precision_helper >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename precision_helper >
+  void runOpenMPVariantPrecision(VariantID vid);
+  template < typename layout_helper >
+  void runSeqVariantLayout(VariantID vid);
+  template < typename layout_helper >
+  void runOpenMPVariantLayout(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
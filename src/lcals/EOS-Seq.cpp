@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace lcals
 {
 
 
-void EOS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void EOS::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -88,5 +90,61 @@ void EOS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+template < typename precision_helper >
+void EOS::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  storage_type* x;
+  storage_type* y;
+  storage_type* z;
+  storage_type* u;
+  allocAndConvertData(x, m_x, m_array_length, vid);
+  allocAndConvertData(y, m_y, m_array_length, vid);
+  allocAndConvertData(z, m_z, m_array_length, vid);
+  allocAndConvertData(u, m_u, m_array_length, vid);
+
+  const compute_type q = m_q;
+  const compute_type r = m_r;
+  const compute_type t = m_t;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          EOS_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  EOS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_x, x, m_array_length);
+
+  deallocData(x, vid);
+  deallocData(y, vid);
+  deallocData(z, vid);
+  deallocData(u, vid);
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(EOS, Seq, Base_Seq)
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace lcals
 {
 
 
-void FIRST_DIFF::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_DIFF::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -88,5 +90,50 @@ void FIRST_DIFF::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
 
 }
 
+template < typename precision_helper >
+void FIRST_DIFF::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  storage_type* x;
+  storage_type* y;
+  allocAndConvertData(x, m_x, m_N, vid);
+  allocAndConvertData(y, m_y, m_N, vid);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FIRST_DIFF_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_DIFF : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_x, x, m_N);
+
+  deallocData(x, vid);
+  deallocData(y, vid);
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(FIRST_DIFF, Seq, Base_Seq)
+
 } // end namespace lcals
 } // end namespace rajaperf
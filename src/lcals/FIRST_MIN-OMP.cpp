@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace lcals
 {
 
 
-void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_MIN::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -117,5 +119,60 @@ void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+template < typename precision_helper >
+void FIRST_MIN::runOpenMPVariantPrecision(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  using storage_type = typename precision_helper::storage_type;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  storage_type* x;
+  allocAndConvertData(x, m_x, m_N, vid);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp declare reduction(minloc : MyMinLoc : \
+                                      omp_out = MinLoc_compare(omp_out, omp_in)) \
+                                      initializer (omp_priv = omp_orig)
+
+        FIRST_MIN_MINLOC_INIT;
+
+        #pragma omp parallel for reduction(minloc:mymin)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FIRST_MIN_BODY;
+        }
+
+        m_minloc = mymin.loc;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  deallocData(x, vid);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(FIRST_MIN, OpenMP, Base_OpenMP)
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace lcals
 {
 
 
-void FIRST_MIN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_MIN::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -104,5 +106,49 @@ void FIRST_MIN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+template < typename precision_helper >
+void FIRST_MIN::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  storage_type* x;
+  allocAndConvertData(x, m_x, m_N, vid);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        FIRST_MIN_MINLOC_INIT;
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FIRST_MIN_BODY;
+        }
+
+        m_minloc = mymin.loc;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  deallocData(x, vid);
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(FIRST_MIN, Seq, Base_Seq)
+
 } // end namespace lcals
 } // end namespace rajaperf
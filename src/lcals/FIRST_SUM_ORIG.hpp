@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// FIRST_SUM_ORIG kernel reference implementation:
+///
+/// Note: original form of FIRST_SUM with the loop-carried dependence on
+///       'x[i-1]', which is a prefix sum.
+///
+/// for (Index_type i = 1; i < N; ++i ) {
+///   x[i] = x[i-1] + y[i];
+/// }
+///
+/// Base_OpenMP tunings run the recurrence as a scan of the affine maps
+/// x -> x + y[i], see common/RecurrenceUtils.hpp.
+///
+
+#ifndef RAJAPerf_Lcals_FIRST_SUM_ORIG_HPP
+#define RAJAPerf_Lcals_FIRST_SUM_ORIG_HPP
+
+
+#define FIRST_SUM_ORIG_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y;
+
+#define FIRST_SUM_ORIG_BODY  \
+  x[i] = x[i-1] + y[i];
+
+#define FIRST_SUM_ORIG_MAP  \
+  AffineMap{ 1.0, y[i] }
+
+#define FIRST_SUM_ORIG_STEP  \
+  x[i] = x_prev + y[i];
+
+#define RAJA_FIRST_SUM_ORIG_SCAN_ARGS \
+  RAJA::make_span(y + ibegin, iend - ibegin), \
+  RAJA::make_span(x + ibegin, iend - ibegin)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class FIRST_SUM_ORIG : public KernelBase
+{
+public:
+
+  FIRST_SUM_ORIG(const RunParams& params);
+
+  ~FIRST_SUM_ORIG();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FIRST_SUM_ORIG : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FIRST_SUM_ORIG : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FIRST_SUM_ORIG : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantScan(VariantID vid);
+  void runOpenMPVariantRecursiveDoubling(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+
+  Index_type m_N;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
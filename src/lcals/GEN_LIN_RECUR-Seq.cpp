@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace lcals
 {
 
 
-void GEN_LIN_RECUR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void GEN_LIN_RECUR::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -100,5 +102,61 @@ void GEN_LIN_RECUR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+template < typename precision_helper >
+void GEN_LIN_RECUR::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+
+  const Index_type run_reps = getRunReps();
+
+  storage_type* b5;
+  storage_type* sa;
+  storage_type* sb;
+  storage_type* stb5;
+  allocAndConvertData(b5, m_b5, m_N, vid);
+  allocAndConvertData(sa, m_sa, m_N, vid);
+  allocAndConvertData(sb, m_sb, m_N, vid);
+  allocAndConvertData(stb5, m_stb5, m_N, vid);
+
+  Index_type kb5i = m_kb5i;
+  Index_type N = m_N;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 0; k < N; ++k ) {
+          GEN_LIN_RECUR_BODY1;
+        }
+
+        for (Index_type i = 1; i < N+1; ++i ) {
+          GEN_LIN_RECUR_BODY2;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GEN_LIN_RECUR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_b5, b5, m_N);
+
+  deallocData(b5, vid);
+  deallocData(sa, vid);
+  deallocData(sb, vid);
+  deallocData(stb5, vid);
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(GEN_LIN_RECUR, Seq, Base_Seq)
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -0,0 +1,184 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GEN_LIN_RECUR_ORIG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/RecurrenceUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+//
+// Scan the block maps of one block per thread.
+//
+void GEN_LIN_RECUR_ORIG::runOpenMPVariantScan(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  GEN_LIN_RECUR_ORIG_DATA_SETUP;
+
+  auto genlinrecurorig_map_lam1 = [=](Index_type k) {
+                                    return GEN_LIN_RECUR_ORIG_MAP;
+                                  };
+  auto genlinrecurorig_step_lam1 = [=](Index_type k, Real_type stb5) {
+                                     GEN_LIN_RECUR_ORIG_BODY1;
+                                     return stb5;
+                                   };
+  auto genlinrecurorig_map_lam2 = [=](Index_type i) {
+                                    Index_type k = N - i ;
+                                    return GEN_LIN_RECUR_ORIG_MAP;
+                                  };
+  auto genlinrecurorig_step_lam2 = [=](Index_type i, Real_type stb5) {
+                                     GEN_LIN_RECUR_ORIG_BODY2;
+                                     return stb5;
+                                   };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      std::vector<AffineMap> thread_maps(omp_get_max_threads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        GEN_LIN_RECUR_ORIG_PROLOGUE;
+
+        stb5 = affineRecurrenceScan(0, N, stb5,
+                                    genlinrecurorig_map_lam1, genlinrecurorig_step_lam1,
+                                    thread_maps);
+
+        stb5 = affineRecurrenceScan(1, N+1, stb5,
+                                    genlinrecurorig_map_lam2, genlinrecurorig_step_lam2,
+                                    thread_maps);
+
+        GEN_LIN_RECUR_ORIG_EPILOGUE;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GEN_LIN_RECUR_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Scan the block maps of fixed size blocks by recursive doubling.
+//
+void GEN_LIN_RECUR_ORIG::runOpenMPVariantRecursiveDoubling(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  GEN_LIN_RECUR_ORIG_DATA_SETUP;
+
+  auto genlinrecurorig_map_lam1 = [=](Index_type k) {
+                                    return GEN_LIN_RECUR_ORIG_MAP;
+                                  };
+  auto genlinrecurorig_step_lam1 = [=](Index_type k, Real_type stb5) {
+                                     GEN_LIN_RECUR_ORIG_BODY1;
+                                     return stb5;
+                                   };
+  auto genlinrecurorig_map_lam2 = [=](Index_type i) {
+                                    Index_type k = N - i ;
+                                    return GEN_LIN_RECUR_ORIG_MAP;
+                                  };
+  auto genlinrecurorig_step_lam2 = [=](Index_type i, Real_type stb5) {
+                                     GEN_LIN_RECUR_ORIG_BODY2;
+                                     return stb5;
+                                   };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type nblocks =
+          (N + recurrence_block_size - 1) / recurrence_block_size;
+      std::vector<AffineMap> block_maps(nblocks);
+      std::vector<AffineMap> block_maps_tmp(nblocks);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        GEN_LIN_RECUR_ORIG_PROLOGUE;
+
+        stb5 = affineRecurrenceRecursiveDoubling(0, N, stb5,
+                                                 genlinrecurorig_map_lam1, genlinrecurorig_step_lam1,
+                                                 block_maps, block_maps_tmp);
+
+        stb5 = affineRecurrenceRecursiveDoubling(1, N+1, stb5,
+                                                 genlinrecurorig_map_lam2, genlinrecurorig_step_lam2,
+                                                 block_maps, block_maps_tmp);
+
+        GEN_LIN_RECUR_ORIG_EPILOGUE;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GEN_LIN_RECUR_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void GEN_LIN_RECUR_ORIG::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantScan(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantRecursiveDoubling(vid);
+
+  }
+
+  t += 1;
+}
+
+void GEN_LIN_RECUR_ORIG::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "scan");
+  addVariantTuningName(vid, "recursive_doubling");
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// GEN_LIN_RECUR_ORIG kernel reference implementation:
+///
+/// Note: original form of GEN_LIN_RECUR where stb5 is a scalar carried
+///       from each iteration to the next, first forward and then backward.
+///
+/// Index_type kb5i = 0;
+/// Real_type stb5 = stb5_init;
+///
+/// for (Index_type k = 0; k < N; ++k ) {
+///   b5[k+kb5i] = sa[k] + stb5*sb[k];
+///   stb5 = b5[k+kb5i] - stb5;
+/// }
+///
+/// for (Index_type i = 1; i < N+1; ++i ) {
+///   Index_type k = N - i ;
+///   b5[k+kb5i] = sa[k] + stb5*sb[k];
+///   stb5 = b5[k+kb5i] - stb5;
+/// }
+///
+/// Each iteration updates stb5 by the affine map
+/// stb5 -> (sb[k] - 1)*stb5 + sa[k], so Base_OpenMP tunings run each loop
+/// as a scan of those maps, see common/RecurrenceUtils.hpp.
+///
+
+#ifndef RAJAPerf_Lcals_GEN_LIN_RECUR_ORIG_HPP
+#define RAJAPerf_Lcals_GEN_LIN_RECUR_ORIG_HPP
+
+
+#define GEN_LIN_RECUR_ORIG_DATA_SETUP \
+  Real_ptr b5 = m_b5; \
+  Real_ptr sa = m_sa; \
+  Real_ptr sb = m_sb; \
+\
+  Index_type kb5i = m_kb5i; \
+  Index_type N = m_N;
+
+#define GEN_LIN_RECUR_ORIG_PROLOGUE \
+  Real_type stb5 = m_stb5_init;
+
+#define GEN_LIN_RECUR_ORIG_BODY1  \
+  b5[k+kb5i] = sa[k] + stb5*sb[k]; \
+  stb5 = b5[k+kb5i] - stb5;
+
+#define GEN_LIN_RECUR_ORIG_BODY2  \
+  Index_type k = N - i ; \
+  b5[k+kb5i] = sa[k] + stb5*sb[k]; \
+  stb5 = b5[k+kb5i] - stb5;
+
+#define GEN_LIN_RECUR_ORIG_MAP  \
+  AffineMap{ sb[k] - 1.0, sa[k] }
+
+#define GEN_LIN_RECUR_ORIG_EPILOGUE \
+  m_stb5 = stb5;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class GEN_LIN_RECUR_ORIG : public KernelBase
+{
+public:
+
+  GEN_LIN_RECUR_ORIG(const RunParams& params);
+
+  ~GEN_LIN_RECUR_ORIG();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GEN_LIN_RECUR_ORIG : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GEN_LIN_RECUR_ORIG : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GEN_LIN_RECUR_ORIG : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantScan(VariantID vid);
+  void runOpenMPVariantRecursiveDoubling(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Real_ptr m_b5;
+  Real_ptr m_sa;
+  Real_ptr m_sb;
+  Real_type m_stb5_init;
+  Real_type m_stb5;
+  Index_type m_kb5i;
+
+  Index_type m_N;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
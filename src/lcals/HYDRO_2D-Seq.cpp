@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace lcals
 {
 
 
-void HYDRO_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HYDRO_2D::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type kbeg = 1;
@@ -158,5 +160,101 @@ void HYDRO_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
 }
 
+template < typename precision_helper >
+void HYDRO_2D::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
+  storage_type* zadat;
+  storage_type* zbdat;
+  storage_type* zmdat;
+  storage_type* zpdat;
+  storage_type* zqdat;
+  storage_type* zrdat;
+  storage_type* zudat;
+  storage_type* zvdat;
+  storage_type* zzdat;
+  storage_type* zroutdat;
+  storage_type* zzoutdat;
+  allocAndConvertData(zadat, m_za, m_array_length, vid);
+  allocAndConvertData(zbdat, m_zb, m_array_length, vid);
+  allocAndConvertData(zmdat, m_zm, m_array_length, vid);
+  allocAndConvertData(zpdat, m_zp, m_array_length, vid);
+  allocAndConvertData(zqdat, m_zq, m_array_length, vid);
+  allocAndConvertData(zrdat, m_zr, m_array_length, vid);
+  allocAndConvertData(zudat, m_zu, m_array_length, vid);
+  allocAndConvertData(zvdat, m_zv, m_array_length, vid);
+  allocAndConvertData(zzdat, m_zz, m_array_length, vid);
+  allocAndConvertData(zroutdat, m_zrout, m_array_length, vid);
+  allocAndConvertData(zzoutdat, m_zzout, m_array_length, vid);
+
+  const compute_type s = m_s;
+  const compute_type t = m_t;
+
+  const Index_type kn = m_kn;
+  const Index_type jn = m_jn;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kbeg; k < kend; ++k ) {
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY1;
+          }
+        }
+
+        for (Index_type k = kbeg; k < kend; ++k ) {
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY2;
+          }
+        }
+
+        for (Index_type k = kbeg; k < kend; ++k ) {
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY3;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HYDRO_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_zzout, zzoutdat, m_array_length);
+  convertData(m_zrout, zroutdat, m_array_length);
+
+  deallocData(zadat, vid);
+  deallocData(zbdat, vid);
+  deallocData(zmdat, vid);
+  deallocData(zpdat, vid);
+  deallocData(zqdat, vid);
+  deallocData(zrdat, vid);
+  deallocData(zudat, vid);
+  deallocData(zvdat, vid);
+  deallocData(zzdat, vid);
+  deallocData(zroutdat, vid);
+  deallocData(zzoutdat, vid);
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(HYDRO_2D, Seq, Base_Seq)
+
 } // end namespace lcals
 } // end namespace rajaperf
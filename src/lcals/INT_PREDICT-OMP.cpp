@@ -10,7 +10,11 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/LayoutUtils.hpp"
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +22,7 @@ namespace lcals
 {
 
 
-void INT_PREDICT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INT_PREDICT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -91,5 +95,167 @@ void INT_PREDICT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 #endif
 }
 
+template < typename precision_helper >
+void INT_PREDICT::runOpenMPVariantPrecision(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  storage_type* px;
+  allocAndConvertData(px, m_px, m_array_length, vid);
+
+  compute_type dm22 = m_dm22;
+  compute_type dm23 = m_dm23;
+  compute_type dm24 = m_dm24;
+  compute_type dm25 = m_dm25;
+  compute_type dm26 = m_dm26;
+  compute_type dm27 = m_dm27;
+  compute_type dm28 = m_dm28;
+  compute_type c0 = m_c0;
+  const Index_type offset = m_offset;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          INT_PREDICT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INT_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_px, px, m_array_length);
+
+  deallocData(px, vid);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < typename layout_helper >
+void INT_PREDICT::runOpenMPVariantLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  using view_type = typename layout_helper::template view_type<Real_type>;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  const Index_type num_comps = m_array_length / m_offset;
+  std::vector<Real_ptr> px_comps = getComponents(m_px, num_comps, m_offset);
+
+  Real_ptr px_data;
+  allocData(px_data, view_type::storageSize(num_comps, m_offset), vid);
+  view_type pxv(px_data, num_comps, m_offset);
+  copyToLayout(pxv, px_comps, m_offset);
+
+  Real_type dm22 = m_dm22;
+  Real_type dm23 = m_dm23;
+  Real_type dm24 = m_dm24;
+  Real_type dm25 = m_dm25;
+  Real_type dm26 = m_dm26;
+  Real_type dm27 = m_dm27;
+  Real_type dm28 = m_dm28;
+  Real_type c0 = m_c0;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          INT_PREDICT_BODY_LAYOUT;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INT_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  copyFromLayout(px_comps, pxv, m_offset);
+
+  deallocData(px_data, vid);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void INT_PREDICT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    runPrecisionTunings(tune_idx, t, [&](auto precision_helper) {
+      runOpenMPVariantPrecision<decltype(precision_helper)>(vid);
+    });
+
+    seq_for(layout_helpers{}, [&](auto layout_helper) {
+      if (tune_idx == t) {
+        runOpenMPVariantLayout<decltype(layout_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void INT_PREDICT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    addPrecisionTuningDefinitions(*this, vid);
+
+    seq_for(layout_helpers{}, [&](auto layout_helper) {
+      addVariantTuningName(vid, decltype(layout_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -10,7 +10,11 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/LayoutUtils.hpp"
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +22,7 @@ namespace lcals
 {
 
 
-void INT_PREDICT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INT_PREDICT::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -88,5 +92,153 @@ void INT_PREDICT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
 }
 
+template < typename precision_helper >
+void INT_PREDICT::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  storage_type* px;
+  allocAndConvertData(px, m_px, m_array_length, vid);
+
+  compute_type dm22 = m_dm22;
+  compute_type dm23 = m_dm23;
+  compute_type dm24 = m_dm24;
+  compute_type dm25 = m_dm25;
+  compute_type dm26 = m_dm26;
+  compute_type dm27 = m_dm27;
+  compute_type dm28 = m_dm28;
+  compute_type c0 = m_c0;
+  const Index_type offset = m_offset;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          INT_PREDICT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INT_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_px, px, m_array_length);
+
+  deallocData(px, vid);
+}
+
+template < typename layout_helper >
+void INT_PREDICT::runSeqVariantLayout(VariantID vid)
+{
+  using view_type = typename layout_helper::template view_type<Real_type>;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  const Index_type num_comps = m_array_length / m_offset;
+  std::vector<Real_ptr> px_comps = getComponents(m_px, num_comps, m_offset);
+
+  Real_ptr px_data;
+  allocData(px_data, view_type::storageSize(num_comps, m_offset), vid);
+  view_type pxv(px_data, num_comps, m_offset);
+  copyToLayout(pxv, px_comps, m_offset);
+
+  Real_type dm22 = m_dm22;
+  Real_type dm23 = m_dm23;
+  Real_type dm24 = m_dm24;
+  Real_type dm25 = m_dm25;
+  Real_type dm26 = m_dm26;
+  Real_type dm27 = m_dm27;
+  Real_type dm28 = m_dm28;
+  Real_type c0 = m_c0;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          INT_PREDICT_BODY_LAYOUT;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INT_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  copyFromLayout(px_comps, pxv, m_offset);
+
+  deallocData(px_data, vid);
+}
+
+void INT_PREDICT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    runPrecisionTunings(tune_idx, t, [&](auto precision_helper) {
+      runSeqVariantPrecision<decltype(precision_helper)>(vid);
+    });
+
+    seq_for(layout_helpers{}, [&](auto layout_helper) {
+      if (tune_idx == t) {
+        runSeqVariantLayout<decltype(layout_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void INT_PREDICT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    addPrecisionTuningDefinitions(*this, vid);
+
+    seq_for(layout_helpers{}, [&](auto layout_helper) {
+      addVariantTuningName(vid, decltype(layout_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -45,6 +45,14 @@
           c0*( px[i + offset *  4] + px[i + offset *  5] ) + \
           px[i + offset *  2];
 
+#define INT_PREDICT_BODY_LAYOUT  \
+  pxv(0, i) = dm28*pxv(12, i) + dm27*pxv(11, i) + \
+              dm26*pxv(10, i) + dm25*pxv( 9, i) + \
+              dm24*pxv( 8, i) + dm23*pxv( 7, i) + \
+              dm22*pxv( 6, i) + \
+              c0*( pxv( 4, i) + pxv( 5, i) ) + \
+              pxv( 2, i);
+
 
 #include "common/KernelBase.hpp"
 
@@ -74,6 +82,19 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename precision_helper >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename precision_helper >
+  void runOpenMPVariantPrecision(VariantID vid);
+  template < typename layout_helper >
+  void runSeqVariantLayout(VariantID vid);
+  template < typename layout_helper >
+  void runOpenMPVariantLayout(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -10,6 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+#include "common/VectorMathUtils.hpp"
+
 #include <iostream>
 #include <cmath>
 
@@ -19,7 +22,7 @@ namespace lcals
 {
 
 
-void PLANCKIAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PLANCKIAN::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -92,5 +95,154 @@ void PLANCKIAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+template < typename precision_helper >
+void PLANCKIAN::runOpenMPVariantPrecision(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  storage_type* x;
+  storage_type* y;
+  storage_type* u;
+  storage_type* v;
+  storage_type* w;
+  allocAndConvertData(x, m_x, getActualProblemSize(), vid);
+  allocAndConvertData(y, m_y, getActualProblemSize(), vid);
+  allocAndConvertData(u, m_u, getActualProblemSize(), vid);
+  allocAndConvertData(v, m_v, getActualProblemSize(), vid);
+  allocAndConvertData(w, m_w, getActualProblemSize(), vid);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PLANCKIAN_BODY_PRECISION;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PLANCKIAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_w, w, getActualProblemSize());
+
+  deallocData(x, vid);
+  deallocData(y, vid);
+  deallocData(u, vid);
+  deallocData(v, vid);
+  deallocData(w, vid);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+#if defined(RAJAPERF_USE_VECMATH)
+template < typename math_helper >
+void PLANCKIAN::runOpenMPVariantVecMath(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PLANCKIAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for simd
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          PLANCKIAN_BODY_VECMATH;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PLANCKIAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+#endif
+
+void PLANCKIAN::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    runPrecisionTunings(tune_idx, t, [&](auto precision_helper) {
+      runOpenMPVariantPrecision<decltype(precision_helper)>(vid);
+    });
+
+#if defined(RAJAPERF_USE_VECMATH)
+    seq_for(vecmath_helpers{}, [&](auto math_helper) {
+      if (tune_idx == t) {
+        runOpenMPVariantVecMath<decltype(math_helper)>(vid);
+      }
+      t += 1;
+    });
+#endif
+
+  }
+}
+
+void PLANCKIAN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    addPrecisionTuningDefinitions(*this, vid);
+
+#if defined(RAJAPERF_USE_VECMATH)
+    seq_for(vecmath_helpers{}, [&](auto math_helper) {
+      addVariantTuningName(vid, decltype(math_helper)::get_name());
+    });
+#endif
+
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
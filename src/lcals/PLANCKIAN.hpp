@@ -30,6 +30,14 @@
   y[i] = u[i] / v[i]; \
   w[i] = x[i] / ( exp( y[i] ) - 1.0 );
 
+#define PLANCKIAN_BODY_PRECISION  \
+  y[i] = u[i] / v[i]; \
+  w[i] = x[i] / ( std::exp( compute_type(y[i]) ) - compute_type(1.0) );
+
+#define PLANCKIAN_BODY_VECMATH  \
+  y[i] = u[i] / v[i]; \
+  w[i] = x[i] / ( math_helper::exp( y[i] ) - 1.0 );
+
 
 #include "common/KernelBase.hpp"
 
@@ -59,6 +67,19 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename precision_helper >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename precision_helper >
+  void runOpenMPVariantPrecision(VariantID vid);
+  template < typename math_helper >
+  void runSeqVariantVecMath(VariantID vid);
+  template < typename math_helper >
+  void runOpenMPVariantVecMath(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace lcals
 {
 
 
-void TRIDIAG_ELIM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void TRIDIAG_ELIM::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 1;
@@ -88,5 +90,56 @@ void TRIDIAG_ELIM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+template < typename precision_helper >
+void TRIDIAG_ELIM::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 1;
+  const Index_type iend = m_N;
+
+  storage_type* xout;
+  storage_type* xin;
+  storage_type* y;
+  storage_type* z;
+  allocAndConvertData(xout, m_xout, m_N, vid);
+  allocAndConvertData(xin, m_xin, m_N, vid);
+  allocAndConvertData(y, m_y, m_N, vid);
+  allocAndConvertData(z, m_z, m_N, vid);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRIDIAG_ELIM_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRIDIAG_ELIM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_xout, xout, m_N);
+
+  deallocData(xout, vid);
+  deallocData(xin, vid);
+  deallocData(y, vid);
+  deallocData(z, vid);
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(TRIDIAG_ELIM, Seq, Base_Seq)
+
 } // end namespace lcals
 } // end namespace rajaperf
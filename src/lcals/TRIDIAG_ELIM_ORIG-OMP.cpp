@@ -0,0 +1,156 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRIDIAG_ELIM_ORIG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/RecurrenceUtils.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+//
+// Scan the block maps of one block per thread.
+//
+void TRIDIAG_ELIM_ORIG::runOpenMPVariantScan(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 1;
+  const Index_type iend = getActualProblemSize();
+
+  TRIDIAG_ELIM_ORIG_DATA_SETUP;
+
+  auto tridiagelimorig_map_lam = [=](Index_type i) {
+                                   return TRIDIAG_ELIM_ORIG_MAP;
+                                 };
+  auto tridiagelimorig_step_lam = [=](Index_type i, Real_type x_prev) {
+                                    TRIDIAG_ELIM_ORIG_STEP;
+                                    return x[i];
+                                  };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      std::vector<AffineMap> thread_maps(omp_get_max_threads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        affineRecurrenceScan(ibegin, iend, x[ibegin-1],
+                             tridiagelimorig_map_lam, tridiagelimorig_step_lam,
+                             thread_maps);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRIDIAG_ELIM_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Scan the block maps of fixed size blocks by recursive doubling.
+//
+void TRIDIAG_ELIM_ORIG::runOpenMPVariantRecursiveDoubling(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 1;
+  const Index_type iend = getActualProblemSize();
+
+  TRIDIAG_ELIM_ORIG_DATA_SETUP;
+
+  auto tridiagelimorig_map_lam = [=](Index_type i) {
+                                   return TRIDIAG_ELIM_ORIG_MAP;
+                                 };
+  auto tridiagelimorig_step_lam = [=](Index_type i, Real_type x_prev) {
+                                    TRIDIAG_ELIM_ORIG_STEP;
+                                    return x[i];
+                                  };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type nblocks =
+          (iend - ibegin + recurrence_block_size - 1) / recurrence_block_size;
+      std::vector<AffineMap> block_maps(nblocks);
+      std::vector<AffineMap> block_maps_tmp(nblocks);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        affineRecurrenceRecursiveDoubling(ibegin, iend, x[ibegin-1],
+                                          tridiagelimorig_map_lam, tridiagelimorig_step_lam,
+                                          block_maps, block_maps_tmp);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRIDIAG_ELIM_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void TRIDIAG_ELIM_ORIG::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantScan(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantRecursiveDoubling(vid);
+
+  }
+
+  t += 1;
+}
+
+void TRIDIAG_ELIM_ORIG::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "scan");
+  addVariantTuningName(vid, "recursive_doubling");
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,68 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRIDIAG_ELIM_ORIG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+TRIDIAG_ELIM_ORIG::TRIDIAG_ELIM_ORIG(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_TRIDIAG_ELIM_ORIG, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(1000);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_N = getActualProblemSize();
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type ) + 2*sizeof(Real_type )) * (m_N-1) );
+  setFLOPsPerRep(2 * (getActualProblemSize()-1));
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+}
+
+TRIDIAG_ELIM_ORIG::~TRIDIAG_ELIM_ORIG()
+{
+}
+
+void TRIDIAG_ELIM_ORIG::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_x, m_N, vid);
+  allocAndInitData(m_y, m_N, vid);
+  allocAndInitData(m_z, m_N, vid);
+}
+
+void TRIDIAG_ELIM_ORIG::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize(), vid);
+}
+
+void TRIDIAG_ELIM_ORIG::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+  deallocData(m_z, vid);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,95 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// TRIDIAG_ELIM_ORIG kernel reference implementation:
+///
+/// Note: original form of TRIDIAG_ELIM with a single array 'x', so each
+///       value depends on the one computed before it.
+///
+/// for (Index_type i = 1; i < N; ++i ) {
+///   x[i] = z[i] * ( y[i] - x[i-1] );
+/// }
+///
+/// Base_OpenMP tunings run the recurrence as a scan of the affine maps
+/// x -> -z[i]*x + z[i]*y[i], see common/RecurrenceUtils.hpp.
+///
+
+#ifndef RAJAPerf_Lcals_TRIDIAG_ELIM_ORIG_HPP
+#define RAJAPerf_Lcals_TRIDIAG_ELIM_ORIG_HPP
+
+
+#define TRIDIAG_ELIM_ORIG_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Real_ptr z = m_z;
+
+#define TRIDIAG_ELIM_ORIG_BODY  \
+  x[i] = z[i] * ( y[i] - x[i-1] );
+
+#define TRIDIAG_ELIM_ORIG_MAP  \
+  AffineMap{ -z[i], z[i] * y[i] }
+
+#define TRIDIAG_ELIM_ORIG_STEP  \
+  x[i] = z[i] * ( y[i] - x_prev );
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class TRIDIAG_ELIM_ORIG : public KernelBase
+{
+public:
+
+  TRIDIAG_ELIM_ORIG(const RunParams& params);
+
+  ~TRIDIAG_ELIM_ORIG();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRIDIAG_ELIM_ORIG : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRIDIAG_ELIM_ORIG : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRIDIAG_ELIM_ORIG : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantScan(VariantID vid);
+  void runOpenMPVariantRecursiveDoubling(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Real_ptr m_z;
+
+  Index_type m_N;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
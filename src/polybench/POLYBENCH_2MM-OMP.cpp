@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 
 
@@ -26,7 +28,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_2MM::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -231,5 +233,100 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+template < typename precision_helper >
+void POLYBENCH_2MM::runOpenMPVariantPrecision(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+  // the body macros declare their scalars as Real_type
+  using Real_type = compute_type;
+
+  const Index_type run_reps= getRunReps();
+
+  storage_type* tmp;
+  storage_type* A;
+  storage_type* B;
+  storage_type* C;
+  storage_type* D;
+  allocAndConvertData(tmp, m_tmp, m_ni * m_nj, vid);
+  allocAndConvertData(A, m_A, m_ni * m_nk, vid);
+  allocAndConvertData(B, m_B, m_nk * m_nj, vid);
+  allocAndConvertData(C, m_C, m_nj * m_nl, vid);
+  allocAndConvertData(D, m_D, m_ni * m_nl, vid);
+
+  compute_type alpha = m_alpha;
+  compute_type beta = m_beta;
+
+  const Index_type ni = m_ni;
+  const Index_type nj = m_nj;
+  const Index_type nk = m_nk;
+  const Index_type nl = m_nl;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if defined(USE_OMP_COLLAPSE)
+        #pragma omp parallel for collapse(2)
+#else
+        #pragma omp parallel for
+#endif
+        for (Index_type i = 0; i < ni; i++ ) {
+          for(Index_type j = 0; j < nj; j++) {
+            POLYBENCH_2MM_BODY1;
+            for (Index_type k = 0; k < nk; k++) {
+              POLYBENCH_2MM_BODY2;
+            }
+            POLYBENCH_2MM_BODY3;
+          }
+        }
+
+#if defined(USE_OMP_COLLAPSE)
+        #pragma omp parallel for collapse(2)
+#else
+        #pragma omp parallel for
+#endif
+        for(Index_type i = 0; i < ni; i++) {
+          for(Index_type l = 0; l < nl; l++) {
+            POLYBENCH_2MM_BODY4;
+            for (Index_type j = 0; j < nj; j++) {
+              POLYBENCH_2MM_BODY5;
+            }
+            POLYBENCH_2MM_BODY6;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_2MM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_D, D, m_ni * m_nl);
+
+  deallocData(tmp, vid);
+  deallocData(A, vid);
+  deallocData(B, vid);
+  deallocData(C, vid);
+  deallocData(D, vid);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(POLYBENCH_2MM, OpenMP, Base_OpenMP)
+
 } // end namespace polybench
 } // end namespace rajaperf
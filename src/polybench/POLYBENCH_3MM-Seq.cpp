@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 #include <cstring>
 
@@ -20,7 +22,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_3MM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_3MM::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -241,5 +243,98 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+template < typename precision_helper >
+void POLYBENCH_3MM::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+  // the body macros declare their scalars as Real_type
+  using Real_type = compute_type;
+
+  const Index_type run_reps = getRunReps();
+
+  storage_type* A;
+  storage_type* B;
+  storage_type* C;
+  storage_type* D;
+  storage_type* E;
+  storage_type* F;
+  storage_type* G;
+  allocAndConvertData(A, m_A, m_ni * m_nk, vid);
+  allocAndConvertData(B, m_B, m_nk * m_nj, vid);
+  allocAndConvertData(C, m_C, m_nj * m_nm, vid);
+  allocAndConvertData(D, m_D, m_nm * m_nl, vid);
+  allocAndConvertData(E, m_E, m_ni * m_nj, vid);
+  allocAndConvertData(F, m_F, m_nj * m_nl, vid);
+  allocAndConvertData(G, m_G, m_ni * m_nl, vid);
+
+  const Index_type ni = m_ni;
+  const Index_type nj = m_nj;
+  const Index_type nk = m_nk;
+  const Index_type nl = m_nl;
+  const Index_type nm = m_nm;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < ni; i++ ) {
+          for (Index_type j = 0; j < nj; j++) {
+            POLYBENCH_3MM_BODY1;
+            for (Index_type k = 0; k < nk; k++) {
+              POLYBENCH_3MM_BODY2;
+            }
+            POLYBENCH_3MM_BODY3;
+          }
+        }
+
+        for (Index_type j = 0; j < nj; j++) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_3MM_BODY4;
+            for (Index_type m = 0; m < nm; m++) {
+              POLYBENCH_3MM_BODY5;
+            }
+            POLYBENCH_3MM_BODY6;
+          }
+        }
+
+        for (Index_type i = 0; i < ni; i++) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_3MM_BODY7;
+            for (Index_type j = 0; j < nj; j++) {
+              POLYBENCH_3MM_BODY8;
+            }
+            POLYBENCH_3MM_BODY9;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_3MM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_G, G, m_ni * m_nl);
+
+  deallocData(A, vid);
+  deallocData(B, vid);
+  deallocData(C, vid);
+  deallocData(D, vid);
+  deallocData(E, vid);
+  deallocData(F, vid);
+  deallocData(G, vid);
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(POLYBENCH_3MM, Seq, Base_Seq)
+
 } // end namespace basic
 } // end namespace rajaperf
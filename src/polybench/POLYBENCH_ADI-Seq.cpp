@@ -10,6 +10,10 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+#include "common/TridiagonalUtils.hpp"
+
+#include <algorithm>
 #include <iostream>
 #include <cstring>
 
@@ -18,7 +22,7 @@ namespace rajaperf
 namespace polybench
 {
 
-void POLYBENCH_ADI::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_ADI::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -215,5 +219,382 @@ void POLYBENCH_ADI::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+template < typename precision_helper >
+void POLYBENCH_ADI::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+
+  const Index_type run_reps = getRunReps();
+
+  storage_type* U;
+  storage_type* V;
+  storage_type* P;
+  storage_type* Q;
+  allocAndConvertData(U, m_U, m_n * m_n, vid);
+  allocAndConvertData(V, m_V, m_n * m_n, vid);
+  allocAndConvertData(P, m_P, m_n * m_n, vid);
+  allocAndConvertData(Q, m_Q, m_n * m_n, vid);
+
+  const Index_type n = m_n;
+  const Index_type tsteps = m_tsteps;
+
+  compute_type DX = compute_type(1.0)/(compute_type)n;
+  compute_type DY = compute_type(1.0)/(compute_type)n;
+  compute_type DT = compute_type(1.0)/(compute_type)tsteps;
+  compute_type B1 = 2.0;
+  compute_type B2 = 1.0;
+  compute_type mul1 = B1 * DT / (DX * DX);
+  compute_type mul2 = B2 * DT / (DY * DY);
+  compute_type a = -mul1 / compute_type(2.0);
+  compute_type b = compute_type(1.0) + mul1;
+  compute_type c = a;
+  compute_type d = -mul2 / compute_type(2.0);
+  compute_type e = compute_type(1.0) + mul2;
+  compute_type f = d;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 1; t <= tsteps; ++t) {
+
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY2;
+            for (Index_type j = 1; j < n-1; ++j) {
+              POLYBENCH_ADI_BODY3_PRECISION;
+            }
+            POLYBENCH_ADI_BODY4;
+            for (Index_type k = n-2; k >= 1; --k) {
+              POLYBENCH_ADI_BODY5;
+            }
+          }
+
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY6;
+            for (Index_type j = 1; j < n-1; ++j) {
+              POLYBENCH_ADI_BODY7_PRECISION;
+            }
+            POLYBENCH_ADI_BODY8;
+            for (Index_type k = n-2; k >= 1; --k) {
+              POLYBENCH_ADI_BODY9;
+            }
+          }
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ADI : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_U, U, m_n * m_n);
+
+  deallocData(U, vid);
+  deallocData(V, vid);
+  deallocData(P, vid);
+  deallocData(Q, vid);
+}
+
+void POLYBENCH_ADI::runSeqVariantInterleaved(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ADI_GRID_DATA_SETUP;
+
+  const Index_type W = interleaved_batch_size;
+
+  Real_ptr Pb;
+  Real_ptr Qb;
+  allocData(Pb, n * W, vid);
+  allocData(Qb, n * W, vid);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 1; t <= tsteps; ++t) {
+
+          for (Index_type i0 = 1; i0 < n-1; i0 += W) {
+            const Index_type nw = std::min(W, n-1 - i0);
+            for (Index_type w = 0; w < nw; ++w) {
+              const Index_type i = i0 + w;
+              POLYBENCH_ADI_BODY2_INTERLEAVED;
+            }
+            for (Index_type j = 1; j < n-1; ++j) {
+              RAJAPERF_OMP_SIMD
+              for (Index_type w = 0; w < nw; ++w) {
+                const Index_type i = i0 + w;
+                POLYBENCH_ADI_BODY3_INTERLEAVED;
+              }
+            }
+            for (Index_type w = 0; w < nw; ++w) {
+              const Index_type i = i0 + w;
+              POLYBENCH_ADI_BODY4;
+            }
+            for (Index_type k = n-2; k >= 1; --k) {
+              RAJAPERF_OMP_SIMD
+              for (Index_type w = 0; w < nw; ++w) {
+                const Index_type i = i0 + w;
+                POLYBENCH_ADI_BODY5_INTERLEAVED;
+              }
+            }
+          }
+
+          for (Index_type i0 = 1; i0 < n-1; i0 += W) {
+            const Index_type nw = std::min(W, n-1 - i0);
+            for (Index_type w = 0; w < nw; ++w) {
+              const Index_type i = i0 + w;
+              POLYBENCH_ADI_BODY6_INTERLEAVED;
+            }
+            for (Index_type j = 1; j < n-1; ++j) {
+              RAJAPERF_OMP_SIMD
+              for (Index_type w = 0; w < nw; ++w) {
+                const Index_type i = i0 + w;
+                POLYBENCH_ADI_BODY7_INTERLEAVED;
+              }
+            }
+            for (Index_type w = 0; w < nw; ++w) {
+              const Index_type i = i0 + w;
+              POLYBENCH_ADI_BODY8;
+            }
+            for (Index_type k = n-2; k >= 1; --k) {
+              RAJAPERF_OMP_SIMD
+              for (Index_type w = 0; w < nw; ++w) {
+                const Index_type i = i0 + w;
+                POLYBENCH_ADI_BODY9_INTERLEAVED;
+              }
+            }
+          }
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ADI : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  deallocData(Pb, vid);
+  deallocData(Qb, vid);
+}
+
+void POLYBENCH_ADI::runSeqVariantPCR(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ADI_GRID_DATA_SETUP;
+
+  Real_ptr work;
+  allocData(work, tridiagonalPCRWorkspaceSize(n-2), vid);
+  initTridiagonalPCRWorkspace(n-2, work);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 1; t <= tsteps; ++t) {
+
+          for (Index_type i = 1; i < n-1; ++i) {
+            solveTridiagonalPCR(1, n-1, a, b, c, 1.0, 1.0,
+              [=](Index_type j) { return POLYBENCH_ADI_BODY3_PCR; },
+              [=](Index_type j, Real_type x) { POLYBENCH_ADI_BODY5_PCR; },
+              work);
+            V[0 * n + i] = 1.0;
+            POLYBENCH_ADI_BODY4;
+          }
+
+          for (Index_type i = 1; i < n-1; ++i) {
+            solveTridiagonalPCR(1, n-1, d, e, f, 1.0, 1.0,
+              [=](Index_type j) { return POLYBENCH_ADI_BODY7_PCR; },
+              [=](Index_type j, Real_type x) { POLYBENCH_ADI_BODY9_PCR; },
+              work);
+            U[i * n + 0] = 1.0;
+            POLYBENCH_ADI_BODY8;
+          }
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ADI : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  deallocData(work, vid);
+}
+
+void POLYBENCH_ADI::runSeqVariantTranspose(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ADI_DATA_SETUP;
+
+  const Index_type T = transpose_tile_size;
+
+  Real_ptr Ut;
+  Real_ptr Vt;
+  allocData(Ut, n * n, vid);
+  allocData(Vt, n * n, vid);
+
+  for (Index_type ii = 0; ii < n; ++ii) {
+    for (Index_type jj = 0; jj < n; ++jj) {
+      POLYBENCH_ADI_BODY_TRANSPOSE(Vt, V);
+    }
+  }
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 1; t <= tsteps; ++t) {
+
+          for (Index_type i0 = 0; i0 < n; i0 += T) {
+            for (Index_type j0 = 0; j0 < n; j0 += T) {
+              for (Index_type ii = i0; ii < std::min(i0 + T, n); ++ii) {
+                for (Index_type jj = j0; jj < std::min(j0 + T, n); ++jj) {
+                  POLYBENCH_ADI_BODY_TRANSPOSE(Ut, U);
+                }
+              }
+            }
+          }
+
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY2_TRANSPOSE;
+            for (Index_type j = 1; j < n-1; ++j) {
+              POLYBENCH_ADI_BODY3_TRANSPOSE;
+            }
+            POLYBENCH_ADI_BODY4_TRANSPOSE;
+            for (Index_type k = n-2; k >= 1; --k) {
+              POLYBENCH_ADI_BODY5_TRANSPOSE;
+            }
+          }
+
+          for (Index_type i0 = 0; i0 < n; i0 += T) {
+            for (Index_type j0 = 0; j0 < n; j0 += T) {
+              for (Index_type ii = i0; ii < std::min(i0 + T, n); ++ii) {
+                for (Index_type jj = j0; jj < std::min(j0 + T, n); ++jj) {
+                  POLYBENCH_ADI_BODY_TRANSPOSE(V, Vt);
+                }
+              }
+            }
+          }
+
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY6;
+            for (Index_type j = 1; j < n-1; ++j) {
+              POLYBENCH_ADI_BODY7;
+            }
+            POLYBENCH_ADI_BODY8;
+            for (Index_type k = n-2; k >= 1; --k) {
+              POLYBENCH_ADI_BODY9;
+            }
+          }
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ADI : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  deallocData(Ut, vid);
+  deallocData(Vt, vid);
+}
+
+void POLYBENCH_ADI::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    runPrecisionTunings(tune_idx, t, [&](auto precision_helper) {
+      runSeqVariantPrecision<decltype(precision_helper)>(vid);
+    });
+
+    if (tune_idx == t) {
+      runSeqVariantInterleaved(vid);
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+      runSeqVariantPCR(vid);
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+      runSeqVariantTranspose(vid);
+    }
+
+    t += 1;
+
+  }
+}
+
+void POLYBENCH_ADI::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    addPrecisionTuningDefinitions(*this, vid);
+
+    addVariantTuningName(vid, "interleaved");
+
+    addVariantTuningName(vid, "pcr");
+
+    addVariantTuningName(vid, "transpose");
+
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -64,7 +64,7 @@
 #define RAJAPerf_POLYBENCH_ADI_HPP
 
 
-#define POLYBENCH_ADI_DATA_SETUP \
+#define POLYBENCH_ADI_GRID_DATA_SETUP \
   const Index_type n = m_n; \
   const Index_type tsteps = m_tsteps; \
 \
@@ -83,7 +83,11 @@
   Real_type f = d; \
 \
   Real_ptr U = m_U; \
-  Real_ptr V = m_V; \
+  Real_ptr V = m_V;
+
+#define POLYBENCH_ADI_DATA_SETUP \
+  POLYBENCH_ADI_GRID_DATA_SETUP \
+  \
   Real_ptr P = m_P; \
   Real_ptr Q = m_Q;
 
@@ -99,6 +103,12 @@
                  f * U[j * n + i + 1] - a * Q[i * n + j-1]) / \
                     (a * P[i * n + j-1] + b);
 
+#define POLYBENCH_ADI_BODY3_PRECISION \
+  P[i * n + j] = -c / (a * P[i * n + j-1] + b); \
+  Q[i * n + j] = (-d * U[j * n + i-1] + (compute_type(1.0) + compute_type(2.0)*d) * U[j * n + i] - \
+                 f * U[j * n + i + 1] - a * Q[i * n + j-1]) / \
+                    (a * P[i * n + j-1] + b);
+
 #define POLYBENCH_ADI_BODY4 \
   V[(n-1) * n + i] = 1.0;
 
@@ -116,6 +126,12 @@
                  c * V[(i + 1) * n + j] - d * Q[i * n + j-1]) / \
                     (d * P[i * n + j-1] + e);
 
+#define POLYBENCH_ADI_BODY7_PRECISION \
+  P[i * n + j] = -f / (d * P[i * n + j-1] + e); \
+  Q[i * n + j] = (-a * V[(i-1) * n + j] + (compute_type(1.0) + compute_type(2.0)*a) * V[i * n + j] - \
+                 c * V[(i + 1) * n + j] - d * Q[i * n + j-1]) / \
+                    (d * P[i * n + j-1] + e);
+
 #define POLYBENCH_ADI_BODY8 \
   U[i * n + n-1] = 1.0;
 
@@ -123,6 +139,81 @@
   U[i * n + k] = P[i * n + k] * U[i * n + k +1] + Q[i * n + k];
 
 
+//
+// Interleaved bodies solve a batch of W systems i = i0 + w with their
+// coefficients interleaved in Pb and Qb, so loops over w vectorize.
+//
+#define POLYBENCH_ADI_BODY2_INTERLEAVED \
+  V[0 * n + i] = 1.0; \
+  Pb[0 * W + w] = 0.0; \
+  Qb[0 * W + w] = V[0 * n + i];
+
+#define POLYBENCH_ADI_BODY3_INTERLEAVED \
+  Pb[j * W + w] = -c / (a * Pb[(j-1) * W + w] + b); \
+  Qb[j * W + w] = (-d * U[j * n + i-1] + (1.0 + 2.0*d) * U[j * n + i] - \
+                   f * U[j * n + i + 1] - a * Qb[(j-1) * W + w]) / \
+                      (a * Pb[(j-1) * W + w] + b);
+
+#define POLYBENCH_ADI_BODY5_INTERLEAVED \
+  V[k * n + i]  = Pb[k * W + w] * V[(k+1) * n + i] + Qb[k * W + w];
+
+#define POLYBENCH_ADI_BODY6_INTERLEAVED \
+  U[i * n + 0] = 1.0; \
+  Pb[0 * W + w] = 0.0; \
+  Qb[0 * W + w] = U[i * n + 0];
+
+#define POLYBENCH_ADI_BODY7_INTERLEAVED \
+  Pb[j * W + w] = -f / (d * Pb[(j-1) * W + w] + e); \
+  Qb[j * W + w] = (-a * V[(i-1) * n + j] + (1.0 + 2.0*a) * V[i * n + j] - \
+                   c * V[(i + 1) * n + j] - d * Qb[(j-1) * W + w]) / \
+                      (d * Pb[(j-1) * W + w] + e);
+
+#define POLYBENCH_ADI_BODY9_INTERLEAVED \
+  U[i * n + k] = Pb[k * W + w] * U[i * n + k +1] + Qb[k * W + w];
+
+
+//
+// PCR bodies give the right hand side of equation j of system i and store
+// its solution x, solving each system with solveTridiagonalPCR.
+//
+#define POLYBENCH_ADI_BODY3_PCR \
+  (-d * U[j * n + i-1] + (1.0 + 2.0*d) * U[j * n + i] - f * U[j * n + i + 1])
+
+#define POLYBENCH_ADI_BODY5_PCR \
+  V[j * n + i] = x;
+
+#define POLYBENCH_ADI_BODY7_PCR \
+  (-a * V[(i-1) * n + j] + (1.0 + 2.0*a) * V[i * n + j] - c * V[(i + 1) * n + j])
+
+#define POLYBENCH_ADI_BODY9_PCR \
+  U[i * n + j] = x;
+
+
+//
+// Transpose bodies run the column sweep on Ut and Vt, the transposes of
+// U and V, so it reads and writes rows as the row sweep does.
+//
+#define POLYBENCH_ADI_BODY2_TRANSPOSE \
+  Vt[i * n + 0] = 1.0; \
+  P[i * n + 0] = 0.0; \
+  Q[i * n + 0] = Vt[i * n + 0];
+
+#define POLYBENCH_ADI_BODY3_TRANSPOSE \
+  P[i * n + j] = -c / (a * P[i * n + j-1] + b); \
+  Q[i * n + j] = (-d * Ut[(i-1) * n + j] + (1.0 + 2.0*d) * Ut[i * n + j] - \
+                 f * Ut[(i + 1) * n + j] - a * Q[i * n + j-1]) / \
+                    (a * P[i * n + j-1] + b);
+
+#define POLYBENCH_ADI_BODY4_TRANSPOSE \
+  Vt[i * n + n-1] = 1.0;
+
+#define POLYBENCH_ADI_BODY5_TRANSPOSE \
+  Vt[i * n + k] = P[i * n + k] * Vt[i * n + k+1] + Q[i * n + k];
+
+#define POLYBENCH_ADI_BODY_TRANSPOSE(dst, src) \
+  dst[jj * n + ii] = src[ii * n + jj];
+
+
 #define POLYBENCH_ADI_BODY2_RAJA \
   Vview(0, i) = 1.0; \
   Pview(i, 0) = 0.0; \
@@ -196,6 +287,21 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename precision_helper >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename precision_helper >
+  void runOpenMPVariantPrecision(VariantID vid);
+  void runSeqVariantInterleaved(VariantID vid);
+  void runOpenMPVariantInterleaved(VariantID vid);
+  void runSeqVariantPCR(VariantID vid);
+  void runOpenMPVariantPCR(VariantID vid);
+  void runSeqVariantTranspose(VariantID vid);
+  void runOpenMPVariantTranspose(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -207,6 +313,9 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  static const Index_type interleaved_batch_size = 8;
+  static const Index_type transpose_tile_size = 32;
+
   Index_type m_n;
   Index_type m_tsteps;
 
@@ -10,6 +10,10 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+#include "common/TemporalBlockingUtils.hpp"
+
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +22,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_FDTD_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_FDTD_2D::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -191,5 +195,190 @@ void POLYBENCH_FDTD_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
 }
 
+template < typename precision_helper >
+void POLYBENCH_FDTD_2D::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+
+  const Index_type run_reps = getRunReps();
+
+  storage_type* fict;
+  storage_type* ex;
+  storage_type* ey;
+  storage_type* hz;
+  allocAndConvertData(fict, m_fict, m_tsteps, vid);
+  allocAndConvertData(ex, m_ex, m_nx * m_ny, vid);
+  allocAndConvertData(ey, m_ey, m_nx * m_ny, vid);
+  allocAndConvertData(hz, m_hz, m_nx * m_ny, vid);
+
+  Index_type t = 0;
+  const Index_type nx = m_nx;
+  const Index_type ny = m_ny;
+  const Index_type tsteps = m_tsteps;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (t = 0; t < tsteps; ++t) {
+
+          for (Index_type j = 0; j < ny; j++) {
+            POLYBENCH_FDTD_2D_BODY1;
+          }
+          for (Index_type i = 1; i < nx; i++) {
+            for (Index_type j = 0; j < ny; j++) {
+              POLYBENCH_FDTD_2D_BODY2_PRECISION;
+            }
+          }
+          for (Index_type i = 0; i < nx; i++) {
+            for (Index_type j = 1; j < ny; j++) {
+              POLYBENCH_FDTD_2D_BODY3_PRECISION;
+            }
+          }
+          for (Index_type i = 0; i < nx - 1; i++) {
+            for (Index_type j = 0; j < ny - 1; j++) {
+              POLYBENCH_FDTD_2D_BODY4_PRECISION;
+            }
+          }
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FDTD_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_hz, hz, m_nx * m_ny);
+
+  deallocData(fict, vid);
+  deallocData(ex, vid);
+  deallocData(ey, vid);
+  deallocData(hz, vid);
+}
+
+template < typename tiling_helper >
+void POLYBENCH_FDTD_2D::runSeqVariantTemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  const Index_type nx = m_nx;
+  const Index_type ny = m_ny;
+  const Index_type tsteps = m_tsteps;
+
+  Real_ptr fict = m_fict;
+  Real_ptr ex = m_ex;
+  Real_ptr ey = m_ey;
+  Real_ptr hz = m_hz;
+
+  const Index_type sweeps_per_tile = 2 * tiling_helper::time_tile_depth;
+
+  //
+  // Sweep s updates ex and ey for time step s/2 when s is even, and hz
+  // for time step s/2 when s is odd.
+  //
+  auto poly_fdtd2d_sweep = [=](Index_type s, Index_type ibegin, Index_type iend) {
+    const Index_type t = s / 2;
+    if (s % 2 == 0) {
+      if (ibegin == 0) {
+        for (Index_type j = 0; j < ny; j++) {
+          POLYBENCH_FDTD_2D_BODY1;
+        }
+      }
+      for (Index_type i = std::max(ibegin, Index_type(1)); i < iend; i++) {
+        for (Index_type j = 0; j < ny; j++) {
+          POLYBENCH_FDTD_2D_BODY2;
+        }
+      }
+      for (Index_type i = ibegin; i < iend; i++) {
+        for (Index_type j = 1; j < ny; j++) {
+          POLYBENCH_FDTD_2D_BODY3;
+        }
+      }
+    } else {
+      for (Index_type i = ibegin; i < std::min(iend, nx - 1); i++) {
+        for (Index_type j = 0; j < ny - 1; j++) {
+          POLYBENCH_FDTD_2D_BODY4;
+        }
+      }
+    }
+  };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tiling_helper::runSeq(0, nx, 2*tsteps, sweeps_per_tile,
+                              3*ny*sizeof(Real_type), poly_fdtd2d_sweep);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FDTD_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void POLYBENCH_FDTD_2D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    runPrecisionTunings(tune_idx, t, [&](auto precision_helper) {
+      runSeqVariantPrecision<decltype(precision_helper)>(vid);
+    });
+
+    seq_for(temporal_tiling_helpers{}, [&](auto tiling_helper) {
+      if (tune_idx == t) {
+        runSeqVariantTemporal<decltype(tiling_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void POLYBENCH_FDTD_2D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    addPrecisionTuningDefinitions(*this, vid);
+
+    seq_for(temporal_tiling_helpers{}, [&](auto tiling_helper) {
+      addVariantTuningName(vid, decltype(tiling_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
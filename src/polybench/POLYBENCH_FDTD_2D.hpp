@@ -55,13 +55,23 @@
 #define POLYBENCH_FDTD_2D_BODY2 \
   ey[j + i*ny] = ey[j + i*ny] - 0.5*(hz[j + i*ny] - hz[j + (i-1)*ny]);
 
+#define POLYBENCH_FDTD_2D_BODY2_PRECISION \
+  ey[j + i*ny] = ey[j + i*ny] - compute_type(0.5)*(hz[j + i*ny] - hz[j + (i-1)*ny]);
+
 #define POLYBENCH_FDTD_2D_BODY3 \
   ex[j + i*ny] = ex[j + i*ny] - 0.5*(hz[j + i*ny] - hz[j-1 + i*ny]);
 
+#define POLYBENCH_FDTD_2D_BODY3_PRECISION \
+  ex[j + i*ny] = ex[j + i*ny] - compute_type(0.5)*(hz[j + i*ny] - hz[j-1 + i*ny]);
+
 #define POLYBENCH_FDTD_2D_BODY4 \
   hz[j + i*ny] = hz[j + i*ny] - 0.7*(ex[j+1 + i*ny] - ex[j + i*ny] + \
                                      ey[j + (i+1)*ny] - ey[j + i*ny]);
 
+#define POLYBENCH_FDTD_2D_BODY4_PRECISION \
+  hz[j + i*ny] = hz[j + i*ny] - compute_type(0.7)*(ex[j+1 + i*ny] - ex[j + i*ny] + \
+                                     ey[j + (i+1)*ny] - ey[j + i*ny]);
+
 
 #define POLYBENCH_FDTD_2D_BODY1_RAJA \
   eyview(0, j) = fict[t];
@@ -114,6 +124,19 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename precision_helper >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename precision_helper >
+  void runOpenMPVariantPrecision(VariantID vid);
+  template < typename tiling_helper >
+  void runSeqVariantTemporal(VariantID vid);
+  template < typename tiling_helper >
+  void runOpenMPVariantTemporal(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
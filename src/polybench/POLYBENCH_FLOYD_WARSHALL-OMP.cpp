@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 
 //#define USE_OMP_COLLAPSE
@@ -24,7 +26,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -145,5 +147,66 @@ void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t RAJAPERF_U
 #endif
 }
 
+template < typename precision_helper >
+void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariantPrecision(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+
+  const Index_type run_reps= getRunReps();
+
+  storage_type* pin;
+  storage_type* pout;
+  allocAndConvertData(pin, m_pin, m_N*m_N, vid);
+  allocAndConvertData(pout, m_pout, m_N*m_N, vid);
+
+  const Index_type N = m_N;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 0; k < N; ++k) {
+#if defined(USE_OMP_COLLAPSE)
+          #pragma omp parallel for collapse(2)
+#else
+          #pragma omp parallel for
+#endif
+          for (Index_type i = 0; i < N; ++i) {
+            for (Index_type j = 0; j < N; ++j) {
+              POLYBENCH_FLOYD_WARSHALL_BODY_PRECISION;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_pout, pout, m_N*m_N);
+
+  deallocData(pin, vid);
+  deallocData(pout, vid);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(POLYBENCH_FLOYD_WARSHALL, OpenMP, Base_OpenMP)
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -35,6 +35,10 @@
   pout[j + i*N] = pin[j + i*N] < pin[k + i*N] + pin[j + k*N] ? \
                   pin[j + i*N] : pin[k + i*N] + pin[j + k*N];
 
+#define POLYBENCH_FLOYD_WARSHALL_BODY_PRECISION \
+  compute_type pikj = pin[k + i*N] + pin[j + k*N]; \
+  pout[j + i*N] = pin[j + i*N] < pikj ? compute_type(pin[j + i*N]) : pikj;
+
 
 #define POLYBENCH_FLOYD_WARSHALL_BODY_RAJA \
   poutview(i, j) = pinview(i, j) < pinview(i, k) + pinview(k, j) ? \
@@ -77,6 +81,15 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename precision_helper >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename precision_helper >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
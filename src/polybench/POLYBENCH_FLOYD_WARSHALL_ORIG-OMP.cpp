@@ -0,0 +1,281 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FLOYD_WARSHALL_ORIG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+void POLYBENCH_FLOYD_WARSHALL_ORIG::runOpenMPVariantDefault(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_ORIG_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 0; k < N; ++k) {
+          #pragma omp parallel for
+          for (Index_type i = 0; i < N; ++i) {
+            for (Index_type j = 0; j < N; ++j) {
+              POLYBENCH_FLOYD_WARSHALL_ORIG_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Three phase blocked Floyd-Warshall with a barrier after each phase.
+//
+template < size_t tile_size >
+void POLYBENCH_FLOYD_WARSHALL_ORIG::runOpenMPVariantBlocked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_ORIG_DATA_SETUP;
+
+  const Index_type T = static_cast<Index_type>(tile_size);
+  const Index_type nt = (N + T - 1) / T;
+
+  auto poly_floydwarshallorig_tile_lam = [=](Index_type i0, Index_type j0,
+                                             Index_type k0) {
+    const Index_type iend = std::min(i0 + T, N);
+    const Index_type jend = std::min(j0 + T, N);
+    const Index_type kend = std::min(k0 + T, N);
+    for (Index_type k = k0; k < kend; ++k) {
+      for (Index_type i = i0; i < iend; ++i) {
+        for (Index_type j = j0; j < jend; ++j) {
+          POLYBENCH_FLOYD_WARSHALL_ORIG_BODY;
+        }
+      }
+    }
+  };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        for (Index_type kt = 0; kt < nt; ++kt) {
+
+          #pragma omp single
+          poly_floydwarshallorig_tile_lam(kt*T, kt*T, kt*T);
+
+          #pragma omp for
+          for (Index_type bt = 0; bt < nt; ++bt) {
+            if (bt != kt) {
+              poly_floydwarshallorig_tile_lam(kt*T, bt*T, kt*T);
+              poly_floydwarshallorig_tile_lam(bt*T, kt*T, kt*T);
+            }
+          }
+
+          #pragma omp for collapse(2)
+          for (Index_type it = 0; it < nt; ++it) {
+            for (Index_type jt = 0; jt < nt; ++jt) {
+              if (it != kt && jt != kt) {
+                poly_floydwarshallorig_tile_lam(it*T, jt*T, kt*T);
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Three phase blocked Floyd-Warshall with one task per tile update. Task
+// dependences on the tiles replace the barriers, so tiles of one diagonal
+// step overlap with those of the next once their inputs are ready.
+//
+template < size_t tile_size >
+void POLYBENCH_FLOYD_WARSHALL_ORIG::runOpenMPVariantBlockedTask(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_ORIG_DATA_SETUP;
+
+  const Index_type T = static_cast<Index_type>(tile_size);
+  const Index_type nt = (N + T - 1) / T;
+
+  auto poly_floydwarshallorig_tile_lam = [=](Index_type i0, Index_type j0,
+                                             Index_type k0) {
+    const Index_type iend = std::min(i0 + T, N);
+    const Index_type jend = std::min(j0 + T, N);
+    const Index_type kend = std::min(k0 + T, N);
+    for (Index_type k = k0; k < kend; ++k) {
+      for (Index_type i = i0; i < iend; ++i) {
+        for (Index_type j = j0; j < jend; ++j) {
+          POLYBENCH_FLOYD_WARSHALL_ORIG_BODY;
+        }
+      }
+    }
+  };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      // one dependence object per tile
+      std::vector<char> tile_deps(nt*nt);
+      char* dep = tile_deps.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        #pragma omp single
+        for (Index_type kt = 0; kt < nt; ++kt) {
+
+          #pragma omp task depend(inout: dep[kt + kt*nt])
+          poly_floydwarshallorig_tile_lam(kt*T, kt*T, kt*T);
+
+          for (Index_type bt = 0; bt < nt; ++bt) {
+            if (bt != kt) {
+              #pragma omp task depend(in: dep[kt + kt*nt]) \
+                               depend(inout: dep[bt + kt*nt])
+              poly_floydwarshallorig_tile_lam(kt*T, bt*T, kt*T);
+
+              #pragma omp task depend(in: dep[kt + kt*nt]) \
+                               depend(inout: dep[kt + bt*nt])
+              poly_floydwarshallorig_tile_lam(bt*T, kt*T, kt*T);
+            }
+          }
+
+          for (Index_type it = 0; it < nt; ++it) {
+            for (Index_type jt = 0; jt < nt; ++jt) {
+              if (it != kt && jt != kt) {
+                #pragma omp task depend(in: dep[kt + it*nt], dep[jt + kt*nt]) \
+                                 depend(inout: dep[jt + it*nt])
+                poly_floydwarshallorig_tile_lam(it*T, jt*T, kt*T);
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_FLOYD_WARSHALL_ORIG::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(configuration::cache_tile_sizes{}, [&](auto tile_size) {
+      if (tune_idx == t) {
+        runOpenMPVariantBlocked<tile_size>(vid);
+      }
+      t += 1;
+    });
+
+    seq_for(configuration::cache_tile_sizes{}, [&](auto tile_size) {
+      if (tune_idx == t) {
+        runOpenMPVariantBlockedTask<tile_size>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void POLYBENCH_FLOYD_WARSHALL_ORIG::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(configuration::cache_tile_sizes{}, [&](auto tile_size) {
+      addVariantTuningName(vid, "blocked_"+std::to_string(tile_size));
+    });
+
+    seq_for(configuration::cache_tile_sizes{}, [&](auto tile_size) {
+      addVariantTuningName(vid, "blocked_task_"+std::to_string(tile_size));
+    });
+
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
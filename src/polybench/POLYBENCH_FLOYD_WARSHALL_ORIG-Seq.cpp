@@ -0,0 +1,165 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FLOYD_WARSHALL_ORIG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+void POLYBENCH_FLOYD_WARSHALL_ORIG::runSeqVariantDefault(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_ORIG_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 0; k < N; ++k) {
+          for (Index_type i = 0; i < N; ++i) {
+            for (Index_type j = 0; j < N; ++j) {
+              POLYBENCH_FLOYD_WARSHALL_ORIG_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+//
+// Three phase blocked Floyd-Warshall, the k steps of diagonal tile (K,K)
+// are run on (K,K), then on the tiles in row K and column K, then on the
+// remaining tiles.
+//
+template < size_t tile_size >
+void POLYBENCH_FLOYD_WARSHALL_ORIG::runSeqVariantBlocked(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_ORIG_DATA_SETUP;
+
+  const Index_type T = static_cast<Index_type>(tile_size);
+
+  auto poly_floydwarshallorig_tile_lam = [=](Index_type i0, Index_type j0,
+                                             Index_type k0) {
+    const Index_type iend = std::min(i0 + T, N);
+    const Index_type jend = std::min(j0 + T, N);
+    const Index_type kend = std::min(k0 + T, N);
+    for (Index_type k = k0; k < kend; ++k) {
+      for (Index_type i = i0; i < iend; ++i) {
+        for (Index_type j = j0; j < jend; ++j) {
+          POLYBENCH_FLOYD_WARSHALL_ORIG_BODY;
+        }
+      }
+    }
+  };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k0 = 0; k0 < N; k0 += T) {
+
+          poly_floydwarshallorig_tile_lam(k0, k0, k0);
+
+          for (Index_type b0 = 0; b0 < N; b0 += T) {
+            if (b0 != k0) {
+              poly_floydwarshallorig_tile_lam(k0, b0, k0);
+              poly_floydwarshallorig_tile_lam(b0, k0, k0);
+            }
+          }
+
+          for (Index_type i0 = 0; i0 < N; i0 += T) {
+            for (Index_type j0 = 0; j0 < N; j0 += T) {
+              if (i0 != k0 && j0 != k0) {
+                poly_floydwarshallorig_tile_lam(i0, j0, k0);
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_FLOYD_WARSHALL_ORIG::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    seq_for(configuration::cache_tile_sizes{}, [&](auto tile_size) {
+      if (tune_idx == t) {
+        runSeqVariantBlocked<tile_size>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void POLYBENCH_FLOYD_WARSHALL_ORIG::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    seq_for(configuration::cache_tile_sizes{}, [&](auto tile_size) {
+      addVariantTuningName(vid, "blocked_"+std::to_string(tile_size));
+    });
+
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FLOYD_WARSHALL_ORIG.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+POLYBENCH_FLOYD_WARSHALL_ORIG::POLYBENCH_FLOYD_WARSHALL_ORIG(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_FLOYD_WARSHALL_ORIG, params)
+{
+  Index_type N_default = 1000;
+
+  setDefaultProblemSize( N_default * N_default );
+  setDefaultReps(8);
+
+  m_N = std::sqrt( getTargetProblemSize() ) + 1;
+
+
+  setActualProblemSize( m_N * m_N );
+
+  setItsPerRep( m_N*m_N );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * m_N );
+  setFLOPsPerRep(1 * m_N*m_N*m_N );
+
+  checksum_scale_factor = 1.0 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+}
+
+POLYBENCH_FLOYD_WARSHALL_ORIG::~POLYBENCH_FLOYD_WARSHALL_ORIG()
+{
+}
+
+//
+// Integer path lengths as in the Polybench initialization, so all sums are
+// exact and every order of the k steps gives the same result.
+//
+void POLYBENCH_FLOYD_WARSHALL_ORIG::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocData(m_path, m_N*m_N, vid);
+  for (Index_type i = 0; i < m_N; ++i) {
+    for (Index_type j = 0; j < m_N; ++j) {
+      m_path[j + i*m_N] = ( (i+j)%13 == 0 || (i+j)%7 == 0 || (i+j)%11 == 0 )
+                            ? 999.0 : static_cast<Real_type>(i*j%7 + 1);
+    }
+    m_path[i + i*m_N] = 0.0;
+  }
+}
+
+void POLYBENCH_FLOYD_WARSHALL_ORIG::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_path, m_N*m_N, checksum_scale_factor , vid);
+}
+
+void POLYBENCH_FLOYD_WARSHALL_ORIG::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_path, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_FLOYD_WARSHALL_ORIG kernel reference implementation:
+///
+/// Note: original form of POLYBENCH_FLOYD_WARSHALL with a single array
+///       'path' updated in place, so each k step reads the results of the
+///       step before it.
+///
+/// for (Index_type k = 0; k < N; k++) {
+///   for (Index_type i = 0; i < N; i++) {
+///     for (Index_type j = 0; j < N; j++) {
+///       path[i][j] = path[i][j] < path[i][k] + path[k][j] ?
+///                    path[i][j] : path[i][k] + path[k][j];
+///     }
+///   }
+/// }
+///
+/// Path lengths are nonnegative, so row k and column k do not change in
+/// step k and the i and j loops of each step are parallel.
+///
+/// Blocked tunings split path into tiles of tile_size x tile_size. For each
+/// diagonal tile they run the k steps of that tile on the diagonal tile,
+/// then on the other tiles in its row and column, then on the remaining
+/// tiles, so each tile is updated tile_size times while it is in cache.
+/// The tile sizes are set by the CMake variable
+/// RAJA_PERFSUITE_CACHE_TILESIZES.
+///
+
+#ifndef RAJAPerf_POLYBENCH_FLOYD_WARSHALL_ORIG_HPP
+#define RAJAPerf_POLYBENCH_FLOYD_WARSHALL_ORIG_HPP
+
+#define POLYBENCH_FLOYD_WARSHALL_ORIG_DATA_SETUP \
+  Real_ptr path = m_path; \
+  const Index_type N = m_N;
+
+
+#define POLYBENCH_FLOYD_WARSHALL_ORIG_BODY \
+  path[j + i*N] = path[j + i*N] < path[k + i*N] + path[j + k*N] ? \
+                  path[j + i*N] : path[k + i*N] + path[j + k*N];
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_FLOYD_WARSHALL_ORIG : public KernelBase
+{
+public:
+
+  POLYBENCH_FLOYD_WARSHALL_ORIG(const RunParams& params);
+
+  ~POLYBENCH_FLOYD_WARSHALL_ORIG();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_ORIG : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_ORIG : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_ORIG : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t tile_size >
+  void runSeqVariantBlocked(VariantID vid);
+  template < size_t tile_size >
+  void runOpenMPVariantBlocked(VariantID vid);
+  template < size_t tile_size >
+  void runOpenMPVariantBlockedTask(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Index_type m_N;
+
+  Real_ptr m_path;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 #include <cstring>
 
@@ -20,7 +22,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_GEMVER::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -234,5 +236,109 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
 #endif
 }
 
+template < typename precision_helper >
+void POLYBENCH_GEMVER::runOpenMPVariantPrecision(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+  // the body macros declare their scalars as Real_type
+  using Real_type = compute_type;
+
+  const Index_type run_reps = getRunReps();
+
+  storage_type* A;
+  storage_type* u1;
+  storage_type* v1;
+  storage_type* u2;
+  storage_type* v2;
+  storage_type* w;
+  storage_type* x;
+  storage_type* y;
+  storage_type* z;
+  allocAndConvertData(A, m_A, m_n * m_n, vid);
+  allocAndConvertData(u1, m_u1, m_n, vid);
+  allocAndConvertData(v1, m_v1, m_n, vid);
+  allocAndConvertData(u2, m_u2, m_n, vid);
+  allocAndConvertData(v2, m_v2, m_n, vid);
+  allocAndConvertData(w, m_w, m_n, vid);
+  allocAndConvertData(x, m_x, m_n, vid);
+  allocAndConvertData(y, m_y, m_n, vid);
+  allocAndConvertData(z, m_z, m_n, vid);
+
+  compute_type alpha = m_alpha;
+  compute_type beta = m_beta;
+
+  const Index_type n = m_n;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; i++ ) {
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY1;
+          }
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; i++ ) {
+          POLYBENCH_GEMVER_BODY2;
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY3;
+          }
+          POLYBENCH_GEMVER_BODY4;
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; i++ ) {
+          POLYBENCH_GEMVER_BODY5;
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < n; i++ ) {
+          POLYBENCH_GEMVER_BODY6;
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY7;
+          }
+          POLYBENCH_GEMVER_BODY8;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GEMVER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_w, w, m_n);
+
+  deallocData(A, vid);
+  deallocData(u1, vid);
+  deallocData(v1, vid);
+  deallocData(u2, vid);
+  deallocData(v2, vid);
+  deallocData(w, vid);
+  deallocData(x, vid);
+  deallocData(y, vid);
+  deallocData(z, vid);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(POLYBENCH_GEMVER, OpenMP, Base_OpenMP)
+
 } // end namespace basic
 } // end namespace rajaperf
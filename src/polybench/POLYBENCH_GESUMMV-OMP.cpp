@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 
 
@@ -19,7 +21,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_GESUMMV::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -136,5 +138,73 @@ void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 #endif
 }
 
+template < typename precision_helper >
+void POLYBENCH_GESUMMV::runOpenMPVariantPrecision(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+  // the body macros declare their scalars as Real_type
+  using Real_type = compute_type;
+
+  const Index_type run_reps= getRunReps();
+
+  storage_type* x;
+  storage_type* y;
+  storage_type* A;
+  storage_type* B;
+  allocAndConvertData(x, m_x, m_N, vid);
+  allocAndConvertData(y, m_y, m_N, vid);
+  allocAndConvertData(A, m_A, m_N * m_N, vid);
+  allocAndConvertData(B, m_B, m_N * m_N, vid);
+
+  const Index_type N = m_N;
+
+  compute_type alpha = m_alpha;
+  compute_type beta = m_beta;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_GESUMMV_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_GESUMMV_BODY2;
+          }
+          POLYBENCH_GESUMMV_BODY3;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GESUMMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_y, y, m_N);
+
+  deallocData(x, vid);
+  deallocData(y, vid);
+  deallocData(A, vid);
+  deallocData(B, vid);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(POLYBENCH_GESUMMV, OpenMP, Base_OpenMP)
+
 } // end namespace polybench
 } // end namespace rajaperf
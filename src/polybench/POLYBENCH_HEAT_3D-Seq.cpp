@@ -10,6 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+#include "common/TemporalBlockingUtils.hpp"
+
 #include <iostream>
 
 
@@ -19,7 +22,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_HEAT_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_HEAT_3D::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
@@ -156,5 +159,165 @@ void POLYBENCH_HEAT_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
 }
 
+template < typename precision_helper >
+void POLYBENCH_HEAT_3D::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+
+  const Index_type run_reps= getRunReps();
+
+  storage_type* A;
+  storage_type* B;
+  allocAndConvertData(A, m_Ainit, m_N*m_N*m_N, vid);
+  allocAndConvertData(B, m_Binit, m_N*m_N*m_N, vid);
+
+  const Index_type N = m_N;
+  const Index_type tsteps = m_tsteps;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+
+          for (Index_type i = 1; i < N-1; ++i ) {
+            for (Index_type j = 1; j < N-1; ++j ) {
+              for (Index_type k = 1; k < N-1; ++k ) {
+                POLYBENCH_HEAT_3D_BODY1_PRECISION;
+              }
+            }
+          }
+
+          for (Index_type i = 1; i < N-1; ++i ) {
+            for (Index_type j = 1; j < N-1; ++j ) {
+              for (Index_type k = 1; k < N-1; ++k ) {
+                POLYBENCH_HEAT_3D_BODY2_PRECISION;
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_HEAT_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_A, A, m_N*m_N*m_N);
+  convertData(m_B, B, m_N*m_N*m_N);
+
+  deallocData(A, vid);
+  deallocData(B, vid);
+}
+
+template < typename tiling_helper >
+void POLYBENCH_HEAT_3D::runSeqVariantTemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_HEAT_3D_DATA_SETUP;
+
+  const Index_type sweeps_per_tile = 2 * tiling_helper::time_tile_depth;
+
+  //
+  // Sweep s computes B from A when s is even, and A from B when s is odd.
+  //
+  auto poly_heat3d_sweep = [=](Index_type s, Index_type ibegin, Index_type iend) {
+    if (s % 2 == 0) {
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Index_type j = 1; j < N-1; ++j ) {
+          for (Index_type k = 1; k < N-1; ++k ) {
+            POLYBENCH_HEAT_3D_BODY1;
+          }
+        }
+      }
+    } else {
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Index_type j = 1; j < N-1; ++j ) {
+          for (Index_type k = 1; k < N-1; ++k ) {
+            POLYBENCH_HEAT_3D_BODY2;
+          }
+        }
+      }
+    }
+  };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tiling_helper::runSeq(1, N-1, 2*tsteps, sweeps_per_tile,
+                              2*N*N*sizeof(Real_type), poly_heat3d_sweep);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_HEAT_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void POLYBENCH_HEAT_3D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    runPrecisionTunings(tune_idx, t, [&](auto precision_helper) {
+      runSeqVariantPrecision<decltype(precision_helper)>(vid);
+    });
+
+    seq_for(temporal_tiling_helpers{}, [&](auto tiling_helper) {
+      if (tune_idx == t) {
+        runSeqVariantTemporal<decltype(tiling_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void POLYBENCH_HEAT_3D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+
+    addPrecisionTuningDefinitions(*this, vid);
+
+    seq_for(temporal_tiling_helpers{}, [&](auto tiling_helper) {
+      addVariantTuningName(vid, decltype(tiling_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
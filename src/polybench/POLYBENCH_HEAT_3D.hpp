@@ -61,6 +61,16 @@
                            A[k-1 + N*(j + N*i)] ) + \
                    A[k + N*(j + N*i)];
 
+#define POLYBENCH_HEAT_3D_BODY1_PRECISION \
+  B[k + N*(j + N*i)] = \
+                   compute_type(0.125)*( A[k + N*(j + N*(i+1))] - compute_type(2.0)*A[k + N*(j + N*i)] + \
+                           A[k + N*(j + N*(i-1))] ) + \
+                   compute_type(0.125)*( A[k + N*(j+1 + N*i)]   - compute_type(2.0)*A[k + N*(j + N*i)] + \
+                           A[k + N*(j-1 + N*i)] ) + \
+                   compute_type(0.125)*( A[k+1 + N*(j + N*i)]   - compute_type(2.0)*A[k + N*(j + N*i)] + \
+                           A[k-1 + N*(j + N*i)] ) + \
+                   A[k + N*(j + N*i)];
+
 #define POLYBENCH_HEAT_3D_BODY2 \
   A[k + N*(j + N*i)] = \
                    0.125*( B[k + N*(j + N*(i+1))] - 2.0*B[k + N*(j + N*i)] + \
@@ -71,6 +81,16 @@
                            B[k-1 + N*(j + N*i)] ) + \
                    B[k + N*(j + N*i)];
 
+#define POLYBENCH_HEAT_3D_BODY2_PRECISION \
+  A[k + N*(j + N*i)] = \
+                   compute_type(0.125)*( B[k + N*(j + N*(i+1))] - compute_type(2.0)*B[k + N*(j + N*i)] + \
+                           B[k + N*(j + N*(i-1))] ) + \
+                   compute_type(0.125)*( B[k + N*(j+1 + N*i)]   - compute_type(2.0)*B[k + N*(j + N*i)] + \
+                           B[k + N*(j-1 + N*i)] ) + \
+                   compute_type(0.125)*( B[k+1 + N*(j + N*i)]   - compute_type(2.0)*B[k + N*(j + N*i)] + \
+                           B[k-1 + N*(j + N*i)] ) + \
+                   B[k + N*(j + N*i)];
+
 
 #define POLYBENCH_HEAT_3D_BODY1_RAJA \
   Bview(i,j,k) = \
@@ -123,6 +143,19 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename precision_helper >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename precision_helper >
+  void runOpenMPVariantPrecision(VariantID vid);
+  template < typename tiling_helper >
+  void runSeqVariantTemporal(VariantID vid);
+  template < typename tiling_helper >
+  void runOpenMPVariantTemporal(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -10,6 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+#include "common/TemporalBlockingUtils.hpp"
+
 #include <iostream>
 
 
@@ -19,7 +22,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_JACOBI_1D::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -118,5 +121,162 @@ void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED
 #endif
 }
 
+template < typename precision_helper >
+void POLYBENCH_JACOBI_1D::runOpenMPVariantPrecision(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+
+  const Index_type run_reps= getRunReps();
+
+  storage_type* A;
+  storage_type* B;
+  allocAndConvertData(A, m_Ainit, m_N, vid);
+  allocAndConvertData(B, m_Binit, m_N, vid);
+
+  const Index_type N = m_N;
+  const Index_type tsteps = m_tsteps;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+
+          #pragma omp parallel for
+          for (Index_type i = 1; i < N-1; ++i ) {
+            POLYBENCH_JACOBI_1D_BODY1_PRECISION;
+          }
+          #pragma omp parallel for
+          for (Index_type i = 1; i < N-1; ++i ) {
+            POLYBENCH_JACOBI_1D_BODY2_PRECISION;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_JACOBI_1D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_A, A, m_N);
+  convertData(m_B, B, m_N);
+
+  deallocData(A, vid);
+  deallocData(B, vid);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < typename tiling_helper >
+void POLYBENCH_JACOBI_1D::runOpenMPVariantTemporal(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_JACOBI_1D_DATA_SETUP;
+
+  const Index_type sweeps_per_tile = 2 * tiling_helper::time_tile_depth;
+
+  //
+  // Sweep s computes B from A when s is even, and A from B when s is odd.
+  //
+  auto poly_jacobi1d_sweep = [=](Index_type s, Index_type ibegin, Index_type iend) {
+    if (s % 2 == 0) {
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        POLYBENCH_JACOBI_1D_BODY1;
+      }
+    } else {
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        POLYBENCH_JACOBI_1D_BODY2;
+      }
+    }
+  };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        tiling_helper::runOpenMP(1, N-1, 2*tsteps, sweeps_per_tile,
+                                 2*sizeof(Real_type), poly_jacobi1d_sweep);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_JACOBI_1D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    runPrecisionTunings(tune_idx, t, [&](auto precision_helper) {
+      runOpenMPVariantPrecision<decltype(precision_helper)>(vid);
+    });
+
+    seq_for(temporal_tiling_helpers{}, [&](auto tiling_helper) {
+      if (tune_idx == t) {
+        runOpenMPVariantTemporal<decltype(tiling_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void POLYBENCH_JACOBI_1D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    addPrecisionTuningDefinitions(*this, vid);
+
+    seq_for(temporal_tiling_helpers{}, [&](auto tiling_helper) {
+      addVariantTuningName(vid, decltype(tiling_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -37,9 +37,15 @@
 #define POLYBENCH_JACOBI_1D_BODY1 \
   B[i] = 0.33333 * (A[i-1] + A[i] + A[i + 1]);
 
+#define POLYBENCH_JACOBI_1D_BODY1_PRECISION \
+  B[i] = compute_type(0.33333) * (A[i-1] + A[i] + A[i + 1]);
+
 #define POLYBENCH_JACOBI_1D_BODY2 \
   A[i] = 0.33333 * (B[i-1] + B[i] + B[i + 1]);
 
+#define POLYBENCH_JACOBI_1D_BODY2_PRECISION \
+  A[i] = compute_type(0.33333) * (B[i-1] + B[i] + B[i + 1]);
+
 
 #include "common/KernelBase.hpp"
 
@@ -69,6 +75,19 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename precision_helper >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename precision_helper >
+  void runOpenMPVariantPrecision(VariantID vid);
+  template < typename tiling_helper >
+  void runSeqVariantTemporal(VariantID vid);
+  template < typename tiling_helper >
+  void runOpenMPVariantTemporal(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -41,9 +41,15 @@
 #define POLYBENCH_JACOBI_2D_BODY1 \
   B[j + i*N] = 0.2 * (A[j + i*N] + A[j-1 + i*N] + A[j+1 + i*N] + A[j + (i+1)*N] + A[j + (i-1)*N]);
 
+#define POLYBENCH_JACOBI_2D_BODY1_PRECISION \
+  B[j + i*N] = compute_type(0.2) * (A[j + i*N] + A[j-1 + i*N] + A[j+1 + i*N] + A[j + (i+1)*N] + A[j + (i-1)*N]);
+
 #define POLYBENCH_JACOBI_2D_BODY2 \
   A[j + i*N] = 0.2 * (B[j + i*N] + B[j-1 + i*N] + B[j+1 + i*N] + B[j + (i+1)*N] + B[j + (i-1)*N]);
 
+#define POLYBENCH_JACOBI_2D_BODY2_PRECISION \
+  A[j + i*N] = compute_type(0.2) * (B[j + i*N] + B[j-1 + i*N] + B[j+1 + i*N] + B[j + (i+1)*N] + B[j + (i-1)*N]);
+
 
 #define POLYBENCH_JACOBI_2D_BODY1_RAJA \
   Bview(i,j) = 0.2 * (Aview(i,j) + Aview(i,j-1) + Aview(i,j+1) + Aview(i+1,j) + Aview(i-1,j));
@@ -88,6 +94,19 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename precision_helper >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename precision_helper >
+  void runOpenMPVariantPrecision(VariantID vid);
+  template < typename tiling_helper >
+  void runSeqVariantTemporal(VariantID vid);
+  template < typename tiling_helper >
+  void runOpenMPVariantTemporal(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
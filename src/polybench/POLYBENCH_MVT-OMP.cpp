@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 
 
@@ -19,7 +21,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_MVT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_MVT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -194,5 +196,88 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+template < typename precision_helper >
+void POLYBENCH_MVT::runOpenMPVariantPrecision(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+  // the body macros declare their scalars as Real_type
+  using Real_type = compute_type;
+
+  const Index_type run_reps= getRunReps();
+
+  storage_type* x1;
+  storage_type* x2;
+  storage_type* y1;
+  storage_type* y2;
+  storage_type* A;
+  allocAndConvertData(x1, m_x1, m_N, vid);
+  allocAndConvertData(x2, m_x2, m_N, vid);
+  allocAndConvertData(y1, m_y1, m_N, vid);
+  allocAndConvertData(y2, m_y2, m_N, vid);
+  allocAndConvertData(A, m_A, m_N * m_N, vid);
+
+  const Index_type N = m_N;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_MVT_BODY1;
+            for (Index_type j = 0; j < N; ++j ) {
+              POLYBENCH_MVT_BODY2;
+            }
+            POLYBENCH_MVT_BODY3;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_MVT_BODY4;
+            for (Index_type j = 0; j < N; ++j ) {
+              POLYBENCH_MVT_BODY5;
+            }
+            POLYBENCH_MVT_BODY6;
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_MVT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_x1, x1, m_N);
+  convertData(m_x2, x2, m_N);
+
+  deallocData(x1, vid);
+  deallocData(x2, vid);
+  deallocData(y1, vid);
+  deallocData(y2, vid);
+  deallocData(A, vid);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(POLYBENCH_MVT, OpenMP, Base_OpenMP)
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+
 #include <iostream>
 
 
@@ -19,7 +21,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_MVT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_MVT::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
@@ -178,5 +180,75 @@ void POLYBENCH_MVT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+template < typename precision_helper >
+void POLYBENCH_MVT::runSeqVariantPrecision(VariantID vid)
+{
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+  // the body macros declare their scalars as Real_type
+  using Real_type = compute_type;
+
+  const Index_type run_reps= getRunReps();
+
+  storage_type* x1;
+  storage_type* x2;
+  storage_type* y1;
+  storage_type* y2;
+  storage_type* A;
+  allocAndConvertData(x1, m_x1, m_N, vid);
+  allocAndConvertData(x2, m_x2, m_N, vid);
+  allocAndConvertData(y1, m_y1, m_N, vid);
+  allocAndConvertData(y2, m_y2, m_N, vid);
+  allocAndConvertData(A, m_A, m_N * m_N, vid);
+
+  const Index_type N = m_N;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_MVT_BODY1;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_MVT_BODY2;
+          }
+          POLYBENCH_MVT_BODY3;
+        }
+
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_MVT_BODY4;
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_MVT_BODY5;
+          }
+          POLYBENCH_MVT_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_MVT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  convertData(m_x1, x1, m_N);
+  convertData(m_x2, x2, m_N);
+
+  deallocData(x1, vid);
+  deallocData(x2, vid);
+  deallocData(y1, vid);
+  deallocData(y2, vid);
+  deallocData(A, vid);
+}
+
+RAJAPERF_PRECISION_TUNING_DEFINE_BOILERPLATE(POLYBENCH_MVT, Seq, Base_Seq)
+
 } // end namespace polybench
 } // end namespace rajaperf
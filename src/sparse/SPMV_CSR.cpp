@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV_CSR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+#include "SparseData.hpp"
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+
+SPMV_CSR::SPMV_CSR(const RunParams& params)
+  : KernelBase(rajaperf::Sparse_SPMV_CSR, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_matrix = params.getSparseMatrix();
+  getSparseMatrixSize(m_matrix, getTargetProblemSize(), m_num_rows, m_nnz);
+
+  setActualProblemSize( m_num_rows );
+
+  setItsPerRep( m_num_rows );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Index_type) + 1*sizeof(Index_type)) * (m_num_rows+1) +
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * m_nnz +
+                  (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * m_nnz +
+                  (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * m_num_rows +
+                  (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * m_num_rows );
+  setFLOPsPerRep(2 * m_nnz);
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+SPMV_CSR::~SPMV_CSR()
+{
+}
+
+void SPMV_CSR::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocData(m_row_ptr, m_num_rows+1, vid);
+  allocData(m_cols, m_nnz, vid);
+  allocData(m_vals, m_nnz, vid);
+  setSparseMatrixCSR(m_matrix, getTargetProblemSize(), m_row_ptr, m_cols, m_vals);
+
+  allocAndInitData(m_x, m_num_rows, vid);
+  allocAndInitDataConst(m_y, m_num_rows, 0.0, vid);
+}
+
+void SPMV_CSR::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_num_rows, vid);
+}
+
+void SPMV_CSR::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_row_ptr, vid);
+  deallocData(m_cols, vid);
+  deallocData(m_vals, vid);
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SPMV_CSR kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   Real_type dot = 0.0;
+///   for (Index_type k = row_ptr[i]; k < row_ptr[i+1]; ++k ) {
+///     dot += vals[k] * x[cols[k]];
+///   }
+///   y[i] = dot;
+/// }
+///
+/// y = A x with A in compressed sparse row (CSR) format, the matrix set by
+/// --sparse_matrix (see sparse/SparseData.hpp).
+///
+
+#ifndef RAJAPerf_Sparse_SPMV_CSR_HPP
+#define RAJAPerf_Sparse_SPMV_CSR_HPP
+
+#define SPMV_CSR_DATA_SETUP \
+  Index_ptr row_ptr = m_row_ptr; \
+  Index_ptr cols = m_cols; \
+  Real_ptr vals = m_vals; \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y;
+
+#define SPMV_CSR_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = row_ptr[i]; k < row_ptr[i+1]; ++k ) { \
+    dot += vals[k] * x[cols[k]]; \
+  } \
+  y[i] = dot;
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace sparse
+{
+
+class SPMV_CSR : public KernelBase
+{
+public:
+
+  SPMV_CSR(const RunParams& params);
+
+  ~SPMV_CSR();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_CSR : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_CSR : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_CSR : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  std::string m_matrix;
+  Index_type m_num_rows;
+  Index_type m_nnz;
+
+  Index_ptr m_row_ptr;
+  Index_ptr m_cols;
+  Real_ptr m_vals;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
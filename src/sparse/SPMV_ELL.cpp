@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV_ELL.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+#include "SparseData.hpp"
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+
+SPMV_ELL::SPMV_ELL(const RunParams& params)
+  : KernelBase(rajaperf::Sparse_SPMV_ELL, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_matrix = params.getSparseMatrix();
+  getSparseMatrixSize(m_matrix, getTargetProblemSize(), m_num_rows, m_nnz);
+
+  setActualProblemSize( m_num_rows );
+
+  setItsPerRep( m_num_rows );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Index_type) + 1*sizeof(Index_type)) * m_nnz +
+                  (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * m_nnz +
+                  (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * m_num_rows +
+                  (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * m_num_rows );
+  setFLOPsPerRep(2 * m_nnz);
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+SPMV_ELL::~SPMV_ELL()
+{
+}
+
+void SPMV_ELL::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  Index_ptr row_ptr;
+  Index_ptr csr_cols;
+  Real_ptr csr_vals;
+  allocData(row_ptr, m_num_rows+1, vid);
+  allocData(csr_cols, m_nnz, vid);
+  allocData(csr_vals, m_nnz, vid);
+  setSparseMatrixCSR(m_matrix, getTargetProblemSize(), row_ptr, csr_cols, csr_vals);
+
+  m_width = getMaxRowLength(row_ptr, m_num_rows);
+  allocData(m_cols, m_num_rows * m_width, vid);
+  allocData(m_vals, m_num_rows * m_width, vid);
+  setEllFromCSR(row_ptr, csr_cols, csr_vals, m_num_rows, m_width, m_cols, m_vals);
+
+  deallocData(row_ptr, vid);
+  deallocData(csr_cols, vid);
+  deallocData(csr_vals, vid);
+
+  allocAndInitData(m_x, m_num_rows, vid);
+  allocAndInitDataConst(m_y, m_num_rows, 0.0, vid);
+}
+
+void SPMV_ELL::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_num_rows, vid);
+}
+
+void SPMV_ELL::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_cols, vid);
+  deallocData(m_vals, vid);
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
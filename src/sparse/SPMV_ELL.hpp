@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SPMV_ELL kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   Real_type dot = 0.0;
+///   for (Index_type k = 0; k < width; ++k ) {
+///     dot += vals[i + k*num_rows] * x[cols[i + k*num_rows]];
+///   }
+///   y[i] = dot;
+/// }
+///
+/// y = A x with A in ELLPACK format, every row padded to width, the length
+/// of the longest row, and stored column by column, the matrix set by
+/// --sparse_matrix (see sparse/SparseData.hpp).
+///
+/// The bytes per rep count the entries without padding, as for SPMV_CSR
+/// without the row offsets, so the bandwidth report shows the cost of the
+/// padding.
+///
+
+#ifndef RAJAPerf_Sparse_SPMV_ELL_HPP
+#define RAJAPerf_Sparse_SPMV_ELL_HPP
+
+#define SPMV_ELL_DATA_SETUP \
+  Index_type num_rows = m_num_rows; \
+  Index_type width = m_width; \
+  Index_ptr cols = m_cols; \
+  Real_ptr vals = m_vals; \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y;
+
+#define SPMV_ELL_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = 0; k < width; ++k ) { \
+    dot += vals[i + k*num_rows] * x[cols[i + k*num_rows]]; \
+  } \
+  y[i] = dot;
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace sparse
+{
+
+class SPMV_ELL : public KernelBase
+{
+public:
+
+  SPMV_ELL(const RunParams& params);
+
+  ~SPMV_ELL();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_ELL : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_ELL : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_ELL : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  std::string m_matrix;
+  Index_type m_num_rows;
+  Index_type m_nnz;
+  Index_type m_width;
+
+  Index_ptr m_cols;
+  Real_ptr m_vals;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+};
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
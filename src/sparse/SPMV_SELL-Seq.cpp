@@ -0,0 +1,95 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV_SELL.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "SparseData.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+
+template < typename SellHelper >
+void SPMV_SELL::runSeqVariantSell(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  constexpr Index_type chunk_size = SellHelper::chunk_size;
+  const Index_type cbegin = 0;
+  const Index_type cend = getSellNumChunks(m_num_rows, chunk_size);
+
+  SPMV_SELL_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = cbegin; c < cend; ++c ) {
+          SPMV_SELL_BODY(chunk_size);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(cbegin, cend), [=](Index_type c) {
+          SPMV_SELL_BODY(chunk_size);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  SPMV_SELL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void SPMV_SELL::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(sell_helpers{}, [&](auto helper) {
+    if (tune_idx == t) {
+      runSeqVariantSell<decltype(helper)>(vid);
+    }
+    t += 1;
+  });
+}
+
+void SPMV_SELL::setSeqTuningDefinitions(VariantID vid)
+{
+  seq_for(sell_helpers{}, [&](auto helper) {
+    addVariantTuningName(vid, decltype(helper)::get_name());
+  });
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV_SELL.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+#include "SparseData.hpp"
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+
+SPMV_SELL::SPMV_SELL(const RunParams& params)
+  : KernelBase(rajaperf::Sparse_SPMV_SELL, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_matrix = params.getSparseMatrix();
+  getSparseMatrixSize(m_matrix, getTargetProblemSize(), m_num_rows, m_nnz);
+
+  setActualProblemSize( m_num_rows );
+
+  setItsPerRep( m_num_rows );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Index_type) + 1*sizeof(Index_type)) * m_nnz +
+                  (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * m_nnz +
+                  (0*sizeof(Real_type)  + 1*sizeof(Real_type) ) * m_num_rows +
+                  (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * m_num_rows );
+  setFLOPsPerRep(2 * m_nnz);
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+SPMV_SELL::~SPMV_SELL()
+{
+}
+
+void SPMV_SELL::setUp(VariantID vid, size_t tune_idx)
+{
+  allocData(m_row_ptr, m_num_rows+1, vid);
+  allocData(m_csr_cols, m_nnz, vid);
+  allocData(m_csr_vals, m_nnz, vid);
+  setSparseMatrixCSR(m_matrix, getTargetProblemSize(), m_row_ptr, m_csr_cols, m_csr_vals);
+
+  // every variant has the same tunings, one per sell helper
+  size_t t = 0;
+  seq_for(sell_helpers{}, [&](auto helper) {
+    if (tune_idx == t) {
+      setUpSell(decltype(helper)::chunk_size, decltype(helper)::sigma, vid);
+    }
+    t += 1;
+  });
+
+  allocAndInitData(m_x, m_num_rows, vid);
+  allocAndInitDataConst(m_y, m_num_rows, 0.0, vid);
+}
+
+void SPMV_SELL::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, m_num_rows, vid);
+}
+
+void SPMV_SELL::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_row_ptr, vid);
+  deallocData(m_csr_cols, vid);
+  deallocData(m_csr_vals, vid);
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+  tearDownSell(vid);
+}
+
+void SPMV_SELL::setUpSell(Index_type chunk_size, Index_type sigma, VariantID vid)
+{
+  const Index_type num_chunks = getSellNumChunks(m_num_rows, chunk_size);
+
+  allocData(m_perm, num_chunks * chunk_size, vid);
+  allocData(m_chunk_ptr, num_chunks+1, vid);
+  const Index_type sell_nnz = setSellLayout(m_row_ptr, m_num_rows, chunk_size, sigma,
+                                            m_perm, m_chunk_ptr);
+
+  allocData(m_cols, sell_nnz, vid);
+  allocData(m_vals, sell_nnz, vid);
+  setSellFromCSR(m_row_ptr, m_csr_cols, m_csr_vals, m_num_rows, chunk_size,
+                 m_perm, m_chunk_ptr, m_cols, m_vals);
+}
+
+void SPMV_SELL::tearDownSell(VariantID vid)
+{
+  deallocData(m_perm, vid);
+  deallocData(m_chunk_ptr, vid);
+  deallocData(m_cols, vid);
+  deallocData(m_vals, vid);
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
@@ -0,0 +1,142 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SPMV_SELL kernel reference implementation:
+///
+/// for (Index_type c = cbegin; c < cend; ++c ) {
+///   Real_type dot[chunk_size] = {0.0};
+///   Index_type width = (chunk_ptr[c+1] - chunk_ptr[c]) / chunk_size;
+///   for (Index_type k = 0; k < width; ++k ) {
+///     for (Index_type r = 0; r < chunk_size; ++r ) {
+///       Index_type e = chunk_ptr[c] + k*chunk_size + r;
+///       dot[r] += vals[e] * x[cols[e]];
+///     }
+///   }
+///   for (Index_type r = 0; r < chunk_size; ++r ) {
+///     Index_type row = perm[c*chunk_size + r];
+///     if (row >= 0) y[row] = dot[r];
+///   }
+/// }
+///
+/// y = A x with A in SELL-C-sigma format, the matrix set by --sparse_matrix
+/// (see sparse/SparseData.hpp). The inner loop over the rows of a chunk
+/// has a fixed length and unit stride, so it vectorizes.
+///
+/// Each tuning, named C<chunk_size>_sigma<sigma>, builds the matrix for
+/// its chunk size and sort window before timing. Sigma 1 keeps the rows in
+/// order, so the chunks are padded to their longest row, and larger sigma
+/// groups rows of similar length at the cost of scattered writes of y.
+///
+/// The bytes per rep count the entries without padding, as for SPMV_ELL.
+///
+
+#ifndef RAJAPerf_Sparse_SPMV_SELL_HPP
+#define RAJAPerf_Sparse_SPMV_SELL_HPP
+
+#define SPMV_SELL_DATA_SETUP \
+  Index_ptr perm = m_perm; \
+  Index_ptr chunk_ptr = m_chunk_ptr; \
+  Index_ptr cols = m_cols; \
+  Real_ptr vals = m_vals; \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y;
+
+#define SPMV_SELL_BODY(chunk_size) \
+  Real_type dot[chunk_size]; \
+  for (Index_type r = 0; r < chunk_size; ++r ) { \
+    dot[r] = 0.0; \
+  } \
+  const Index_type width = (chunk_ptr[c+1] - chunk_ptr[c]) / chunk_size; \
+  for (Index_type k = 0; k < width; ++k ) { \
+    const Index_type e0 = chunk_ptr[c] + k*chunk_size; \
+    for (Index_type r = 0; r < chunk_size; ++r ) { \
+      dot[r] += vals[e0 + r] * x[cols[e0 + r]]; \
+    } \
+  } \
+  for (Index_type r = 0; r < chunk_size; ++r ) { \
+    const Index_type row = perm[c*chunk_size + r]; \
+    if (row >= 0) { \
+      y[row] = dot[r]; \
+    } \
+  }
+
+#include "common/KernelBase.hpp"
+
+#include "SparseData.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace sparse
+{
+
+class SPMV_SELL : public KernelBase
+{
+public:
+
+  SPMV_SELL(const RunParams& params);
+
+  ~SPMV_SELL();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_SELL : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_SELL : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV_SELL : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename SellHelper >
+  void runSeqVariantSell(VariantID vid);
+  template < typename SellHelper >
+  void runOpenMPVariantSell(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  std::string m_matrix;
+  Index_type m_num_rows;
+  Index_type m_nnz;
+
+  Index_ptr m_row_ptr;
+  Index_ptr m_csr_cols;
+  Real_ptr m_csr_vals;
+
+  Index_ptr m_perm;
+  Index_ptr m_chunk_ptr;
+  Index_ptr m_cols;
+  Real_ptr m_vals;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+
+  void setUpSell(Index_type chunk_size, Index_type sigma, VariantID vid);
+  void tearDownSell(VariantID vid);
+};
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,225 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SparseData.hpp"
+
+#include "apps/AppsData.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+namespace
+{
+
+//
+// Number of zones on each side of the ADomain grid with about
+// target_rows zones.
+//
+Index_type getLaplaceGridSize(Index_type target_rows)
+{
+  Index_type rzmax = std::cbrt(target_rows)+1;
+  apps::ADomain domain(rzmax, /* ndims = */ 3);
+  return domain.imax - domain.imin;
+}
+
+//
+// Set the CSR arrays of the Laplacian on an n^3 grid, with the 27 point
+// stencil if full is true and the 7 point stencil otherwise. Neighbors
+// outside the grid are dropped.
+//
+void setLaplaceCSR(Index_type n, bool full,
+                   Index_ptr row_ptr, Index_ptr cols, Real_ptr vals)
+{
+  const Real_type diag = full ? 26.0 : 6.0;
+
+  Index_type nz = 0;
+  for (Index_type k = 0; k < n; ++k) {
+    for (Index_type j = 0; j < n; ++j) {
+      for (Index_type i = 0; i < n; ++i) {
+        const Index_type row = i + n * (j + n * k);
+        row_ptr[row] = nz;
+
+        for (Index_type dk = -1; dk <= 1; ++dk) {
+          for (Index_type dj = -1; dj <= 1; ++dj) {
+            for (Index_type di = -1; di <= 1; ++di) {
+              const Index_type num_offsets = std::abs(di) + std::abs(dj) + std::abs(dk);
+              if ( !full && num_offsets > 1 ) {
+                continue;
+              }
+              const Index_type ii = i + di;
+              const Index_type jj = j + dj;
+              const Index_type kk = k + dk;
+              if ( ii < 0 || ii >= n || jj < 0 || jj >= n || kk < 0 || kk >= n ) {
+                continue;
+              }
+              cols[nz] = ii + n * (jj + n * kk);
+              vals[nz] = (num_offsets == 0) ? diag : -1.0;
+              ++nz;
+            }
+          }
+        }
+      }
+    }
+  }
+  row_ptr[n * n * n] = nz;
+}
+
+//
+// Set the CSR arrays of a random graph with row_nnz entries in each row,
+// the diagonal and row_nnz - 1 distinct random columns.
+//
+void setRandomCSR(Index_type num_rows, Index_type row_nnz,
+                  Index_ptr row_ptr, Index_ptr cols, Real_ptr vals)
+{
+  srand(4793);
+
+  std::vector<Index_type> row_cols;
+  for (Index_type row = 0; row < num_rows; ++row) {
+    row_ptr[row] = row * row_nnz;
+
+    row_cols.assign(1, row);
+    while ( static_cast<Index_type>(row_cols.size()) < row_nnz ) {
+      const Real_type u = static_cast<Real_type>(rand()) / (RAND_MAX + 1.0);
+      const Index_type col = static_cast<Index_type>(u * num_rows);
+      if ( std::find(row_cols.begin(), row_cols.end(), col) == row_cols.end() ) {
+        row_cols.push_back(col);
+      }
+    }
+    std::sort(row_cols.begin(), row_cols.end());
+
+    for (Index_type k = 0; k < row_nnz; ++k) {
+      cols[row * row_nnz + k] = row_cols[k];
+      vals[row * row_nnz + k] = (row_cols[k] == row) ? Real_type(row_nnz) : -1.0;
+    }
+  }
+  row_ptr[num_rows] = num_rows * row_nnz;
+}
+
+} // end anonymous namespace
+
+
+void getSparseMatrixSize(const std::string& kind, Index_type target_rows,
+                         Index_type& num_rows, Index_type& nnz)
+{
+  if ( kind == "random" ) {
+
+    num_rows = std::max(target_rows, sparse_random_row_nnz);
+    nnz = num_rows * sparse_random_row_nnz;
+
+  } else {
+
+    const Index_type n = getLaplaceGridSize(target_rows);
+    num_rows = n * n * n;
+    if ( kind == "laplace27" ) {
+      nnz = (3*n - 2) * (3*n - 2) * (3*n - 2);
+    } else {
+      nnz = n * n * n + 6 * (n - 1) * n * n;
+    }
+
+  }
+}
+
+void setSparseMatrixCSR(const std::string& kind, Index_type target_rows,
+                        Index_ptr row_ptr, Index_ptr cols, Real_ptr vals)
+{
+  if ( kind == "random" ) {
+    setRandomCSR(std::max(target_rows, sparse_random_row_nnz),
+                 sparse_random_row_nnz, row_ptr, cols, vals);
+  } else {
+    setLaplaceCSR(getLaplaceGridSize(target_rows), kind == "laplace27",
+                  row_ptr, cols, vals);
+  }
+}
+
+Index_type getMaxRowLength(Index_ptr row_ptr, Index_type num_rows)
+{
+  Index_type width = 0;
+  for (Index_type row = 0; row < num_rows; ++row) {
+    width = std::max(width, row_ptr[row+1] - row_ptr[row]);
+  }
+  return width;
+}
+
+void setEllFromCSR(Index_ptr row_ptr, Index_ptr cols, Real_ptr vals,
+                   Index_type num_rows, Index_type width,
+                   Index_ptr ell_cols, Real_ptr ell_vals)
+{
+  for (Index_type row = 0; row < num_rows; ++row) {
+    const Index_type len = row_ptr[row+1] - row_ptr[row];
+    for (Index_type k = 0; k < width; ++k) {
+      ell_cols[row + k * num_rows] = (k < len) ? cols[row_ptr[row] + k] : row;
+      ell_vals[row + k * num_rows] = (k < len) ? vals[row_ptr[row] + k] : 0.0;
+    }
+  }
+}
+
+Index_type setSellLayout(Index_ptr row_ptr, Index_type num_rows,
+                         Index_type chunk_size, Index_type sigma,
+                         Index_ptr perm, Index_ptr chunk_ptr)
+{
+  const Index_type num_chunks = getSellNumChunks(num_rows, chunk_size);
+
+  for (Index_type r = 0; r < num_chunks * chunk_size; ++r) {
+    perm[r] = (r < num_rows) ? r : -1;
+  }
+
+  auto row_len = [=](Index_type row) {
+    return row_ptr[row+1] - row_ptr[row];
+  };
+
+  for (Index_type wbegin = 0; wbegin < num_rows; wbegin += sigma) {
+    const Index_type wend = std::min(wbegin + sigma, num_rows);
+    std::stable_sort(perm + wbegin, perm + wend, [&](Index_type a, Index_type b) {
+      return row_len(a) > row_len(b);
+    });
+  }
+
+  chunk_ptr[0] = 0;
+  for (Index_type c = 0; c < num_chunks; ++c) {
+    Index_type width = 0;
+    for (Index_type r = c * chunk_size; r < (c+1) * chunk_size; ++r) {
+      if (perm[r] >= 0) {
+        width = std::max(width, row_len(perm[r]));
+      }
+    }
+    chunk_ptr[c+1] = chunk_ptr[c] + width * chunk_size;
+  }
+
+  return chunk_ptr[num_chunks];
+}
+
+void setSellFromCSR(Index_ptr row_ptr, Index_ptr cols, Real_ptr vals,
+                    Index_type num_rows, Index_type chunk_size,
+                    Index_ptr perm, Index_ptr chunk_ptr,
+                    Index_ptr sell_cols, Real_ptr sell_vals)
+{
+  const Index_type num_chunks = getSellNumChunks(num_rows, chunk_size);
+
+  for (Index_type c = 0; c < num_chunks; ++c) {
+    const Index_type width = (chunk_ptr[c+1] - chunk_ptr[c]) / chunk_size;
+    for (Index_type r = 0; r < chunk_size; ++r) {
+      const Index_type row = perm[c * chunk_size + r];
+      const Index_type len = (row >= 0) ? row_ptr[row+1] - row_ptr[row] : 0;
+      for (Index_type k = 0; k < width; ++k) {
+        const Index_type e = chunk_ptr[c] + k * chunk_size + r;
+        sell_cols[e] = (k < len) ? cols[row_ptr[row] + k] : ((row >= 0) ? row : 0);
+        sell_vals[e] = (k < len) ? vals[row_ptr[row] + k] : 0.0;
+      }
+    }
+  }
+}
+
+} // end namespace sparse
+} // end namespace rajaperf
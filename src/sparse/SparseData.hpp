@@ -0,0 +1,135 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-24, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Matrices and storage formats shared by the Sparse kernels.
+///
+/// Matrices are generated in compressed sparse row (CSR) format, with the
+/// columns of each row in increasing order. The --sparse_matrix option
+/// selects the matrix,
+///
+///   laplace7   7 point Laplacian on the zones of a 3d ADomain grid, with
+///              zero boundary values
+///   laplace27  27 point Laplacian on the same grid
+///   random     random graph, each row holds the diagonal and
+///              sparse_random_row_nnz - 1 other columns chosen at random
+///
+/// The other formats are built from the CSR matrix,
+///
+///   ELL        ELLPACK, every row padded to the length of the longest row,
+///              stored column by column so consecutive rows are contiguous
+///   SELL-C-s   sliced ELLPACK, rows sorted by length within windows of
+///              sigma rows, then grouped in chunks of C rows, each stored
+///              as ELLPACK padded to the longest row of the chunk
+///
+/// Padding entries have value 0 and the column of their row.
+///
+
+#ifndef RAJAPerf_SparseData_HPP
+#define RAJAPerf_SparseData_HPP
+
+#include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+namespace sparse
+{
+
+/*!
+ * \brief Number of entries in each row of the random matrix.
+ */
+const Index_type sparse_random_row_nnz = 16;
+
+/*!
+ * \brief Get the number of rows and non-zeros of the matrix of the given
+ *        kind with about target_rows rows.
+ */
+void getSparseMatrixSize(const std::string& kind, Index_type target_rows,
+                         Index_type& num_rows, Index_type& nnz);
+
+/*!
+ * \brief Set the CSR arrays of the matrix of the given kind with about
+ *        target_rows rows.
+ *
+ * row_ptr holds num_rows + 1 values, cols and vals hold nnz values, as
+ * given by getSparseMatrixSize.
+ */
+void setSparseMatrixCSR(const std::string& kind, Index_type target_rows,
+                        Index_ptr row_ptr, Index_ptr cols, Real_ptr vals);
+
+/*!
+ * \brief Length of the longest row of a CSR matrix.
+ */
+Index_type getMaxRowLength(Index_ptr row_ptr, Index_type num_rows);
+
+/*!
+ * \brief Set the ELL arrays, each holding num_rows * width values, from
+ *        a CSR matrix.
+ */
+void setEllFromCSR(Index_ptr row_ptr, Index_ptr cols, Real_ptr vals,
+                   Index_type num_rows, Index_type width,
+                   Index_ptr ell_cols, Real_ptr ell_vals);
+
+/*!
+ * \brief Number of chunks of chunk_size rows in a SELL matrix.
+ */
+inline Index_type getSellNumChunks(Index_type num_rows, Index_type chunk_size)
+{
+  return (num_rows + chunk_size - 1) / chunk_size;
+}
+
+/*!
+ * \brief Set the row order and chunk offsets of a SELL-C-sigma matrix
+ *        from a CSR matrix, and return the number of entries with padding.
+ *
+ * perm holds num_chunks * chunk_size rows in chunk order, with -1 for the
+ * rows past the end of the matrix in the last chunk. chunk_ptr holds
+ * num_chunks + 1 offsets of the chunks.
+ */
+Index_type setSellLayout(Index_ptr row_ptr, Index_type num_rows,
+                         Index_type chunk_size, Index_type sigma,
+                         Index_ptr perm, Index_ptr chunk_ptr);
+
+/*!
+ * \brief Set the SELL arrays, holding the number of entries returned by
+ *        setSellLayout, from a CSR matrix.
+ */
+void setSellFromCSR(Index_ptr row_ptr, Index_ptr cols, Real_ptr vals,
+                    Index_type num_rows, Index_type chunk_size,
+                    Index_ptr perm, Index_ptr chunk_ptr,
+                    Index_ptr sell_cols, Real_ptr sell_vals);
+
+/*!
+ * \brief Helpers naming the chunk size and sort window of each SPMV_SELL
+ *        tuning, used with seq_for to generate the tunings.
+ */
+template < Index_type chunk_size_, Index_type sigma_ >
+struct sell_helper
+{
+  static constexpr Index_type chunk_size = chunk_size_;
+  static constexpr Index_type sigma = sigma_;
+  static std::string get_name()
+  {
+    return "C"+std::to_string(chunk_size)+"_sigma"+std::to_string(sigma);
+  }
+};
+
+using sell_helpers = camp::list< sell_helper<8, 1>,
+                                 sell_helper<8, 256>,
+                                 sell_helper<32, 1>,
+                                 sell_helper<32, 256> >;
+
+} // end namespace sparse
+} // end namespace rajaperf
+
+#endif  // closing endif for header file include guard
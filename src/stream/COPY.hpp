@@ -13,6 +13,9 @@
 ///   c[i] = a[i] ;
 /// }
 ///
+/// The nontemporal tunings write c with streaming stores, which skip
+/// reading its cache lines first (see common/NontemporalStoreUtils.hpp).
+///
 
 #ifndef RAJAPerf_Stream_COPY_HPP
 #define RAJAPerf_Stream_COPY_HPP
@@ -53,6 +56,19 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename precision_helper >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename precision_helper >
+  void runOpenMPVariantPrecision(VariantID vid);
+  void runSeqVariantNontemporalSimd(VariantID vid);
+  void runSeqVariantNontemporalIntrinsics(VariantID vid);
+  void runOpenMPVariantNontemporalSimd(VariantID vid);
+  void runOpenMPVariantNontemporalIntrinsics(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -10,6 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/PrecisionUtils.hpp"
+#include "common/ReproducibleSumUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +21,7 @@ namespace stream
 {
 
 
-void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DOT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -105,5 +108,150 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+template < typename precision_helper >
+void DOT::runOpenMPVariantPrecision(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  using storage_type = typename precision_helper::storage_type;
+  using compute_type = typename precision_helper::compute_type;
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  storage_type* a;
+  storage_type* b;
+  allocAndConvertData(a, m_a, getActualProblemSize(), vid);
+  allocAndConvertData(b, m_b, getActualProblemSize(), vid);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        compute_type dot = m_dot_init;
+
+        #pragma omp parallel for reduction(+:dot)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          DOT_BODY;
+        }
+
+        m_dot += dot;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DOT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  deallocData(a, vid);
+  deallocData(b, vid);
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < typename sum_helper >
+void DOT::runOpenMPVariantReproducible(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DOT_DATA_SETUP;
+
+  auto dot_term_lam = [=](Index_type i) {
+    return a[i] * b[i];
+  };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      Real_ptr work;
+      allocData(work, sum_helper::workspaceSize(iend - ibegin), vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type sum = sum_helper::sumOpenMP(ibegin, iend,
+                                              dot_term_lam, work);
+
+        m_dot += m_dot_init + sum;
+
+      }
+      stopTimer();
+
+      deallocData(work, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DOT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void DOT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    runPrecisionTunings(tune_idx, t, [&](auto precision_helper) {
+      runOpenMPVariantPrecision<decltype(precision_helper)>(vid);
+    });
+
+    seq_for(reproducible_sum_helpers{}, [&](auto sum_helper) {
+      if (tune_idx == t) {
+        runOpenMPVariantReproducible<decltype(sum_helper)>(vid);
+      }
+      t += 1;
+    });
+
+  }
+}
+
+void DOT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    addPrecisionTuningDefinitions(*this, vid);
+
+    seq_for(reproducible_sum_helpers{}, [&](auto sum_helper) {
+      addVariantTuningName(vid, decltype(sum_helper)::get_name());
+    });
+
+  }
+}
+
 } // end namespace stream
 } // end namespace rajaperf
@@ -13,6 +13,9 @@
 ///   dot += a[i] * b[i];
 /// }
 ///
+/// The "pairwise" and "binned" tunings compute the sum so its bits do not
+/// depend on the number of threads (see common/ReproducibleSumUtils.hpp).
+///
 
 #ifndef RAJAPerf_Stream_DOT_HPP
 #define RAJAPerf_Stream_DOT_HPP
@@ -53,6 +56,19 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < typename precision_helper >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename precision_helper >
+  void runOpenMPVariantPrecision(VariantID vid);
+  template < typename sum_helper >
+  void runSeqVariantReproducible(VariantID vid);
+  template < typename sum_helper >
+  void runOpenMPVariantReproducible(VariantID vid);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size, typename MappingHelper >
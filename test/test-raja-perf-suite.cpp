@@ -14,12 +14,18 @@
 
 #include "common/Executor.hpp"
 #include "common/KernelBase.hpp"
+#include "common/PrecisionUtils.hpp"
+#include "common/DataUtils.hpp"
 
 #include <vector>
 #include <string>
 #include <iostream>
 #include <cmath>
 
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
 #include <mpi.h>
 #endif
@@ -29,7 +35,12 @@ int main( int argc, char** argv )
   testing::InitGoogleTest(&argc, argv);
 
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
-  MPI_Init(&argc, &argv);
+  int mpi_thread_support;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &mpi_thread_support);
+  if (mpi_thread_support < MPI_THREAD_FUNNELED) {
+    std::cerr << "\nMPI_THREAD_FUNNELED not supported, aborting" << std::endl;
+    MPI_Abort(MPI_COMM_WORLD, 1);
+  }
 #endif
 #if defined(RUN_KOKKOS)
   Kokkos::initialize(argc, argv);
@@ -149,7 +160,11 @@ TEST(ShortSuiteTest, Basic)
                     << kernel->getVariantTuningName(vid, tune_idx) 
                     << std::endl;
           EXPECT_GT(rtime, 0.0);
-          EXPECT_LT(cksum_diff, 1e-7);
+          // Precision tunings intentionally compute a different result
+          if ( !rajaperf::isPrecisionTuningName(
+                   kernel->getVariantTuningName(vid, tune_idx)) ) {
+            EXPECT_LT(cksum_diff, 1e-7);
+          }
           
         }
       } 
@@ -161,3 +176,30 @@ TEST(ShortSuiteTest, Basic)
   // clean up 
   delete [] argv; 
 }
+
+TEST(ChecksumTest, Blocked)
+{
+  const rajaperf::Size_type len = 1000003;
+  std::vector<rajaperf::Real_type> data(len);
+  for (rajaperf::Size_type i = 0; i < len; ++i) {
+    data[i] = 1.0 + 3.0*std::cos(0.37*i);
+  }
+
+  long double serial =
+      rajaperf::detail::calcChecksum(data.data(), len, 1.0);
+  long double blocked =
+      rajaperf::detail::calcChecksumBlocked(data.data(), len, 1.0);
+
+  EXPECT_LT(std::abs(blocked - serial), 1e-10 * std::abs(serial));
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  // Blocked result must not depend on the number of threads
+  int max_threads = omp_get_max_threads();
+  for (int nthreads = 1; nthreads <= 2*max_threads; nthreads *= 2) {
+    omp_set_num_threads(nthreads);
+    EXPECT_EQ(blocked,
+        rajaperf::detail::calcChecksumBlocked(data.data(), len, 1.0));
+  }
+  omp_set_num_threads(max_threads);
+#endif
+}